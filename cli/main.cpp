@@ -0,0 +1,396 @@
+#include "../common/header.h"
+#include "../common/io.h"
+#include "../common/log.h"
+#include "../filesystem/command.h"
+#include "google/protobuf/util/json_util.h"
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <getopt.h>
+#include <iostream>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void usage(const char *progname) {
+    log(ERROR, "Usage: %s [-p <port>] <command> [options]\n"
+               "    -p   --port=<d>           The extension port of tea-fs (default: 5211)\n"
+               "\n"
+               "Commands:\n"
+               "    search [options] <pattern> [path]   Search the file contents on the server\n"
+               "        -i   --ignore-case            Match case insensitively\n"
+               "        -r   --regex                  The pattern is an ECMAScript regular expression\n"
+               "        -g   --glob=<s>               Only search matching files, '!' excludes (repeatable)\n"
+               "        -H   --hidden                 Search hidden files and directories\n"
+               "        -m   --max-count=<d>          Stop after <d> matches\n"
+               "    warm [path...]                      Fetch the metadata of the paths (default: read from stdin)\n"
+               "    exec [options] [--] <command> [args...]   Execute the command on the server\n"
+               "        -C   --directory=<s>          The working directory on the mount (default: current directory)\n"
+               "        -e   --env=<s>                Set NAME=value in the environment of the command (repeatable)",
+        progname);
+}
+
+static int connect_extension(const int port) {
+    const int sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock < 0) {
+        log(ERROR, "Error creating socket: %s", strerror(errno));
+        return -1;
+    }
+    sockaddr_in addr = {.sin_family = AF_INET, .sin_port = htons(port), .sin_addr = {.s_addr = htonl(INADDR_LOOPBACK)}, .sin_zero = {}};
+    if (connect(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
+        log(ERROR, "Error connecting to tea-fs on port %d: %s", port, strerror(errno));
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+static int send_command(const int sock, const int id, const int command_id, const google::protobuf::Message &message) {
+    std::string json;
+    if (!google::protobuf::json::MessageToJsonString(message, &json).ok()) {
+        return -1;
+    }
+    Header header = {.size = static_cast<int32_t>(json.size()), .id = id, .type = command_id};
+    char *serialized = serialize(&header);
+    std::string frame(serialized, HEADER_SIZE);
+    delete[] serialized;
+    frame += json;
+
+    for (size_t written = 0; written < frame.size();) {
+        const auto n = write(sock, frame.data() + written, frame.size() - written);
+        if (n < 0) {
+            log(ERROR, "Error writing to tea-fs: %s", strerror(errno));
+            return -1;
+        }
+        written += n;
+    }
+    return 0;
+}
+
+// 1 on success, 0 on EOF, -1 on error
+static int read_command(const int sock, Header &header, std::string &payload) {
+    char buffer[HEADER_SIZE];
+    int n = full_read(sock, *buffer, HEADER_SIZE);
+    if (n <= 0) {
+        return n;
+    }
+    if (n < HEADER_SIZE) {
+        return -1;
+    }
+    deserialize(buffer, &header);
+    payload.resize(header.size);
+    if (header.size > 0 && full_read(sock, *payload.data(), header.size) < header.size) {
+        return -1;
+    }
+    return 1;
+}
+
+static const option search_options[] = {
+    {"ignore-case", no_argument, nullptr, 'i'}, {"regex", no_argument, nullptr, 'r'},         {"glob", required_argument, nullptr, 'g'},
+    {"hidden", no_argument, nullptr, 'H'},      {"max-count", required_argument, nullptr, 'm'}, {nullptr, 0, nullptr, 0},
+};
+
+// Exit status like grep: 0 when something matched, 1 when nothing did, 2 on errors
+// and -1 when the arguments are invalid.
+static int search(const int port, int argc, char *argv[]) {
+    SearchRequest req;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "irg:Hm:", search_options, nullptr)) != -1) {
+        switch (opt) {
+        case 'i':
+            req.set_ignore_case(true);
+            break;
+        case 'r':
+            req.set_regex(true);
+            break;
+        case 'g':
+            req.add_globs(optarg);
+            break;
+        case 'H':
+            req.set_hidden(true);
+            break;
+        case 'm':
+            req.set_max_results(atoi(optarg));
+            break;
+        default:
+            return -1;
+        }
+    }
+    if (optind >= argc) {
+        return -1;
+    }
+    req.set_pattern(argv[optind]);
+    if (optind + 1 < argc) {
+        std::string path = argv[optind + 1];
+        req.set_path(path.starts_with('/') ? path : "/" + path);
+    }
+
+    const int sock = connect_extension(port);
+    if (sock < 0) {
+        return 2;
+    }
+    const int search_id = 1;
+    if (send_command(sock, search_id, SEARCH_COMMAND, req) < 0) {
+        close(sock);
+        return 2;
+    }
+
+    bool found = false;
+    bool cancel_sent = false;
+    int ret = 2;
+    while (true) {
+        if (interrupted && !cancel_sent) {
+            SearchCancelRequest cancel;
+            cancel.set_search_id(search_id);
+            cancel_sent = send_command(sock, search_id + 1, SEARCH_CANCEL_COMMAND, cancel) == 0;
+        }
+        pollfd pfd = {.fd = sock, .events = POLLIN, .revents = 0};
+        if (poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
+
+        Header header;
+        std::string payload;
+        if (read_command(sock, header, payload) <= 0) {
+            log(ERROR, "Connection to tea-fs closed");
+            break;
+        }
+        if (header.type != SEARCH_COMMAND || header.id != search_id) {
+            continue;
+        }
+        SearchResponse res;
+        if (!google::protobuf::json::JsonStringToMessage(payload, &res).ok()) {
+            log(ERROR, "Invalid search response");
+            break;
+        }
+        for (const auto &match : res.matches()) {
+            found = true;
+            const auto &path = match.path();
+            printf("%s:%d:%d:%s\n", path.c_str() + (path.starts_with('/') ? 1 : 0), match.line(), match.column(), match.text().c_str());
+        }
+        if (res.done()) {
+            if (res.error() != 0 && res.error() != ECANCELED) {
+                log(ERROR, "Search failed: %s", strerror(res.error()));
+            } else {
+                ret = found ? 0 : 1;
+            }
+            break;
+        }
+    }
+    close(sock);
+    return interrupted ? 130 : ret;
+}
+
+// Sends a single command and waits for its response.
+static int call_command(const int port, const int command_id, const google::protobuf::Message &req, google::protobuf::Message *res) {
+    const int sock = connect_extension(port);
+    if (sock < 0) {
+        return -1;
+    }
+    const int id = 1;
+    int ret = send_command(sock, id, command_id, req);
+    while (ret == 0) {
+        Header header;
+        std::string payload;
+        if (read_command(sock, header, payload) <= 0) {
+            log(ERROR, "Connection to tea-fs closed");
+            ret = -1;
+            break;
+        }
+        if (header.type != command_id || header.id != id) {
+            continue;
+        }
+        if (!google::protobuf::json::JsonStringToMessage(payload, res).ok()) {
+            log(ERROR, "Invalid response");
+            ret = -1;
+        }
+        break;
+    }
+    close(sock);
+    return ret;
+}
+
+static int warm(const int port, int argc, char *argv[]) {
+    BatchStatRequest req;
+    const auto add = [&req](const std::string &path) {
+        if (!path.empty()) {
+            // not canonical, the links on the mount are resolved by the server
+            req.add_paths(std::filesystem::absolute(path).lexically_normal().string());
+        }
+    };
+    for (int i = 1; i < argc; i++) {
+        add(argv[i]);
+    }
+    if (argc < 2) {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            add(line);
+        }
+    }
+
+    BatchStatResponse res;
+    if (call_command(port, BATCH_STAT_COMMAND, req, &res) < 0) {
+        return 2;
+    }
+    if (res.error() != 0) {
+        log(ERROR, "Warm failed: %s", strerror(res.error()));
+        return 2;
+    }
+    int found = 0;
+    int missing = 0;
+    for (int i = 0; i < res.results_size(); i++) {
+        const auto err = res.results(i).error();
+        if (err == 0) {
+            found++;
+        } else if (err == ENOENT) {
+            missing++;
+        } else {
+            log(WARN, "%s: %s", req.paths(i).c_str(), strerror(err));
+        }
+    }
+    printf("%d paths, %d found, %d missing\n", res.results_size(), found, missing);
+    return 0;
+}
+
+static const option exec_options[] = {
+    {"directory", required_argument, nullptr, 'C'},
+    {"env", required_argument, nullptr, 'e'},
+    {nullptr, 0, nullptr, 0},
+};
+
+// Exit status of the command, 128 + the signal when it was killed, 125 when it could
+// not be run (127 when it was not found) and -1 when the arguments are invalid.
+static int exec(const int port, int argc, char *argv[]) {
+    ExecRequest req;
+    std::filesystem::path dir = std::filesystem::current_path();
+    int opt;
+    while ((opt = getopt_long(argc, argv, "+C:e:", exec_options, nullptr)) != -1) {
+        switch (opt) {
+        case 'C':
+            dir = std::filesystem::absolute(optarg).lexically_normal();
+            break;
+        case 'e':
+            if (strchr(optarg, '=') == nullptr) {
+                return -1;
+            }
+            req.add_env(optarg);
+            break;
+        default:
+            return -1;
+        }
+    }
+    if (optind >= argc) {
+        return -1;
+    }
+    for (int i = optind; i < argc; i++) {
+        req.add_argv(argv[i]);
+    }
+    req.set_path(dir.string());
+
+    const int sock = connect_extension(port);
+    if (sock < 0) {
+        return 125;
+    }
+    const int exec_id = 1;
+    if (send_command(sock, exec_id, EXEC_COMMAND, req) < 0) {
+        close(sock);
+        return 125;
+    }
+
+    bool cancel_sent = false;
+    int ret = 125;
+    while (true) {
+        if (interrupted && !cancel_sent) {
+            ExecCancelRequest cancel;
+            cancel.set_exec_id(exec_id);
+            cancel_sent = send_command(sock, exec_id + 1, EXEC_CANCEL_COMMAND, cancel) == 0;
+        }
+        pollfd pfd = {.fd = sock, .events = POLLIN, .revents = 0};
+        if (poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
+
+        Header header;
+        std::string payload;
+        if (read_command(sock, header, payload) <= 0) {
+            log(ERROR, "Connection to tea-fs closed");
+            break;
+        }
+        if (header.type != EXEC_COMMAND || header.id != exec_id) {
+            continue;
+        }
+        ExecResponse res;
+        if (!google::protobuf::json::JsonStringToMessage(payload, &res).ok()) {
+            log(ERROR, "Invalid exec response");
+            break;
+        }
+        fwrite(res.output().data(), 1, res.output().size(), stdout);
+        fwrite(res.error_output().data(), 1, res.error_output().size(), stderr);
+        fflush(stdout);
+        if (!res.done()) {
+            continue;
+        }
+        if (res.error() == EXDEV) {
+            log(ERROR, "%s is not on the mount", dir.c_str());
+        } else if (res.error() != 0 && res.error() != ECANCELED) {
+            log(ERROR, "Failed to execute %s: %s", req.argv(0).c_str(), strerror(res.error()));
+            ret = res.error() == ENOENT ? 127 : 125;
+        } else {
+            ret = res.signal() != 0 ? 128 + res.signal() : res.exit_code();
+        }
+        break;
+    }
+    close(sock);
+    return ret;
+}
+
+static const option long_options[] = {
+    {"port", required_argument, nullptr, 'p'},
+    {nullptr, 0, nullptr, 0},
+};
+
+int main(int argc, char *argv[]) {
+    int port = 5211;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "+p:", long_options, nullptr)) != -1) {
+        switch (opt) {
+        case 'p':
+            port = atoi(optarg);
+            break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    signal(SIGINT, [](int) { interrupted = 1; });
+
+    const std::string command = argv[optind];
+    const int command_argc = argc - optind;
+    char **command_argv = argv + optind;
+    optind = 1;
+    int ret = -1;
+    if (command == "search") {
+        ret = search(port, command_argc, command_argv);
+    } else if (command == "warm") {
+        ret = warm(port, command_argc, command_argv);
+    } else if (command == "exec") {
+        ret = exec(port, command_argc, command_argv);
+    } else {
+        log(ERROR, "Unknown command: %s", command.c_str());
+    }
+    if (ret < 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    return ret;
+}
@@ -2,40 +2,446 @@
 #include "../proto/messages.pb.h"
 #include "header.h"
 #include "log.h"
+#include <algorithm>
 #include <arpa/inet.h>
+#include <charconv>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <gnutls/gnutls.h>
 #include <google/protobuf/message.h>
+#include <linux/vm_sockets.h>
 #include <mutex>
+#include <netdb.h>
+#include <optional>
 #include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <unordered_map>
 
 std::mutex write_mutex;
 std::mutex read_mutex;
 
-int send_message(int sock, gnutls_session_t ssl, int id, Type type, google::protobuf::Message *body) {
+static std::mutex plain_connections_mutex;
+static std::unordered_map<int, Connection *> plain_connections;
+
+// the descriptors received on the sockets which accept them, in the order of arrival
+static std::mutex descriptors_mutex;
+static std::unordered_map<int, std::deque<int>> received_descriptors;
+
+static bool parse_number(const std::string &text, unsigned int max, unsigned int *value) {
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), *value);
+    return error == std::errc() && end == text.data() + text.size() && *value <= max;
+}
+
+bool parse_endpoint(const std::string &url, int default_port, Endpoint *endpoint) {
+    Endpoint result;
+    std::string rest = url;
+    if (auto scheme = url.find("://"); scheme != std::string::npos) {
+        const std::string name = url.substr(0, scheme);
+        rest = url.substr(scheme + 3);
+        if (name == "tls") {
+            result.transport = Endpoint::TLS;
+        } else if (name == "unix") {
+            result.transport = Endpoint::UNIX;
+        } else if (name == "vsock") {
+            result.transport = Endpoint::VSOCK;
+        } else {
+            return false;
+        }
+    }
+    if (result.transport == Endpoint::UNIX) {
+        if (rest.empty() || rest.front() != '/' || rest.size() >= sizeof(sockaddr_un::sun_path)) {
+            return false;
+        }
+        result.address = rest;
+        *endpoint = result;
+        return true;
+    }
+
+    std::string host = rest;
+    std::optional<std::string> port_text;
+    unsigned int port = default_port;
+    if (rest.starts_with('[')) {
+        // an IPv6 address, its colons are not the one of the port
+        auto bracket = rest.find(']');
+        if (bracket == std::string::npos || (bracket + 1 < rest.size() && rest[bracket + 1] != ':')) {
+            return false;
+        }
+        host = rest.substr(1, bracket - 1);
+        if (bracket + 1 < rest.size()) {
+            port_text = rest.substr(bracket + 2);
+        }
+    } else if (auto colon = rest.rfind(':'); colon != std::string::npos) {
+        host = rest.substr(0, colon);
+        port_text = rest.substr(colon + 1);
+    }
+    if (port_text && !parse_number(*port_text, 65535, &port)) {
+        return false;
+    }
+    result.port = port;
+    if (result.transport == Endpoint::VSOCK) {
+        // the side which listens takes the connections of any context
+        if (host.empty() || host == "any") {
+            result.cid = VMADDR_CID_ANY;
+        } else if (!parse_number(host, UINT32_MAX, &result.cid)) {
+            return false;
+        }
+    } else {
+        result.address = host;
+    }
+    *endpoint = result;
+    return true;
+}
+
+std::string endpoint_name(const Endpoint &endpoint) {
+    switch (endpoint.transport) {
+    case Endpoint::UNIX:
+        return "unix://" + endpoint.address;
+    case Endpoint::VSOCK:
+        return "vsock://" + (endpoint.cid == VMADDR_CID_ANY ? std::string("any") : std::to_string(endpoint.cid)) + ":" + std::to_string(endpoint.port);
+    case Endpoint::TLS:
+        break;
+    }
+    if (endpoint.address.find(':') != std::string::npos) {
+        return "tls://[" + endpoint.address + "]:" + std::to_string(endpoint.port);
+    }
+    return "tls://" + endpoint.address + ":" + std::to_string(endpoint.port);
+}
+
+static int connect_tcp(const Endpoint &endpoint) {
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *addresses = nullptr;
+    int err = getaddrinfo(endpoint.address.c_str(), std::to_string(endpoint.port).c_str(), &hints, &addresses);
+    if (err != 0) {
+        log(ERROR, "Error resolving %s: %s", endpoint.address.c_str(), gai_strerror(err));
+        return -1;
+    }
+    int sock = -1;
+    for (addrinfo *address = addresses; address != nullptr; address = address->ai_next) {
+        sock = socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+        if (sock < 0) {
+            continue;
+        }
+        if (connect(sock, address->ai_addr, address->ai_addrlen) == 0) {
+            break;
+        }
+        close(sock);
+        sock = -1;
+    }
+    freeaddrinfo(addresses);
+    return sock;
+}
+
+int connect_endpoint(const Endpoint &endpoint) {
+    int sock = -1;
+    switch (endpoint.transport) {
+    case Endpoint::TLS:
+        sock = connect_tcp(endpoint);
+        break;
+    case Endpoint::UNIX: {
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, endpoint.address.c_str(), sizeof(addr.sun_path) - 1);
+        sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (sock >= 0 && connect(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
+            close(sock);
+            sock = -1;
+        }
+        break;
+    }
+    case Endpoint::VSOCK: {
+        sockaddr_vm addr = {};
+        addr.svm_family = AF_VSOCK;
+        addr.svm_cid = endpoint.cid;
+        addr.svm_port = endpoint.port;
+        sock = socket(AF_VSOCK, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (sock >= 0 && connect(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
+            close(sock);
+            sock = -1;
+        }
+        break;
+    }
+    }
+    const std::string name = endpoint_name(endpoint);
+    if (sock < 0) {
+        log(ERROR, "Error connecting to %s: %s", name.c_str(), strerror(errno));
+        return -1;
+    }
+    log(INFO, sock, "Connected to %s", name.c_str());
+    return sock;
+}
+
+// The address of a TLS endpoint to listen on, an empty address or :: are the addresses
+// of both families. False when the address is not a numeric one.
+static bool listen_address(const Endpoint &endpoint, sockaddr_storage *addr, socklen_t *len) {
+    auto *v4 = reinterpret_cast<sockaddr_in *>(addr);
+    if (inet_pton(AF_INET, endpoint.address.c_str(), &v4->sin_addr) == 1) {
+        v4->sin_family = AF_INET;
+        v4->sin_port = htons(endpoint.port);
+        *len = sizeof(sockaddr_in);
+        return true;
+    }
+    auto *v6 = reinterpret_cast<sockaddr_in6 *>(addr);
+    v6->sin6_family = AF_INET6;
+    v6->sin6_port = htons(endpoint.port);
+    v6->sin6_addr = in6addr_any;
+    *len = sizeof(sockaddr_in6);
+    return endpoint.address.empty() || inet_pton(AF_INET6, endpoint.address.c_str(), &v6->sin6_addr) == 1;
+}
+
+int listen_endpoint(const Endpoint &endpoint) {
+    int sock = -1;
+    int err = 0;
+    switch (endpoint.transport) {
+    case Endpoint::TLS: {
+        sockaddr_storage addr = {};
+        socklen_t addr_len = 0;
+        if (!listen_address(endpoint, &addr, &addr_len)) {
+            log(ERROR, "Invalid address %s", endpoint.address.c_str());
+            return -1;
+        }
+        sock = socket(addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (sock < 0 && errno == EAFNOSUPPORT && addr.ss_family == AF_INET6 && endpoint.address.find_first_not_of(":") == std::string::npos) {
+            // a host without IPv6 listens on all of its IPv4 addresses
+            auto *v4 = reinterpret_cast<sockaddr_in *>(&addr);
+            *v4 = {};
+            v4->sin_family = AF_INET;
+            v4->sin_port = htons(endpoint.port);
+            v4->sin_addr.s_addr = INADDR_ANY;
+            addr_len = sizeof(sockaddr_in);
+            sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        }
+        constexpr int one = 1;
+        constexpr int zero = 0;
+        // every reactor listens on its own socket, the kernel balances the connections
+        if (sock >= 0 && (setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0 || setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) < 0)) {
+            err = -1;
+        }
+        // the IPv4 clients come in as mapped addresses
+        if (sock >= 0 && err == 0 && addr.ss_family == AF_INET6) {
+            err = setsockopt(sock, IPPROTO_IPV6, IPV6_V6ONLY, &zero, sizeof(zero));
+        }
+        if (sock >= 0 && err == 0) {
+            err = bind(sock, reinterpret_cast<sockaddr *>(&addr), addr_len);
+        }
+        break;
+    }
+    case Endpoint::UNIX: {
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, endpoint.address.c_str(), sizeof(addr.sun_path) - 1);
+        // the socket of a previous run
+        struct stat st;
+        if (lstat(endpoint.address.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+            unlink(endpoint.address.c_str());
+        }
+        sock = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (sock >= 0) {
+            err = bind(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+        }
+        break;
+    }
+    case Endpoint::VSOCK: {
+        sockaddr_vm addr = {};
+        addr.svm_family = AF_VSOCK;
+        addr.svm_cid = endpoint.cid;
+        addr.svm_port = endpoint.port;
+        sock = socket(AF_VSOCK, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (sock >= 0) {
+            err = bind(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+        }
+        break;
+    }
+    }
+    const std::string name = endpoint_name(endpoint);
+    if (sock < 0 || err < 0 || listen(sock, SOMAXCONN) < 0) {
+        log(ERROR, "Error listening on %s: %s", name.c_str(), strerror(errno));
+        if (sock >= 0) {
+            close(sock);
+        }
+        return -1;
+    }
+    return sock;
+}
+
+bool peer_allowed(int sock, const Endpoint &endpoint) {
+    if (endpoint.transport != Endpoint::UNIX) {
+        return true;
+    }
+    ucred cred = {};
+    socklen_t len = sizeof(cred);
+    if (getsockopt(sock, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0) {
+        log(ERROR, sock, "Error getting peer credentials: %s", strerror(errno));
+        return false;
+    }
+    if (cred.uid != geteuid() && cred.uid != 0) {
+        log(ERROR, sock, "Refused connection of pid %d uid %d", cred.pid, cred.uid);
+        return false;
+    }
+    log(DEBUG, sock, "Connection of pid %d uid %d", cred.pid, cred.uid);
+    return true;
+}
+
+static ssize_t plain_error(ssize_t fatal) {
+    // EWOULDBLOCK is the same error on Linux
+    if (errno == EAGAIN) {
+        return GNUTLS_E_AGAIN;
+    }
+    if (errno == EINTR) {
+        return GNUTLS_E_INTERRUPTED;
+    }
+    return fatal;
+}
+
+ssize_t transport_recv(int sock, gnutls_session_t ssl, void *buffer, size_t size) {
+    if (ssl != nullptr) {
+        return gnutls_record_recv(ssl, buffer, size);
+    }
+    // a few descriptors fit, more than one is never sent with a frame
+    alignas(struct cmsghdr) char control[CMSG_SPACE(4 * sizeof(int))];
+    struct iovec iov = {.iov_base = buffer, .iov_len = size};
+    struct msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    ssize_t n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+    if (n < 0) {
+        return plain_error(GNUTLS_E_PULL_ERROR);
+    }
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        std::lock_guard<std::mutex> lock(descriptors_mutex);
+        auto it = received_descriptors.find(sock);
+        for (size_t i = 0; i < count; i++) {
+            int descriptor;
+            memcpy(&descriptor, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+            if (it != received_descriptors.end()) {
+                it->second.push_back(descriptor);
+            } else {
+                close(descriptor);
+            }
+        }
+    }
+    return n;
+}
+
+ssize_t transport_send(int sock, gnutls_session_t ssl, const void *buffer, size_t size) {
+    if (ssl != nullptr) {
+        return gnutls_record_send(ssl, buffer, size);
+    }
+    ssize_t n = send(sock, buffer, size, MSG_NOSIGNAL);
+    return n >= 0 ? n : plain_error(GNUTLS_E_PUSH_ERROR);
+}
+
+bool can_pass_descriptors(int sock, gnutls_session_t ssl) {
+    int domain = 0;
+    socklen_t len = sizeof(domain);
+    return ssl == nullptr && getsockopt(sock, SOL_SOCKET, SO_DOMAIN, &domain, &len) == 0 && domain == AF_UNIX;
+}
+
+ssize_t transport_send_descriptor(int sock, const void *buffer, size_t size, int descriptor) {
+    alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    struct iovec iov = {.iov_base = const_cast<void *>(buffer), .iov_len = size};
+    struct msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &descriptor, sizeof(int));
+    ssize_t n = sendmsg(sock, &msg, MSG_NOSIGNAL);
+    return n >= 0 ? n : plain_error(GNUTLS_E_PUSH_ERROR);
+}
+
+void accept_descriptors(int sock) {
+    std::lock_guard<std::mutex> lock(descriptors_mutex);
+    received_descriptors.try_emplace(sock);
+}
+
+int take_descriptor(int sock) {
+    std::lock_guard<std::mutex> lock(descriptors_mutex);
+    auto it = received_descriptors.find(sock);
+    if (it == received_descriptors.end() || it->second.empty()) {
+        return -1;
+    }
+    int descriptor = it->second.front();
+    it->second.pop_front();
+    return descriptor;
+}
+
+static Connection *connection_of(int sock, gnutls_session_t ssl) {
+    if (ssl != nullptr) {
+        return static_cast<Connection *>(gnutls_session_get_ptr(ssl));
+    }
+    std::lock_guard<std::mutex> lock(plain_connections_mutex);
+    auto it = plain_connections.find(sock);
+    return it != plain_connections.end() ? it->second : nullptr;
+}
+
+void attach_connection(int sock, Connection *connection) {
+    std::lock_guard<std::mutex> lock(plain_connections_mutex);
+    plain_connections[sock] = connection;
+}
+
+void detach_connection(int sock) {
+    std::lock_guard<std::mutex> lock(plain_connections_mutex);
+    plain_connections.erase(sock);
+}
+
+// The header and the body of the message, empty when it can not be serialized.
+static std::string serialize_frame(int id, Type type, google::protobuf::Message *body) {
     Header header;
     header.size = body->ByteSizeLong();
     header.id = id;
     header.type = type;
 
+    std::string frame(HEADER_SIZE + header.size, '\0');
     char *header_buffer = serialize(&header);
-    char *message_buffer = new char[HEADER_SIZE + body->ByteSizeLong()];
-    memcpy(message_buffer, header_buffer, HEADER_SIZE);
+    memcpy(frame.data(), header_buffer, HEADER_SIZE);
     delete[] header_buffer;
+    if (!body->SerializeToArray(frame.data() + HEADER_SIZE, header.size)) {
+        return {};
+    }
+    return frame;
+}
 
-    char *body_buffer = new char[body->ByteSizeLong()];
-    bool err = body->SerializeToArray(body_buffer, body->ByteSizeLong());
-    if (!err) {
+int send_message(int sock, gnutls_session_t ssl, int id, Type type, google::protobuf::Message *body) { return send_message(sock, ssl, id, type, body, -1); }
+
+int send_message(int sock, gnutls_session_t ssl, int id, Type type, google::protobuf::Message *body, int descriptor) {
+    auto frame = serialize_frame(id, type, body);
+    if (frame.empty()) {
         log(DEBUG, sock, "(%d) Serialize body failed", id);
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
         return -1;
     }
-    memcpy(message_buffer + HEADER_SIZE, body_buffer, body->ByteSizeLong());
-    delete[] body_buffer;
-    int len = full_write(sock, ssl, *message_buffer, HEADER_SIZE + body->ByteSizeLong());
-    delete[] message_buffer;
+    int len;
+    auto *connection = connection_of(sock, ssl);
+    if (connection != nullptr && descriptor >= 0) {
+        len = connection->send_frame_with_descriptor(std::move(frame), descriptor);
+    } else if (connection != nullptr) {
+        len = connection->send_frame(std::move(frame));
+    } else if (descriptor >= 0) {
+        // only the connections of the server pass descriptors
+        close(descriptor);
+        len = GNUTLS_E_INVALID_REQUEST;
+    } else {
+        len = full_write(sock, ssl, *frame.data(), frame.size());
+    }
 
     if (len < 0) {
         log(ERROR, sock, "Send message failed: %s\n", gnutls_strerror(len));
@@ -43,18 +449,31 @@ int send_message(int sock, gnutls_session_t ssl, int id, Type type, google::prot
     }
     if (type == LSP_REQUEST || type == LSP_RESPONSE) {
         log(DEBUG, sock, "(%d) Send LSP message success - %d bytes", id, len);
-    } else {
+    } else if (debug_log_enabled()) {
         std::string debug = body->DebugString();
         log(DEBUG, sock, "(%d) Send message success: %s - %d bytes", id, debug.c_str(), len);
     }
     return len;
 }
 
+int Connection::send_chunk(int id, Type type, google::protobuf::Message *message, const std::atomic<bool> &cancelled) {
+    while (!cancelled && !wait_for_room(std::chrono::milliseconds(100))) {
+    }
+    // sent on this connection and not looked up by the socket, which may belong to another one by now
+    auto frame = serialize_frame(id, type, message);
+    return frame.empty() ? -1 : send_frame(std::move(frame));
+}
+
+std::shared_ptr<Connection> hold_connection(int sock, gnutls_session_t ssl) {
+    auto *connection = connection_of(sock, ssl);
+    return connection != nullptr ? connection->shared_from_this() : nullptr;
+}
+
 int full_write(int fd, gnutls_session_t ssl, char &buf, int size) {
     int recv = 0;
     std::lock_guard<std::mutex> lock(write_mutex);
     do {
-        int len = gnutls_record_send(ssl, &buf + recv, size - recv);
+        int len = transport_send(fd, ssl, &buf + recv, size - recv);
         if (len < 0) {
             if (len == GNUTLS_E_INTERRUPTED || len == GNUTLS_E_AGAIN) {
                 continue;
@@ -73,7 +492,11 @@ int full_read(int fd, gnutls_session_t ssl, char &buf, int size) {
         int len = 0;
         {
             std::lock_guard<std::mutex> lock(read_mutex);
-            len = gnutls_record_recv(ssl, &buf + recived, size - recived);
+            len = transport_recv(fd, ssl, &buf + recived, size - recived);
+        }
+        // also returned after a session ticket was received
+        if (len == GNUTLS_E_INTERRUPTED || len == GNUTLS_E_AGAIN) {
+            continue;
         }
         if (len == 0) {
             log(DEBUG, fd, "EOF");
@@ -114,7 +537,7 @@ int recv_handler_caller(char *recv_buffer, Header *header, int sock, gnutls_sess
     const std::string type = typeid(T).name();
     if (typeid(T) == typeid(LspRequest) || typeid(T) == typeid(LspResponse)) {
         log(DEBUG, sock, "(%d) Received LSP: %s\n", header->id, type.c_str());
-    } else {
+    } else if (debug_log_enabled()) {
         log(DEBUG, sock, "(%d) Received: %s\n %s", header->id, type.c_str(), request.DebugString().c_str());
     }
 
@@ -122,36 +545,6 @@ int recv_handler_caller(char *recv_buffer, Header *header, int sock, gnutls_sess
     return ret;
 }
 
-int handle_recv_lsp(const int sock, gnutls_session_t ssl, const int server_sock, const std::function<int(int, gnutls_session_t, int, int, char *)> &handler) {
-    char buffer[HEADER_SIZE];
-    int received = full_read(sock, *buffer, sizeof(buffer));
-    if (received == 0) {
-        return 0;
-    }
-    if (received < static_cast<int>(sizeof(buffer))) {
-        log(DEBUG, sock, "Full header read failed");
-        return -1;
-    }
-    Header header = {};
-    deserialize(buffer, &header);
-    log(DEBUG, sock, "Received header: size %d id %d type %d %d bytes", header.size, header.id, header.type, received);
-    auto *recv_buffer = new char[header.size + 1];
-    received = full_read(sock, *recv_buffer, header.size);
-    if (received == 0 && header.size != 0) {
-        return 0;
-    }
-    if (received < header.size) {
-        return -1;
-    }
-
-    recv_buffer[header.size] = '\0'; // ensure that the string is null-terminated
-    log(DEBUG, sock, "Received message: %s", recv_buffer);
-
-    const auto ret = handler(server_sock, ssl, header.id, header.type /* language_id */, recv_buffer);
-    delete[] recv_buffer;
-    return ret;
-}
-
 // Handle recv messages, 1 on success, 0 on EOF, -1 on error
 int handle_recv(int sock, gnutls_session_t ssl, recv_handlers &handlers) {
     char buffer[HEADER_SIZE];
@@ -175,6 +568,25 @@ int handle_recv(int sock, gnutls_session_t ssl, recv_handlers &handlers) {
         return -1;
     }
 
+    int ret = handle_message(sock, ssl, header, recv_buffer, handlers);
+    delete header;
+    delete[] recv_buffer;
+    return ret;
+}
+
+int64_t request_cost(const Header &header, const char *body) {
+    int64_t cost = HEADER_SIZE + header.size;
+    if (header.type == Type::READ_REQUEST) {
+        ReadRequest request;
+        if (request.ParseFromArray(body, header.size)) {
+            cost += std::max(request.size(), 0);
+        }
+    }
+    return cost;
+}
+
+// 1 on success, negative when the handler failed
+int handle_message(int sock, gnutls_session_t ssl, Header *header, char *recv_buffer, recv_handlers &handlers) {
     int ret = -2;
     switch (header->type) {
     case Type::INIT_REQUEST: {
@@ -449,6 +861,62 @@ int handle_recv(int sock, gnutls_session_t ssl, recv_handlers &handlers) {
         ret = recv_handler_caller<LspResponse>(recv_buffer, header, sock, ssl, handlers.lsp_response);
         break;
     }
+    case Type::COPY_FILE_RANGE_REQUEST: {
+        ret = recv_handler_caller<CopyFileRangeRequest>(recv_buffer, header, sock, ssl, handlers.copy_file_range_request);
+        break;
+    }
+    case Type::COPY_FILE_RANGE_RESPONSE: {
+        ret = recv_handler_caller<CopyFileRangeResponse>(recv_buffer, header, sock, ssl, handlers.copy_file_range_response);
+        break;
+    }
+    case Type::SEARCH_REQUEST: {
+        ret = recv_handler_caller<SearchRequest>(recv_buffer, header, sock, ssl, handlers.search_request);
+        break;
+    }
+    case Type::SEARCH_RESPONSE: {
+        ret = recv_handler_caller<SearchResponse>(recv_buffer, header, sock, ssl, handlers.search_response);
+        break;
+    }
+    case Type::SEARCH_CANCEL_REQUEST: {
+        ret = recv_handler_caller<SearchCancelRequest>(recv_buffer, header, sock, ssl, handlers.search_cancel_request);
+        break;
+    }
+    case Type::SEARCH_CANCEL_RESPONSE: {
+        ret = recv_handler_caller<SearchCancelResponse>(recv_buffer, header, sock, ssl, handlers.search_cancel_response);
+        break;
+    }
+    case Type::BATCH_STAT_REQUEST: {
+        ret = recv_handler_caller<BatchStatRequest>(recv_buffer, header, sock, ssl, handlers.batch_stat_request);
+        break;
+    }
+    case Type::BATCH_STAT_RESPONSE: {
+        ret = recv_handler_caller<BatchStatResponse>(recv_buffer, header, sock, ssl, handlers.batch_stat_response);
+        break;
+    }
+    case Type::SAVE_REQUEST: {
+        ret = recv_handler_caller<SaveRequest>(recv_buffer, header, sock, ssl, handlers.save_request);
+        break;
+    }
+    case Type::SAVE_RESPONSE: {
+        ret = recv_handler_caller<SaveResponse>(recv_buffer, header, sock, ssl, handlers.save_response);
+        break;
+    }
+    case Type::EXEC_REQUEST: {
+        ret = recv_handler_caller<ExecRequest>(recv_buffer, header, sock, ssl, handlers.exec_request);
+        break;
+    }
+    case Type::EXEC_RESPONSE: {
+        ret = recv_handler_caller<ExecResponse>(recv_buffer, header, sock, ssl, handlers.exec_response);
+        break;
+    }
+    case Type::EXEC_CANCEL_REQUEST: {
+        ret = recv_handler_caller<ExecCancelRequest>(recv_buffer, header, sock, ssl, handlers.exec_cancel_request);
+        break;
+    }
+    case Type::EXEC_CANCEL_RESPONSE: {
+        ret = recv_handler_caller<ExecCancelResponse>(recv_buffer, header, sock, ssl, handlers.exec_cancel_response);
+        break;
+    }
     default: {
         log(DEBUG, sock, "(%d) Unknown message type: %d", header->id, header->type);
         break;
@@ -460,7 +928,5 @@ int handle_recv(int sock, gnutls_session_t ssl, recv_handlers &handlers) {
         log(DEBUG, sock, "Handler success: %d", ret);
         ret = 1;
     }
-    delete header;
-    delete[] recv_buffer;
     return ret;
 };
@@ -1,13 +1,103 @@
 #pragma once
 #include "../proto/messages.pb.h"
+#include "header.h"
 #include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <gnutls/gnutls.h>
 #include <google/protobuf/message.h>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+
+// The server is reached over one of these transports, given as a URL:
+//   host, tls://host[:port]    TLS over TCP, an IPv6 address is written in brackets
+//   unix:///path/to/socket     plain, only processes of the user running the server may connect
+//   vsock://cid[:port]         plain, between a virtual machine and its host, the peers
+//                              are not checked, every virtual machine of the host may connect
+// The plain transports have no TLS session, they are passed around as the socket with
+// a null session.
+struct Endpoint {
+    enum Transport { TLS, UNIX, VSOCK };
+    Transport transport = TLS;
+    // the host of TLS, the path of UNIX
+    std::string address;
+    // the port of TLS and VSOCK
+    int port = 0;
+    // the context id of VSOCK
+    unsigned int cid = 0;
+};
+
+// false when the URL is malformed
+bool parse_endpoint(const std::string &url, int default_port, Endpoint *endpoint);
+std::string endpoint_name(const Endpoint &endpoint);
+// Returns a connected blocking socket, -1 on error.
+int connect_endpoint(const Endpoint &endpoint);
+// Returns a non-blocking listening socket, -1 on error.
+int listen_endpoint(const Endpoint &endpoint);
+// Checks the credentials of a peer on a plain transport.
+bool peer_allowed(int sock, const Endpoint &endpoint);
+
+// Read or write on the session, or on the socket of a plain transport. The results are
+// the ones of gnutls_record_recv and gnutls_record_send, GNUTLS_E_AGAIN when it would block.
+ssize_t transport_recv(int sock, gnutls_session_t ssl, void *buffer, size_t size);
+ssize_t transport_send(int sock, gnutls_session_t ssl, const void *buffer, size_t size);
+
+// Descriptors can be handed over on the Unix sockets only (SCM_RIGHTS), the server passes
+// the descriptors of the opened files to a filesystem on the same host.
+bool can_pass_descriptors(int sock, gnutls_session_t ssl);
+// Sends the buffer with the descriptor attached to its first byte.
+ssize_t transport_send_descriptor(int sock, const void *buffer, size_t size, int descriptor);
+// The descriptors received on the socket are kept until taken, the ones received on the
+// other sockets are closed right away.
+void accept_descriptors(int sock);
+// Returns the oldest descriptor received on the socket, -1 when there is none.
+int take_descriptor(int sock);
+
+// Owner of a non-blocking session, set as the session pointer or attached to the socket
+// of a plain transport. Messages sent on such a session are handed to the connection
+// instead of being written by the caller.
+class Connection : public std::enable_shared_from_this<Connection> {
+  public:
+    virtual ~Connection() = default;
+    // Number of bytes accepted or -1 when the connection is closed.
+    virtual int send_frame(std::string frame) = 0;
+    // Sends the frame with the descriptor attached and closes the descriptor, -1 when the
+    // connection can not pass descriptors.
+    virtual int send_frame_with_descriptor(std::string frame, int descriptor) {
+        (void)frame;
+        close(descriptor);
+        return -1;
+    }
+    // Waits until the peer takes the queued frames, false when they are still queued
+    // after the timeout. Producers of unsolicited messages use it to stay in the window.
+    virtual bool wait_for_room(std::chrono::milliseconds timeout) {
+        (void)timeout;
+        return true;
+    }
+    // Sends a part of a long answer, the matches of a search or the output of a command. The
+    // producer waits for a peer which does not read instead of queueing the parts, until it
+    // is cancelled. -1 when the connection is closed, a closed connection takes no more parts.
+    int send_chunk(int id, Type type, google::protobuf::Message *message, const std::atomic<bool> &cancelled);
+};
+
+// Returns the connection owning the session, nullptr for blocking sessions. Holding
+// it keeps the session alive while work for the connection is pending.
+std::shared_ptr<Connection> hold_connection(int sock, gnutls_session_t ssl);
+// The connections of plain transports are found by their socket.
+void attach_connection(int sock, Connection *connection);
+void detach_connection(int sock);
 
 int send_message(int sock, gnutls_session_t ssl, int id, Type type, google::protobuf::Message *message);
+// Sends the message with the descriptor attached, the descriptor is closed in any case.
+int send_message(int sock, gnutls_session_t ssl, int id, Type type, google::protobuf::Message *message, int descriptor);
+
+// The bytes a request takes from the credit window, the frame and the data it asks for.
+int64_t request_cost(const Header &header, const char *body);
 
 struct recv_handlers {
     int (*init_request)(int sock, gnutls_session_t ssl, int id, InitRequest *request);
@@ -78,10 +168,25 @@ struct recv_handlers {
     int (*lseek_response)(int sock, gnutls_session_t ssl, int id, LseekResponse *response);
     int (*lsp_request)(int sock, gnutls_session_t ssl, int id, LspRequest *request);
     int (*lsp_response)(int sock, gnutls_session_t ssl, int id, LspResponse *response);
+    int (*copy_file_range_request)(int sock, gnutls_session_t ssl, int id, CopyFileRangeRequest *request);
+    int (*copy_file_range_response)(int sock, gnutls_session_t ssl, int id, CopyFileRangeResponse *response);
+    int (*search_request)(int sock, gnutls_session_t ssl, int id, SearchRequest *request);
+    int (*search_response)(int sock, gnutls_session_t ssl, int id, SearchResponse *response);
+    int (*search_cancel_request)(int sock, gnutls_session_t ssl, int id, SearchCancelRequest *request);
+    int (*search_cancel_response)(int sock, gnutls_session_t ssl, int id, SearchCancelResponse *response);
+    int (*batch_stat_request)(int sock, gnutls_session_t ssl, int id, BatchStatRequest *request);
+    int (*batch_stat_response)(int sock, gnutls_session_t ssl, int id, BatchStatResponse *response);
+    int (*save_request)(int sock, gnutls_session_t ssl, int id, SaveRequest *request);
+    int (*save_response)(int sock, gnutls_session_t ssl, int id, SaveResponse *response);
+    int (*exec_request)(int sock, gnutls_session_t ssl, int id, ExecRequest *request);
+    int (*exec_response)(int sock, gnutls_session_t ssl, int id, ExecResponse *response);
+    int (*exec_cancel_request)(int sock, gnutls_session_t ssl, int id, ExecCancelRequest *request);
+    int (*exec_cancel_response)(int sock, gnutls_session_t ssl, int id, ExecCancelResponse *response);
 };
 
 int handle_recv(int sock, gnutls_session_t ssl, recv_handlers &handlers);
-int handle_recv_lsp(int sock, gnutls_session_t ssl, int server_sock, const std::function<int(int, gnutls_session_t, int, int, char *)> &handler);
+// Calls the handler for a message which was already read.
+int handle_message(int sock, gnutls_session_t ssl, Header *header, char *body, recv_handlers &handlers);
 
 int full_read(int fd, gnutls_session_t ssl, char &buf, int size);
 int full_write(int fd, gnutls_session_t ssl, char &buf, int size);
@@ -0,0 +1,295 @@
+#include "json.h"
+
+#include <cctype>
+#include <cstring>
+
+const char *json_member(const std::string &data, const char *key, const char *from) {
+    const auto key_length = strlen(key);
+    for (const char *p = strcasestr(from, key); p != nullptr; p = strcasestr(p + 1, key)) {
+        const char *value = p + key_length;
+        if (p == data.c_str() || p[-1] != '"' || *value++ != '"') {
+            continue;
+        }
+        value += strspn(value, " \t\r\n");
+        if (*value++ != ':') {
+            continue;
+        }
+        return value + strspn(value, " \t\r\n");
+    }
+    return nullptr;
+}
+
+std::optional<std::string_view> json_string(const std::string &data, const char *key) {
+    for (const char *value = json_member(data, key, data.c_str()); value != nullptr; value = json_member(data, key, value)) {
+        if (*value == '"') {
+            return std::string_view(value + 1, strcspn(value + 1, "\""));
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string_view> json_value(const std::string &data, const char *key) {
+    const char *value = json_member(data, key, data.c_str());
+    if (value == nullptr) {
+        return std::nullopt;
+    }
+    const char *p = value;
+    int depth = 0;
+    bool string = false;
+    for (; *p != '\0'; p++) {
+        if (string) {
+            if (*p == '\\' && p[1] != '\0') {
+                p++;
+            } else if (*p == '"') {
+                string = false;
+                if (depth == 0) {
+                    return std::string_view(value, p + 1 - value);
+                }
+            }
+        } else if (*p == '"') {
+            string = true;
+        } else if (*p == '{' || *p == '[') {
+            depth++;
+        } else if (*p == '}' || *p == ']') {
+            if (depth-- == 0) {
+                break;
+            }
+            if (depth == 0) {
+                return std::string_view(value, p + 1 - value);
+            }
+        } else if (depth == 0 && (*p == ',' || isspace(static_cast<unsigned char>(*p)))) {
+            break;
+        }
+    }
+    return p > value ? std::optional(std::string_view(value, p - value)) : std::nullopt;
+}
+
+static size_t skip_space(std::string_view data, size_t at) {
+    while (at < data.size() && isspace(static_cast<unsigned char>(data[at]))) {
+        at++;
+    }
+    return at;
+}
+
+// The end of the string starting with the quote at at, npos when it is not closed.
+static size_t skip_string(std::string_view data, size_t at) {
+    for (at++; at < data.size(); at++) {
+        if (data[at] == '\\') {
+            at++;
+        } else if (data[at] == '"') {
+            return at + 1;
+        }
+    }
+    return std::string_view::npos;
+}
+
+// The end of the value starting at at, npos when it is cut off.
+static size_t skip_value(std::string_view data, size_t at) {
+    if (at >= data.size()) {
+        return std::string_view::npos;
+    }
+    if (data[at] == '"') {
+        return skip_string(data, at);
+    }
+    if (data[at] != '{' && data[at] != '[') {
+        while (at < data.size() && data[at] != ',' && data[at] != '}' && data[at] != ']' && !isspace(static_cast<unsigned char>(data[at]))) {
+            at++;
+        }
+        return at;
+    }
+    int depth = 0;
+    while (at < data.size()) {
+        const char c = data[at];
+        if (c == '"') {
+            at = skip_string(data, at);
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if ((c == '}' || c == ']') && --depth == 0) {
+            return at + 1;
+        }
+        at++;
+    }
+    return std::string_view::npos;
+}
+
+// The start of the value of the member named key of the object starting at at, npos when there is none.
+static size_t find_member(std::string_view data, size_t at, std::string_view key) {
+    if (at >= data.size() || data[at] != '{') {
+        return std::string_view::npos;
+    }
+    at = skip_space(data, at + 1);
+    while (at < data.size() && data[at] == '"') {
+        const size_t name_end = skip_string(data, at);
+        if (name_end == std::string_view::npos) {
+            break;
+        }
+        const auto name = data.substr(at + 1, name_end - at - 2);
+        at = skip_space(data, name_end);
+        if (at >= data.size() || data[at] != ':') {
+            break;
+        }
+        at = skip_space(data, at + 1);
+        if (name == key) {
+            return at;
+        }
+        at = skip_space(data, skip_value(data, at));
+        if (at >= data.size() || data[at] != ',') {
+            break;
+        }
+        at = skip_space(data, at + 1);
+    }
+    return std::string_view::npos;
+}
+
+std::optional<std::string_view> json_at(std::string_view data, std::initializer_list<std::string_view> path) {
+    size_t at = skip_space(data, 0);
+    for (const auto key : path) {
+        at = find_member(data, at, key);
+    }
+    const size_t end = skip_value(data, at);
+    if (end == std::string_view::npos || end == at) {
+        return std::nullopt;
+    }
+    return data.substr(at, end - at);
+}
+
+std::optional<std::string_view> json_string_at(std::string_view data, std::initializer_list<std::string_view> path) {
+    const auto value = json_at(data, path);
+    if (!value.has_value() || value->front() != '"') {
+        return std::nullopt;
+    }
+    return value->substr(1, value->size() - 2);
+}
+
+std::vector<std::string_view> json_elements(std::string_view array) {
+    std::vector<std::string_view> elements;
+    size_t at = skip_space(array, 0);
+    if (at >= array.size() || array[at] != '[') {
+        return elements;
+    }
+    at = skip_space(array, at + 1);
+    while (at < array.size() && array[at] != ']') {
+        const size_t end = skip_value(array, at);
+        if (end == std::string_view::npos || end == at) {
+            return {};
+        }
+        elements.push_back(array.substr(at, end - at));
+        at = skip_space(array, end);
+        if (at < array.size() && array[at] == ',') {
+            at = skip_space(array, at + 1);
+        }
+    }
+    return elements;
+}
+
+static void append_utf8(std::string &out, uint32_t code) {
+    if (code < 0x80) {
+        out.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+static uint32_t hex4(std::string_view digits) {
+    uint32_t code = 0;
+    for (const char c : digits.substr(0, 4)) {
+        code = code << 4 | (isdigit(static_cast<unsigned char>(c)) ? c - '0' : (tolower(static_cast<unsigned char>(c)) - 'a' + 10) & 0xF);
+    }
+    return code;
+}
+
+std::string json_unescape(std::string_view quoted) {
+    if (quoted.size() >= 2 && quoted.front() == '"' && quoted.back() == '"') {
+        quoted = quoted.substr(1, quoted.size() - 2);
+    }
+    std::string text;
+    text.reserve(quoted.size());
+    for (size_t i = 0; i < quoted.size(); i++) {
+        const char c = quoted[i];
+        if (c != '\\' || i + 1 == quoted.size()) {
+            text.push_back(c);
+            continue;
+        }
+        switch (const char escaped = quoted[++i]) {
+        case 'b':
+            text.push_back('\b');
+            break;
+        case 'f':
+            text.push_back('\f');
+            break;
+        case 'n':
+            text.push_back('\n');
+            break;
+        case 'r':
+            text.push_back('\r');
+            break;
+        case 't':
+            text.push_back('\t');
+            break;
+        case 'u': {
+            uint32_t code = hex4(quoted.substr(i + 1));
+            i += 4;
+            // a character outside of the basic plane is a surrogate pair
+            if (code >= 0xD800 && code < 0xDC00 && quoted.substr(i + 1, 2) == "\\u") {
+                const uint32_t low = hex4(quoted.substr(i + 3));
+                if (low >= 0xDC00 && low < 0xE000) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+            }
+            append_utf8(text, code);
+            break;
+        }
+        default:
+            text.push_back(escaped);
+        }
+    }
+    return text;
+}
+
+std::string json_escape(std::string_view text) {
+    static const char digits[] = "0123456789abcdef";
+    std::string quoted = "\"";
+    quoted.reserve(text.size() + 2);
+    for (const char c : text) {
+        switch (c) {
+        case '"':
+            quoted += "\\\"";
+            break;
+        case '\\':
+            quoted += "\\\\";
+            break;
+        case '\n':
+            quoted += "\\n";
+            break;
+        case '\r':
+            quoted += "\\r";
+            break;
+        case '\t':
+            quoted += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                quoted += "\\u00";
+                quoted.push_back(digits[c >> 4]);
+                quoted.push_back(digits[c & 15]);
+            } else {
+                quoted.push_back(c);
+            }
+        }
+    }
+    quoted.push_back('"');
+    return quoted;
+}
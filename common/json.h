@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Scanners for the few members of the LSP messages the server and the filesystem look
+// at, the messages are passed on as they are and not parsed as a whole. The json_member,
+// json_string and json_value scanners match the key in any case, the first member with
+// it is found wherever it is nested. The json_at scanners follow the nesting.
+
+// The start of the value of the first member named key after from, null when there is none.
+const char *json_member(const std::string &data, const char *key, const char *from);
+// The string value of the first member named key, e.g. "key": "value", without the quotes.
+std::optional<std::string_view> json_string(const std::string &data, const char *key);
+// The JSON text of the value of the first member named key, a string with its quotes,
+// a number, an object, ...
+std::optional<std::string_view> json_value(const std::string &data, const char *key);
+// The JSON text of the value found by following the member names from the top object,
+// e.g. {"params", "textDocument", "uri"}, null when a member is missing or not an object.
+// Only the members of the objects on the path are looked at, the others are skipped.
+std::optional<std::string_view> json_at(std::string_view data, std::initializer_list<std::string_view> path);
+// The string at the path, without the quotes and not unescaped, null when it is not a string.
+std::optional<std::string_view> json_string_at(std::string_view data, std::initializer_list<std::string_view> path);
+// The JSON texts of the elements of an array, empty when it is not one.
+std::vector<std::string_view> json_elements(std::string_view array);
+// The text of a JSON string, with or without its quotes.
+std::string json_unescape(std::string_view quoted);
+// The JSON string of the text, with its quotes.
+std::string json_escape(std::string_view text);
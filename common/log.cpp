@@ -30,6 +30,9 @@ void raw_log(int level, const char *content) {
 }
 
 void log(int level, const char *fmt, ...) {
+    if (level == DEBUG && !debug_log) {
+        return;
+    }
     va_list args;
     va_start(args, fmt);
     char buffer[2 << 16];
@@ -39,6 +42,9 @@ void log(int level, const char *fmt, ...) {
 }
 
 void log(int level, int socket, const char *fmt, ...) {
+    if (level == DEBUG && !debug_log) {
+        return;
+    }
     va_list args;
     va_start(args, fmt);
     char buffer[2 << 16];
@@ -48,3 +54,5 @@ void log(int level, int socket, const char *fmt, ...) {
 }
 
 void set_debug_log(bool enable) { debug_log = enable; }
+
+bool debug_log_enabled() { return debug_log; }
@@ -11,4 +11,6 @@ const int NONE = 4;
 void log(int level, const char *fmt, ...);
 void log(int level, int socket, const char *fmt, ...);
 void set_debug_log(bool enable);
+// The arguments of debug messages which are expensive to format are only built when it is true.
+bool debug_log_enabled();
 void raw_log(int level, const char *content);
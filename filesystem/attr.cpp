@@ -0,0 +1,140 @@
+#include "attr.h"
+#include "../common/log.h"
+#include "tcp.h"
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+struct cached_attr {
+    GetAttrResponse attr;
+    std::chrono::steady_clock::time_point expires;
+};
+
+static const auto attr_ttl = std::chrono::seconds(2);
+static const size_t max_attrs = 1 << 16;
+// paths sent in one BATCH_STAT_REQUEST
+static const size_t batch_size = 4096;
+
+static std::map<std::string, cached_attr> attrs;
+// bumped by every invalidation, results of batches started before are not cached
+static uint64_t generation = 0;
+static std::mutex attrs_mutex;
+
+static std::deque<std::vector<std::string>> prefetch_queue;
+static std::mutex prefetch_mutex;
+// never destroyed, the prefetch thread waits on it when the process exits
+static std::condition_variable &prefetch_cv = *new std::condition_variable;
+static std::once_flag prefetch_started;
+
+static void store_attrs(const std::vector<std::string> &paths, size_t first, const BatchStatResponse &res, uint64_t started) {
+    std::lock_guard<std::mutex> lock(attrs_mutex);
+    if (generation != started) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (attrs.size() + res.results_size() > max_attrs) {
+        std::erase_if(attrs, [now](const auto &entry) { return entry.second.expires <= now; });
+        if (attrs.size() + res.results_size() > max_attrs) {
+            attrs.clear();
+        }
+    }
+    for (int i = 0; i < res.results_size() && first + i < paths.size(); i++) {
+        const auto &attr = res.results(i);
+        // other errors are returned to the caller but not worth remembering
+        if (attr.error() == 0 || attr.error() == ENOENT) {
+            attrs[paths[first + i]] = cached_attr{.attr = attr, .expires = now + attr_ttl};
+        }
+    }
+}
+
+int prefetch_attrs(int sock, gnutls_session_t ssl, const std::vector<std::string> &paths, BatchStatResponse *res) {
+    for (size_t first = 0; first < paths.size(); first += batch_size) {
+        BatchStatRequest req;
+        for (size_t i = first; i < paths.size() && i < first + batch_size; i++) {
+            req.add_paths(paths[i]);
+        }
+        uint64_t started;
+        {
+            std::lock_guard<std::mutex> lock(attrs_mutex);
+            started = generation;
+        }
+        BatchStatResponse batch;
+        int err = request_response<BatchStatResponse>(sock, ssl, req, &batch, BATCH_STAT_REQUEST);
+        if (err < 0) {
+            log(ERROR, sock, "Error sending message");
+            return -1;
+        }
+        if (batch.error() != 0) {
+            return -batch.error();
+        }
+        store_attrs(paths, first, batch, started);
+        if (res != nullptr) {
+            for (auto &attr : *batch.mutable_results()) {
+                *res->add_results() = std::move(attr);
+            }
+        }
+    }
+    return 0;
+}
+
+static void prefetch_thread(int sock, gnutls_session_t ssl) {
+    while (true) {
+        std::vector<std::string> paths;
+        {
+            std::unique_lock<std::mutex> lock(prefetch_mutex);
+            prefetch_cv.wait(lock, [] { return !prefetch_queue.empty(); });
+            paths = std::move(prefetch_queue.front());
+            prefetch_queue.pop_front();
+        }
+        prefetch_attrs(sock, ssl, paths, nullptr);
+    }
+}
+
+void prefetch_attrs_async(int sock, gnutls_session_t ssl, std::vector<std::string> paths) {
+    std::call_once(prefetch_started, [sock, ssl] { std::thread(prefetch_thread, sock, ssl).detach(); });
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex);
+        prefetch_queue.push_back(std::move(paths));
+    }
+    prefetch_cv.notify_one();
+}
+
+bool find_attr(const std::string &path, GetAttrResponse *res) {
+    std::lock_guard<std::mutex> lock(attrs_mutex);
+    const auto it = attrs.find(path);
+    if (it == attrs.end()) {
+        return false;
+    }
+    if (it->second.expires <= std::chrono::steady_clock::now()) {
+        attrs.erase(it);
+        return false;
+    }
+    *res = it->second.attr;
+    return true;
+}
+
+void store_attr(const std::string &path, const GetAttrResponse &attr) {
+    std::lock_guard<std::mutex> lock(attrs_mutex);
+    if (attrs.size() < max_attrs) {
+        attrs[path] = cached_attr{.attr = attr, .expires = std::chrono::steady_clock::now() + attr_ttl};
+    }
+}
+
+void invalidate_attr(const std::string &path) {
+    std::lock_guard<std::mutex> lock(attrs_mutex);
+    generation++;
+    if (attrs.empty()) {
+        return;
+    }
+    attrs.erase(path);
+    const auto prefix = path == "/" ? path : path + "/";
+    attrs.erase(attrs.lower_bound(prefix), attrs.lower_bound(prefix.substr(0, prefix.size() - 1) + static_cast<char>('/' + 1)));
+    const auto slash = path.find_last_of('/');
+    if (slash != std::string::npos) {
+        attrs.erase(slash == 0 ? "/" : path.substr(0, slash));
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../proto/messages.pb.h"
+#include <gnutls/gnutls.h>
+#include <string>
+#include <vector>
+
+// Attributes fetched with BATCH_STAT before the kernel asks for them. Like the
+// attribute cache of the kernel they are only kept for a short time, and they are
+// dropped as soon as this client changes the path.
+int prefetch_attrs(int sock, gnutls_session_t ssl, const std::vector<std::string> &paths, BatchStatResponse *res);
+// Same as prefetch_attrs but done by a background thread.
+void prefetch_attrs_async(int sock, gnutls_session_t ssl, std::vector<std::string> paths);
+bool find_attr(const std::string &path, GetAttrResponse *res);
+// Keeps the attributes returned with a change made by this client.
+void store_attr(const std::string &path, const GetAttrResponse &attr);
+// Drops the path, everything below it and its parent directory.
+void invalidate_attr(const std::string &path);
@@ -0,0 +1,284 @@
+#include "command.h"
+#include "../common/io.h"
+#include "../common/log.h"
+#include "attr.h"
+#include "google/protobuf/util/json_util.h"
+#include "lsp.h"
+#include "tcp.h"
+#include <cerrno>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+struct extension_request {
+    int ext_sock;
+    int ext_id;
+    // SEARCH_COMMAND or EXEC_COMMAND
+    int command_id;
+};
+
+// server request id -> extension waiting for the streamed results of a search or a command
+static std::map<int, extension_request> streams;
+static std::mutex streams_mutex;
+
+static std::string mount_point;
+
+static int reply(const int ext_sock, const int ext_id, const int command_id, const google::protobuf::Message &message) {
+    std::string json;
+    if (const auto status = google::protobuf::json::MessageToJsonString(message, &json); !status.ok()) {
+        log(ERROR, ext_sock, "Failed to serialize command response: %s", status.ToString().c_str());
+        return -1;
+    }
+    return write_extension(ext_sock, ext_id, command_id, json);
+}
+
+// Sends the request whose responses are streamed back to the extension until one is done.
+static int start_stream(const int ext_sock, const int sock, gnutls_session_t ssl, const int ext_id, const int command_id, const Type type,
+                        google::protobuf::Message &req) {
+    const int id = ++request_id;
+    {
+        std::lock_guard<std::mutex> lock(streams_mutex);
+        streams[id] = extension_request{.ext_sock = ext_sock, .ext_id = ext_id, .command_id = command_id};
+    }
+    if (send_message(sock, ssl, id, type, &req) < 0) {
+        std::lock_guard<std::mutex> lock(streams_mutex);
+        streams.erase(id);
+        return -1;
+    }
+    return 1;
+}
+
+// The extension knows the stream by the id of its own message, -1 when it is not running.
+static int find_stream(const int ext_sock, const int ext_id, const int command_id) {
+    std::lock_guard<std::mutex> lock(streams_mutex);
+    for (const auto &[id, stream] : streams) {
+        if (stream.ext_sock == ext_sock && stream.ext_id == ext_id && stream.command_id == command_id) {
+            return id;
+        }
+    }
+    return -1;
+}
+
+static int search_command(const int ext_sock, const int sock, gnutls_session_t ssl, const int ext_id, const char *payload) {
+    SearchRequest req;
+    if (const auto status = google::protobuf::json::JsonStringToMessage(payload, &req); !status.ok()) {
+        log(ERROR, ext_sock, "Invalid search request: %s", status.ToString().c_str());
+        SearchResponse res;
+        res.set_error(EINVAL);
+        res.set_done(true);
+        return reply(ext_sock, ext_id, SEARCH_COMMAND, res) < 0 ? -1 : 1;
+    }
+    return start_stream(ext_sock, sock, ssl, ext_id, SEARCH_COMMAND, Type::SEARCH_REQUEST, req);
+}
+
+static int search_cancel_command(const int ext_sock, const int sock, gnutls_session_t ssl, const int ext_id, const char *payload) {
+    SearchCancelRequest req;
+    SearchCancelResponse res;
+    if (const auto status = google::protobuf::json::JsonStringToMessage(payload, &req); !status.ok()) {
+        res.set_error(EINVAL);
+        return reply(ext_sock, ext_id, SEARCH_CANCEL_COMMAND, res) < 0 ? -1 : 1;
+    }
+
+    const int search_id = find_stream(ext_sock, req.search_id(), SEARCH_COMMAND);
+    if (search_id < 0) {
+        res.set_error(ESRCH);
+        return reply(ext_sock, ext_id, SEARCH_CANCEL_COMMAND, res) < 0 ? -1 : 1;
+    }
+
+    req.set_search_id(search_id);
+    if (request_response<SearchCancelResponse>(sock, ssl, req, &res, SEARCH_CANCEL_REQUEST) < 0) {
+        return -1;
+    }
+    return reply(ext_sock, ext_id, SEARCH_CANCEL_COMMAND, res) < 0 ? -1 : 1;
+}
+
+// Paths below the mount point, or relative to it, are turned into the paths of the file system.
+static std::optional<std::string> to_fs_path(const std::string &path) {
+    if (!path.starts_with('/')) {
+        return "/" + path;
+    }
+    if (mount_point.empty() || !path.starts_with(mount_point)) {
+        return std::nullopt;
+    }
+    if (path.size() == mount_point.size()) {
+        return "/";
+    }
+    if (path[mount_point.size()] != '/') {
+        return std::nullopt;
+    }
+    return path.substr(mount_point.size());
+}
+
+// Fills the metadata cache with the attributes of the paths and returns them to the extension.
+static int batch_stat_command(const int ext_sock, const int sock, gnutls_session_t ssl, const int ext_id, const char *payload) {
+    BatchStatRequest req;
+    BatchStatResponse res;
+    if (const auto status = google::protobuf::json::JsonStringToMessage(payload, &req); !status.ok()) {
+        res.set_error(EINVAL);
+        return reply(ext_sock, ext_id, BATCH_STAT_COMMAND, res) < 0 ? -1 : 1;
+    }
+
+    std::vector<std::string> paths;
+    std::vector<int> positions;
+    for (int i = 0; i < req.paths_size(); i++) {
+        if (const auto path = to_fs_path(req.paths(i)); path.has_value()) {
+            paths.push_back(path.value());
+            positions.push_back(i);
+        }
+    }
+    BatchStatResponse fetched;
+    if (const auto err = prefetch_attrs(sock, ssl, paths, &fetched); err != 0) {
+        if (err == -1) {
+            return -1;
+        }
+        res.set_error(-err);
+        return reply(ext_sock, ext_id, BATCH_STAT_COMMAND, res) < 0 ? -1 : 1;
+    }
+
+    // paths outside of the mount point are not on this file system
+    for (int i = 0; i < req.paths_size(); i++) {
+        res.add_results()->set_error(EXDEV);
+    }
+    for (size_t i = 0; i < positions.size() && static_cast<int>(i) < fetched.results_size(); i++) {
+        *res.mutable_results(positions[i]) = fetched.results(i);
+    }
+    return reply(ext_sock, ext_id, BATCH_STAT_COMMAND, res) < 0 ? -1 : 1;
+}
+
+// Runs a command on the server, its working directory is given as a path on the mount.
+static int exec_command(const int ext_sock, const int sock, gnutls_session_t ssl, const int ext_id, const char *payload) {
+    ExecRequest req;
+    ExecResponse res;
+    res.set_done(true);
+    if (const auto status = google::protobuf::json::JsonStringToMessage(payload, &req); !status.ok()) {
+        log(ERROR, ext_sock, "Invalid exec request: %s", status.ToString().c_str());
+        res.set_error(EINVAL);
+        return reply(ext_sock, ext_id, EXEC_COMMAND, res) < 0 ? -1 : 1;
+    }
+    const auto path = to_fs_path(req.path());
+    if (!path.has_value()) {
+        res.set_error(EXDEV);
+        return reply(ext_sock, ext_id, EXEC_COMMAND, res) < 0 ? -1 : 1;
+    }
+    req.set_path(path.value());
+    return start_stream(ext_sock, sock, ssl, ext_id, EXEC_COMMAND, Type::EXEC_REQUEST, req);
+}
+
+static int exec_cancel_command(const int ext_sock, const int sock, gnutls_session_t ssl, const int ext_id, const char *payload) {
+    ExecCancelRequest req;
+    ExecCancelResponse res;
+    if (const auto status = google::protobuf::json::JsonStringToMessage(payload, &req); !status.ok()) {
+        res.set_error(EINVAL);
+        return reply(ext_sock, ext_id, EXEC_CANCEL_COMMAND, res) < 0 ? -1 : 1;
+    }
+
+    const int exec_id = find_stream(ext_sock, req.exec_id(), EXEC_COMMAND);
+    if (exec_id < 0) {
+        res.set_error(ESRCH);
+        return reply(ext_sock, ext_id, EXEC_CANCEL_COMMAND, res) < 0 ? -1 : 1;
+    }
+
+    req.set_exec_id(exec_id);
+    if (request_response<ExecCancelResponse>(sock, ssl, req, &res, EXEC_CANCEL_REQUEST) < 0) {
+        return -1;
+    }
+    return reply(ext_sock, ext_id, EXEC_CANCEL_COMMAND, res) < 0 ? -1 : 1;
+}
+
+void set_mount_point(std::string path) {
+    while (path.size() > 1 && path.ends_with('/')) {
+        path.pop_back();
+    }
+    mount_point = path == "/" ? "" : path;
+}
+
+bool is_command(const int language_id) {
+    return language_id == SEARCH_COMMAND || language_id == SEARCH_CANCEL_COMMAND || language_id == BATCH_STAT_COMMAND || language_id == EXEC_COMMAND ||
+           language_id == EXEC_CANCEL_COMMAND;
+}
+
+int command_request_handler(const int ext_sock, const int sock, gnutls_session_t ssl, const int id, const int command_id, char *payload) {
+    switch (command_id) {
+    case SEARCH_COMMAND:
+        return search_command(ext_sock, sock, ssl, id, payload);
+    case SEARCH_CANCEL_COMMAND:
+        return search_cancel_command(ext_sock, sock, ssl, id, payload);
+    case BATCH_STAT_COMMAND:
+        return batch_stat_command(ext_sock, sock, ssl, id, payload);
+    case EXEC_COMMAND:
+        return exec_command(ext_sock, sock, ssl, id, payload);
+    case EXEC_CANCEL_COMMAND:
+        return exec_cancel_command(ext_sock, sock, ssl, id, payload);
+    default:
+        log(ERROR, ext_sock, "Unknown command id: %d", command_id);
+        return -1;
+    }
+}
+
+void close_commands(const int ext_sock, const int sock, gnutls_session_t ssl) {
+    std::lock_guard<std::mutex> lock(streams_mutex);
+    for (auto &[id, stream] : streams) {
+        if (stream.ext_sock != ext_sock) {
+            continue;
+        }
+        // the results still arrive until the server stops, they are dropped
+        stream.ext_sock = -1;
+        if (stream.command_id == EXEC_COMMAND) {
+            ExecCancelRequest req;
+            req.set_exec_id(id);
+            send_message(sock, ssl, ++request_id, Type::EXEC_CANCEL_REQUEST, &req);
+        } else {
+            SearchCancelRequest req;
+            req.set_search_id(id);
+            send_message(sock, ssl, ++request_id, Type::SEARCH_CANCEL_REQUEST, &req);
+        }
+    }
+}
+
+void abort_commands(const int error) {
+    std::lock_guard<std::mutex> lock(streams_mutex);
+    for (auto &[id, stream] : streams) {
+        if (stream.ext_sock < 0) {
+            continue;
+        }
+        if (stream.command_id == EXEC_COMMAND) {
+            ExecResponse res;
+            res.set_error(error);
+            res.set_done(true);
+            reply(stream.ext_sock, stream.ext_id, EXEC_COMMAND, res);
+        } else {
+            SearchResponse res;
+            res.set_error(error);
+            res.set_done(true);
+            reply(stream.ext_sock, stream.ext_id, SEARCH_COMMAND, res);
+        }
+    }
+    streams.clear();
+}
+
+template <typename T> static int forward_stream(int sock, int id, T *response) {
+    std::lock_guard<std::mutex> lock(streams_mutex);
+    const auto it = streams.find(id);
+    if (it == streams.end()) {
+        log(DEBUG, sock, "(%d) Streamed response without a request", id);
+        return 0;
+    }
+    if (it->second.ext_sock >= 0 && reply(it->second.ext_sock, it->second.ext_id, it->second.command_id, *response) < 0) {
+        it->second.ext_sock = -1;
+    }
+    if (response->done()) {
+        streams.erase(it);
+    }
+    return 0;
+}
+
+int search_response_handler(int sock, gnutls_session_t ssl, int id, SearchResponse *response) {
+    (void)ssl;
+    return forward_stream(sock, id, response);
+}
+
+int exec_response_handler(int sock, gnutls_session_t ssl, int id, ExecResponse *response) {
+    (void)ssl;
+    return forward_stream(sock, id, response);
+}
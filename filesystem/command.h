@@ -0,0 +1,26 @@
+#pragma once
+
+#include "../proto/messages.pb.h"
+#include <gnutls/gnutls.h>
+#include <string>
+
+// Extension messages with one of these ids in place of a language id are handled by
+// the file system itself, the payload is the JSON form of the matching request message.
+enum CommandId : int32_t {
+    SEARCH_COMMAND = 1000,
+    SEARCH_CANCEL_COMMAND = 1001,
+    BATCH_STAT_COMMAND = 1002,
+    EXEC_COMMAND = 1003,
+    EXEC_CANCEL_COMMAND = 1004,
+};
+
+void set_mount_point(std::string path);
+bool is_command(int language_id);
+int command_request_handler(int ext_sock, int sock, gnutls_session_t ssl, int id, int command_id, char *payload);
+// Stops the commands started by an extension connection which is closing.
+void close_commands(int ext_sock, int sock, gnutls_session_t ssl);
+// Ends the commands whose results were lost with the connection to the server.
+void abort_commands(int error);
+
+int search_response_handler(int sock, gnutls_session_t ssl, int id, SearchResponse *response);
+int exec_response_handler(int sock, gnutls_session_t ssl, int id, ExecResponse *response);
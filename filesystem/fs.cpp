@@ -1,29 +1,130 @@
 #include "fs.h"
 #include "../common/log.h"
 #include "../proto/messages.pb.h"
+#include "attr.h"
+#include "save.h"
+#include "session.h"
 #include "tcp.h"
 #include <cstring>
+#include <dirent.h>
 #include <fcntl.h>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sys/stat.h>
 #include <sys/xattr.h>
 #include <thread>
+#include <vector>
+#if __has_include(<linux/fuse.h>)
+#include <linux/fuse.h>
+#endif
+
+// the backing files were added to the kernel in 6.9 and to libfuse in 3.16
+#if defined(FUSE_CAP_PASSTHROUGH) && defined(FUSE_DEV_IOC_BACKING_OPEN)
+#define HAVE_PASSTHROUGH
+#include <atomic>
+#include <sys/ioctl.h>
+#endif
 
 int sock;
 gnutls_session_t ssl;
 config cfg;
 std::thread t;
 
+struct dir_page {
+    off_t offset;
+    std::shared_ptr<ReadDirResponse> res;
+};
+
+const int read_dir_size = 1 << 16;
+// attributes of the first entries of a listing are prefetched, most listings are followed by stats
+const int prefetch_entries = 1024;
+std::map<uint64_t, dir_page> dir_pages;
+std::mutex dir_pages_mutex;
+
+#ifdef HAVE_PASSTHROUGH
+// The server on the same host passes the descriptors of the opened files, the kernel then
+// reads and writes them itself and only the metadata goes through the server.
+static std::atomic<bool> passthrough = false;
+static int fuse_device = -1;
+// the backing files registered for the handles
+static std::map<uint64_t, uint32_t> backing_ids;
+static std::mutex backing_ids_mutex;
+
+// Registers the descriptor passed with the open response as the backing file of the handle.
+// libfuse offers it to the low level API only, so the ioctl of the fuse device is used.
+static void open_backing(const char *path, int server_fd, struct fuse_file_info *fi) {
+    int descriptor = take_backing_descriptor(server_fd);
+    if (descriptor < 0) {
+        return;
+    }
+    struct fuse_backing_map map = {.fd = descriptor, .flags = 0, .padding = 0};
+    int id = ioctl(fuse_device, FUSE_DEV_IOC_BACKING_OPEN, &map);
+    close(descriptor);
+    if (id <= 0) {
+        // the registration needs CAP_SYS_ADMIN, the data goes through the server otherwise
+        log(WARN, sock, "Passthrough disabled: %s", strerror(errno));
+        passthrough = false;
+        return;
+    }
+    fi->backing_id = id;
+    {
+        std::lock_guard<std::mutex> lock(backing_ids_mutex);
+        backing_ids[fi->fh] = id;
+    }
+    if ((fi->flags & O_ACCMODE) != O_RDONLY) {
+        // the writes do not pass the file system, the cached attributes would not change
+        invalidate_attr(path);
+    }
+}
+
+static void close_backing(const char *path, struct fuse_file_info *fi) {
+    uint32_t id;
+    {
+        std::lock_guard<std::mutex> lock(backing_ids_mutex);
+        auto it = backing_ids.find(fi->fh);
+        if (it == backing_ids.end()) {
+            return;
+        }
+        id = it->second;
+        backing_ids.erase(it);
+    }
+    if (ioctl(fuse_device, FUSE_DEV_IOC_BACKING_CLOSE, &id) < 0) {
+        log(ERROR, sock, "Error closing backing file %u: %s", id, strerror(errno));
+    }
+    if ((fi->flags & O_ACCMODE) != O_RDONLY) {
+        invalidate_attr(path);
+    }
+}
+#endif
+
 static void *init(struct fuse_conn_info *conn, struct fuse_config *f_cfg) {
-    (void)conn;
     (void)f_cfg;
+#ifdef HAVE_PASSTHROUGH
+    if (passes_descriptors() && (conn->capable & FUSE_CAP_PASSTHROUGH)) {
+        conn->want |= FUSE_CAP_PASSTHROUGH;
+        // the project may be on an overlay file system
+        conn->max_backing_stack_depth = 1;
+        fuse_device = fuse_session_fd(fuse_get_session(fuse_get_context()->fuse));
+        passthrough = true;
+    }
+#else
+    (void)conn;
+#endif
     t = std::thread(recv_thread, ssl, sock);
     InitRequest req = InitRequest();
     req.set_name(cfg.name);
+    req.set_export_name(cfg.export_name);
+    req.set_credits(requested_credits);
+    req.set_credit_bytes(requested_credit_bytes);
     InitResponse res;
     int err = request_response<InitResponse>(sock, ssl, req, &res, INIT_REQUEST);
     if (err < 0) {
         log(ERROR, sock, "Error sending message");
         return NULL;
+    } else if (res.error() == ENOENT) {
+        log(ERROR, sock, "The server has no export '%s'", cfg.export_name.c_str());
+        fuse_exit(fuse_get_context()->fuse);
     } else {
         log(INFO, sock, "The file system was initiated", res.error());
     }
@@ -32,22 +133,22 @@ static void *init(struct fuse_conn_info *conn, struct fuse_config *f_cfg) {
 
 static void destroy(void *private_data) {
     (void)private_data;
-    google::protobuf::ShutdownProtobufLibrary();
-    gnutls_bye(ssl, GNUTLS_SHUT_RDWR);
-    gnutls_deinit(ssl);
+    close_session();
     t.detach();
-    close(sock);
+    google::protobuf::ShutdownProtobufLibrary();
 };
 
 static int get_attr_request(const char *path, struct stat *stbuf, struct fuse_file_info *fi) {
     (void)fi;
-    GetAttrRequest req = GetAttrRequest();
-    req.set_path(path);
     GetAttrResponse res;
-    int err = request_response<GetAttrResponse>(sock, ssl, req, &res, GET_ATTR_REQUEST);
-    if (err < 0) {
-        log(ERROR, sock, "Error sending message");
-        return -ENONET;
+    if (!staged_attr(path, &res) && !find_attr(path, &res)) {
+        GetAttrRequest req = GetAttrRequest();
+        req.set_path(path);
+        int err = request_response<GetAttrResponse>(sock, ssl, req, &res, GET_ATTR_REQUEST);
+        if (err < 0) {
+            log(ERROR, sock, "Error sending message");
+            return -ENONET;
+        }
     }
     if (res.error() != 0) {
         return -res.error();
@@ -70,9 +171,17 @@ static int get_attr_request(const char *path, struct stat *stbuf, struct fuse_fi
 };
 
 static int open_fs(const char *path, struct fuse_file_info *fi) {
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     OpenRequest req = OpenRequest();
     req.set_path(path);
     req.set_flags(fi->flags);
+    req.set_token(open_token());
+#ifdef HAVE_PASSTHROUGH
+    req.set_passthrough(passthrough);
+#endif
     OpenResponse res;
     int err = request_response<OpenResponse>(sock, ssl, req, &res, OPEN_REQUEST);
     if (err < 0) {
@@ -81,16 +190,35 @@ static int open_fs(const char *path, struct fuse_file_info *fi) {
     } else {
         log(INFO, sock, "Try to open file: %d", res.error());
     }
-    fi->fh = res.fd();
+    if (fi->flags & O_TRUNC) {
+        invalidate_attr(path);
+    }
+    if (res.error() == 0) {
+        fi->fh = track_handle(res.fd(), path, fi->flags, false);
+#ifdef HAVE_PASSTHROUGH
+        if (res.passthrough()) {
+            open_backing(path, res.fd(), fi);
+        }
+#endif
+    }
     return -res.error();
 };
 
 static int release_fs(const char *path, struct fuse_file_info *fi) {
+#ifdef HAVE_PASSTHROUGH
+    close_backing(path, fi);
+#else
     (void)path;
+#endif
+    int fd = is_staged(fi->fh) ? release_staged(sock, ssl, fi->fh) : fi->fh;
+    if (fd < 0) {
+        return 0;
+    }
     ReleaseRequest req = ReleaseRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     ReleaseResponse res;
     int err = request_response<ReleaseResponse>(sock, ssl, req, &res, RELEASE_REQUEST);
+    untrack_handle(fd, false);
     if (err < 0) {
         log(ERROR, sock, "Error sending message");
         return -1;
@@ -100,30 +228,114 @@ static int release_fs(const char *path, struct fuse_file_info *fi) {
     return -res.error();
 };
 
+// Returns the cached page of the directory which continues at offset, start is set to the first entry to return.
+static std::shared_ptr<ReadDirResponse> find_dir_page(uint64_t fh, off_t offset, int *start) {
+    std::lock_guard<std::mutex> lock(dir_pages_mutex);
+    auto page = dir_pages.find(fh);
+    if (page == dir_pages.end()) {
+        return nullptr;
+    }
+    if (offset == 0) {
+        // the listing starts again after a rewinddir, it shows the entries added since
+        dir_pages.erase(page);
+        return nullptr;
+    }
+    if (page->second.offset == offset) {
+        *start = 0;
+        return page->second.res;
+    }
+    const auto &entries = page->second.res->entries();
+    for (int i = 0; i < entries.size(); i++) {
+        if (entries[i].offset() == offset) {
+            if (i + 1 == entries.size() && !page->second.res->eof()) {
+                // the kernel took the whole page, the next one comes from the server
+                return nullptr;
+            }
+            *start = i + 1;
+            return page->second.res;
+        }
+    }
+    return nullptr;
+}
+
+// The kernel asks for a few kilobytes of entries at a time, so the server is asked for a
+// bigger page which is kept until the kernel moves past it.
+static void prefetch_entries_attrs(const char *path, const ReadDirResponse &page) {
+    std::string dir = path;
+    if (!dir.ends_with('/')) {
+        dir += '/';
+    }
+    std::vector<std::string> paths;
+    for (const auto &entry : page.entries()) {
+        if (static_cast<int>(paths.size()) == prefetch_entries) {
+            break;
+        }
+        if (entry.name() != "." && entry.name() != "..") {
+            paths.push_back(dir + entry.name());
+        }
+    }
+    if (!paths.empty()) {
+        prefetch_attrs_async(sock, ssl, std::move(paths));
+    }
+}
+
 static int readdir_fs(const char *path, void *buf, fuse_fill_dir_t filler, off_t offset, struct fuse_file_info *fi, enum fuse_readdir_flags flags) {
-    (void)path;
     (void)flags;
-    (void)offset;
-    ReadDirRequest req = ReadDirRequest();
-    req.set_directory_descriptor(fi->fh);
-    ReadDirResponse res;
-    int err = request_response<ReadDirResponse>(sock, ssl, req, &res, READ_DIR_REQUEST);
-    if (err < 0) {
-        log(ERROR, sock, "Error sending message");
-        return -1;
-    } else {
-        log(INFO, sock, "Try to read directory: %d", res.error());
-    }
-    for (int i = 0; i < res.names_size(); i++) {
-        filler(buf, res.names(i).c_str(), NULL, 0, FUSE_FILL_DIR_PLUS);
+    while (true) {
+        int start = 0;
+        std::shared_ptr<ReadDirResponse> page = find_dir_page(fi->fh, offset, &start);
+        if (page == nullptr) {
+            ReadDirRequest req = ReadDirRequest();
+            req.set_directory_descriptor(fi->fh);
+            req.set_offset(offset);
+            req.set_size(read_dir_size);
+            page = std::make_shared<ReadDirResponse>();
+            int err = request_response<ReadDirResponse>(sock, ssl, req, page.get(), READ_DIR_REQUEST);
+            if (err < 0) {
+                log(ERROR, sock, "Error sending message");
+                return -1;
+            } else {
+                log(INFO, sock, "Try to read directory: %d", page->error());
+            }
+            if (page->error() != 0) {
+                return -page->error();
+            }
+            if (offset == 0 && path != nullptr) {
+                prefetch_entries_attrs(path, *page);
+            }
+            std::lock_guard<std::mutex> lock(dir_pages_mutex);
+            dir_pages[fi->fh] = dir_page{.offset = offset, .res = page};
+        }
+        for (int i = start; i < page->entries_size(); i++) {
+            const DirEntry &entry = page->entries(i);
+            struct stat st;
+            memset(&st, 0, sizeof(struct stat));
+            st.st_mode = DTTOIF(entry.type());
+            if (filler(buf, entry.name().c_str(), &st, entry.offset(), static_cast<fuse_fill_dir_flags>(0)) != 0) {
+                return 0;
+            }
+            offset = entry.offset();
+        }
+        if (page->eof() || page->entries_size() == 0) {
+            return 0;
+        }
     }
-    return 0;
 };
 
 static int read_fs(const char *path, char *buf, size_t size, off_t offset, struct fuse_file_info *fi) {
     (void)path;
+    if (is_staged(fi->fh)) {
+        int n = staged_read(fi->fh, buf, size, offset);
+        if (n != -EAGAIN) {
+            return n;
+        }
+    }
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     ReadRequest req = ReadRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     req.set_size(size);
     req.set_offset(offset);
     ReadResponse res;
@@ -142,9 +354,18 @@ static int read_fs(const char *path, char *buf, size_t size, off_t offset, struc
 };
 
 static int write_fs(const char *path, const char *buf, size_t size, off_t offset, struct fuse_file_info *fi) {
-    (void)path;
+    if (is_staged(fi->fh)) {
+        int n = staged_write(fi->fh, buf, size, offset);
+        if (n != -EAGAIN) {
+            return n;
+        }
+    }
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     WriteRequest req = WriteRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     req.set_offset(offset);
     req.set_data(buf, size);
     WriteResponse res;
@@ -155,6 +376,7 @@ static int write_fs(const char *path, const char *buf, size_t size, off_t offset
     } else {
         log(INFO, sock, "Try to write file: %d", res.error());
     }
+    invalidate_attr(path);
     if (res.error() != 0) {
         return -res.error();
     }
@@ -165,6 +387,10 @@ static int write_fs(const char *path, const char *buf, size_t size, off_t offset
 };
 
 static int create_fs(const char *path, mode_t mode, struct fuse_file_info *fi) {
+    int staged = 0;
+    if (stage_file(sock, ssl, path, mode, fi->flags, &fi->fh, &staged)) {
+        return staged;
+    }
     CreateRequest req = CreateRequest();
     req.set_path(path);
     req.set_mode(mode);
@@ -176,7 +402,10 @@ static int create_fs(const char *path, mode_t mode, struct fuse_file_info *fi) {
     } else {
         log(INFO, sock, "Try to create file: %d", res.error());
     }
-    fi->fh = res.fd();
+    invalidate_attr(path);
+    if (res.error() == 0) {
+        fi->fh = track_handle(res.fd(), path, O_WRONLY, false);
+    }
     return -res.error();
 };
 
@@ -192,10 +421,12 @@ static int mkdir_fs(const char *path, mode_t mode) {
     } else {
         log(INFO, sock, "Try to create directory: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 };
 
 static int unlink_fs(const char *path) {
+    drop_staged(path);
     UnlinkRequest req = UnlinkRequest();
     req.set_path(path);
     UnlinkResponse res;
@@ -206,6 +437,7 @@ static int unlink_fs(const char *path) {
     } else {
         log(INFO, sock, "Try to unlink: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 }
 
@@ -220,10 +452,23 @@ static int rmdir_fs(const char *path) {
     } else {
         log(INFO, sock, "Try to remove directory: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 }
 
 static int rename_fs(const char *old_path, const char *new_path, unsigned int flags) {
+    int staged = 0;
+    if (flags == 0 && save_staged(sock, ssl, old_path, new_path, &staged)) {
+        return staged;
+    }
+    // the other renames of a staged file, or over one, need it on the server
+    staged = commit_staged(sock, ssl, old_path);
+    if (staged == 0) {
+        staged = commit_staged(sock, ssl, new_path);
+    }
+    if (staged < 0) {
+        return staged;
+    }
     RenameRequest req = RenameRequest();
     req.set_old_path(old_path);
     req.set_new_path(new_path);
@@ -236,6 +481,8 @@ static int rename_fs(const char *old_path, const char *new_path, unsigned int fl
     } else {
         log(INFO, sock, "Try to rename: %d", res.error());
     }
+    invalidate_attr(old_path);
+    invalidate_attr(new_path);
     return -res.error();
 }
 
@@ -250,6 +497,9 @@ static int chown(const char *path, uid_t uid, gid_t gid, struct fuse_file_info *
 
 static int chmod(const char *path, mode_t mode, struct fuse_file_info *fi) {
     (void)fi;
+    if (staged_chmod(path, mode)) {
+        return 0;
+    }
     ChmodRequest req = ChmodRequest();
     req.set_path(path);
     req.set_mode(mode);
@@ -262,11 +512,19 @@ static int chmod(const char *path, mode_t mode, struct fuse_file_info *fi) {
         log(INFO, sock, "Try to change mode: %d", res.error());
     }
     log(DEBUG, sock, "Change mode: %d", res.error());
+    invalidate_attr(path);
     return -res.error();
 }
 
 static int truncate_fs(const char *path, off_t size, struct fuse_file_info *fi) {
     (void)fi;
+    if (staged_truncate(path, size)) {
+        return 0;
+    }
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     TruncateRequest req = TruncateRequest();
     req.set_path(path);
     req.set_size(size);
@@ -278,6 +536,7 @@ static int truncate_fs(const char *path, off_t size, struct fuse_file_info *fi)
     } else {
         log(INFO, sock, "Try to truncate: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 }
 
@@ -294,10 +553,15 @@ static int mknod_fs(const char *path, mode_t mode, dev_t dev) {
     } else {
         log(INFO, sock, "Try to create node: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 }
 
 static int link_fs(const char *old_path, const char *new_path) {
+    int staged = commit_staged(sock, ssl, old_path);
+    if (staged < 0) {
+        return staged;
+    }
     LinkRequest req = LinkRequest();
     req.set_old_path(old_path);
     req.set_new_path(new_path);
@@ -309,6 +573,8 @@ static int link_fs(const char *old_path, const char *new_path) {
     } else {
         log(INFO, sock, "Try to link: %d", res.error());
     }
+    invalidate_attr(old_path);
+    invalidate_attr(new_path);
     return -res.error();
 }
 
@@ -329,6 +595,7 @@ static int symlink_fs(const char *old_path, const char *new_path) {
     } else {
         log(INFO, sock, "Try to symlink: %d", res.error());
     }
+    invalidate_attr(new_path);
     return -res.error();
 }
 
@@ -378,15 +645,30 @@ static int statfs(const char *path, struct statvfs *stbuf) {
 
 static int flush_fs(const char *path, struct fuse_file_info *fi) {
     (void)path;
-    (void)fi;
+    if (is_staged(fi->fh)) {
+        int err = flush_staged(sock, ssl, fi->fh, false);
+        if (err != -EAGAIN) {
+            return err;
+        }
+    }
     return 0;
 };
 
 static int fsync_fs(const char *path, int datasync, struct fuse_file_info *fi) {
-    (void)datasync;
     (void)path;
+    if (is_staged(fi->fh)) {
+        int err = flush_staged(sock, ssl, fi->fh, true);
+        if (err != -EAGAIN) {
+            return err;
+        }
+    }
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     FsyncRequest req = FsyncRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
+    req.set_datasync(datasync != 0);
     FsyncResponse res;
     int err = request_response<FsyncResponse>(sock, ssl, req, &res, FSYNC_REQUEST);
     if (err < 0) {
@@ -399,6 +681,10 @@ static int fsync_fs(const char *path, int datasync, struct fuse_file_info *fi) {
 };
 
 static int setxattr_fs(const char *path, const char *name, const char *value, size_t size, int flags) {
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     SetxattrRequest req = SetxattrRequest();
     req.set_path(path);
     req.set_name(name);
@@ -412,10 +698,15 @@ static int setxattr_fs(const char *path, const char *name, const char *value, si
     } else {
         log(INFO, sock, "Try to setxattr: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 };
 
 static int getxattr_fs(const char *path, const char *name, char *value, size_t size) {
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     GetxattrRequest req = GetxattrRequest();
     req.set_path(path);
     req.set_name(name);
@@ -438,6 +729,10 @@ static int getxattr_fs(const char *path, const char *name, char *value, size_t s
 };
 
 static int listxattr_fs(const char *path, char *list, size_t size) {
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     ListxattrRequest req = ListxattrRequest();
     req.set_path(path);
     ListxattrResponse res;
@@ -478,6 +773,10 @@ static int listxattr_fs(const char *path, char *list, size_t size) {
 };
 
 static int removexattr_fs(const char *path, const char *name) {
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     RemovexattrRequest req = RemovexattrRequest();
     req.set_path(path);
     req.set_name(name);
@@ -489,6 +788,7 @@ static int removexattr_fs(const char *path, const char *name) {
     } else {
         log(INFO, sock, "Try to removexattr: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 };
 
@@ -496,6 +796,7 @@ static int opendir_fs(const char *path, fuse_file_info *fi) {
     (void)fi;
     OpendirRequest req = OpendirRequest();
     req.set_path(path);
+    req.set_token(open_token());
     OpendirResponse res;
     int err = request_response<OpendirResponse>(sock, ssl, req, &res, OPENDIR_REQUEST);
     if (err < 0) {
@@ -504,12 +805,18 @@ static int opendir_fs(const char *path, fuse_file_info *fi) {
     } else {
         log(INFO, sock, "Try to opendir: %d", res.error());
     }
-    fi->fh = res.directory_descriptor();
+    if (res.error() == 0) {
+        fi->fh = track_handle(res.directory_descriptor(), path, O_RDONLY, true);
+    }
     return -res.error();
 };
 
 static int releasedir_fs(const char *path, struct fuse_file_info *fi) {
     (void)path;
+    {
+        std::lock_guard<std::mutex> lock(dir_pages_mutex);
+        dir_pages.erase(fi->fh);
+    }
     ReleasedirRequest req = ReleasedirRequest();
     if (path == NULL) {
         return 0;
@@ -517,6 +824,7 @@ static int releasedir_fs(const char *path, struct fuse_file_info *fi) {
     req.set_directory_descriptor(fi->fh);
     ReleasedirResponse res;
     int err = request_response<ReleasedirResponse>(sock, ssl, req, &res, RELEASEDIR_REQUEST);
+    untrack_handle(fi->fh, true);
     if (err < 0) {
         log(ERROR, sock, "Error sending message");
         return -1;
@@ -544,6 +852,10 @@ static int fsyncdir_fs(const char *path, int datasync, struct fuse_file_info *fi
 
 static int utimens_fs(const char *path, const struct timespec tv[2], struct fuse_file_info *fi) {
     (void)fi;
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     UtimensRequest req = UtimensRequest();
     req.set_path(path);
     req.set_atime(tv[0].tv_sec);
@@ -556,10 +868,15 @@ static int utimens_fs(const char *path, const struct timespec tv[2], struct fuse
     } else {
         log(INFO, sock, "Try to utimens: %d", res.error());
     }
+    invalidate_attr(path);
     return -res.error();
 };
 
 static int access_fs(const char *path, int mask) {
+    int staged = commit_staged(sock, ssl, path);
+    if (staged < 0) {
+        return staged;
+    }
     AccessRequest req = AccessRequest();
     req.set_path(path);
     req.set_mode(mask);
@@ -574,8 +891,12 @@ static int access_fs(const char *path, int mask) {
 
 static int lock_fs(const char *path, struct fuse_file_info *fi, int cmd, struct flock *lock) {
     (void)path;
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     LockRequest req = LockRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     req.set_cmd(cmd);
     Lock *req_lock = req.mutable_lock();
     req_lock->set_l_type(lock->l_type);
@@ -617,8 +938,12 @@ static int ioctl_fs(const char *path, int cmd, void *arg, struct fuse_file_info
 
 static int flock_fs(const char *path, struct fuse_file_info *fi, int op) {
     (void)path;
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     FlockRequest req = FlockRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     req.set_op(op);
     FlockResponse res;
     int err = request_response<FlockResponse>(sock, ssl, req, &res, FLOCK_REQUEST);
@@ -630,9 +955,12 @@ static int flock_fs(const char *path, struct fuse_file_info *fi, int op) {
 };
 
 static int fallocate_fs(const char *path, int mode, off_t offset, off_t length, struct fuse_file_info *fi) {
-    (void)path;
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     FallocateRequest req = FallocateRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     req.set_mode(mode);
     req.set_offset(offset);
     req.set_len(length);
@@ -642,14 +970,48 @@ static int fallocate_fs(const char *path, int mode, off_t offset, off_t length,
         log(ERROR, sock, "Error sending message");
         return -1;
     }
+    invalidate_attr(path);
     return -res.error();
 };
 
+// The data is copied by the server and never sent over the network
+static ssize_t copy_file_range_fs(const char *path_in, struct fuse_file_info *fi_in, off_t offset_in, const char *path_out, struct fuse_file_info *fi_out,
+                                  off_t offset_out, size_t size, int flags) {
+    (void)path_in;
+    int fd_in = handle_fd(sock, ssl, fi_in->fh);
+    int fd_out = handle_fd(sock, ssl, fi_out->fh);
+    if (fd_in < 0 || fd_out < 0) {
+        return fd_in < 0 ? fd_in : fd_out;
+    }
+    CopyFileRangeRequest req = CopyFileRangeRequest();
+    req.set_fd_in(fd_in);
+    req.set_offset_in(offset_in);
+    req.set_fd_out(fd_out);
+    req.set_offset_out(offset_out);
+    req.set_size(size);
+    req.set_flags(flags);
+    CopyFileRangeResponse res;
+    int err = request_response<CopyFileRangeResponse>(sock, ssl, req, &res, COPY_FILE_RANGE_REQUEST);
+    if (err < 0) {
+        log(ERROR, sock, "Error sending message");
+        return -1;
+    }
+    invalidate_attr(path_out);
+    if (res.error() != 0) {
+        return -res.error();
+    }
+    return res.size();
+};
+
 // This is only for LSEEK_DATA and LSEEK_HOLE
 static off_t lseek_fs(const char *path, off_t offset, int whence, struct fuse_file_info *fi) {
     (void)path;
+    int fd = handle_fd(sock, ssl, fi->fh);
+    if (fd < 0) {
+        return fd;
+    }
     LseekRequest req = LseekRequest();
-    req.set_fd(fi->fh);
+    req.set_fd(fd);
     req.set_offset(offset);
     req.set_whence(whence);
     LseekResponse res;
@@ -708,6 +1070,7 @@ fuse_operations get_fuse_operations(int sock_fd, config cfg_param, gnutls_sessio
         .ioctl = ioctl_fs,
         .flock = flock_fs,
         .fallocate = fallocate_fs,
+        .copy_file_range = copy_file_range_fs,
         .lseek = lseek_fs,
     };
     return ops;
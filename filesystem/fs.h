@@ -5,6 +5,8 @@
 
 struct config {
     std::string name;
+    // the export of the server to mount, the default one when empty
+    std::string export_name;
 };
 
 fuse_operations get_fuse_operations(int sock, config cfg, gnutls_session_t ssl);
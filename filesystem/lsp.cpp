@@ -3,8 +3,102 @@
 
 #include "../common/header.h"
 #include "../common/io.h"
+#include "../common/json.h"
+#include <chrono>
+#include <condition_variable>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
 
-static int lsp_client_sock = -1;
+// A message to an extension is written whole before the next one, each socket has its lock.
+// The writer of a closing extension is marked closed, its socket number may be reused.
+struct extension_writer {
+    std::mutex mutex;
+    bool closed = false;
+};
+
+static std::mutex writers_mutex;
+static std::map<int, std::shared_ptr<extension_writer>> writers;
+
+// Several editor windows share the language servers of the mount. The ids of their requests
+// are replaced with ids unique over all of them, the responses go back to the window which
+// asked with its own id. A language server is initialized by the first window, the others
+// get its answer. The notifications of the servers go to all windows, the diagnostics to
+// the ones which have the document open.
+struct extension {
+    std::set<std::string> languages;
+    // the languages the window initialized with the answer of another one
+    std::set<std::string> joined;
+    std::set<std::pair<std::string, std::string>> documents;
+};
+
+struct language_session {
+    // the answer to the initialize request, empty until the server gave it
+    std::string capabilities;
+    bool initializing = false;
+    // the windows waiting for the capabilities, with the ids of their initialize requests
+    std::vector<std::pair<int, std::string>> waiting;
+    // gets the requests of the server
+    int last_extension = -1;
+    // the number of windows which have the document open
+    std::map<std::string, int> documents;
+};
+
+struct forwarded_request {
+    int ext_sock;
+    std::string id;
+    std::string language;
+    bool initialize;
+};
+
+// a message for an extension, sent once the locks are released
+struct extension_message {
+    int ext_sock;
+    std::string payload;
+};
+
+// The last text the servers got of the open documents, for the languages whose servers take
+// incremental changes. An editor sending the whole text with each change has it replaced with
+// the edit of the range which differs, the traffic follows the size of the edit.
+static std::mutex texts_mutex;
+static std::set<std::string> incremental_languages;
+static std::map<std::pair<std::string, std::string>, std::string> texts;
+
+static std::mutex sessions_mutex;
+static std::map<int, extension> extensions;
+static std::map<std::string, language_session> sessions;
+static std::map<int64_t, forwarded_request> forwarded;
+static std::map<std::pair<int, std::string>, int64_t> forwarded_ids;
+static int64_t next_request_id = 1;
+
+// consecutive didChange notifications of a document are sent as one after this delay
+static const auto coalesce_window = std::chrono::milliseconds(30);
+static const size_t max_coalesced_changes = 1 << 20;
+
+// The didChange notifications of one document waiting to be sent. The notification is sent
+// as the latest one (its version) with the changes of all of them, they are applied in order.
+struct pending_changes {
+    int sock = -1;
+    gnutls_session_t ssl = nullptr;
+    int id = 0;
+    std::string language;
+    std::string uri;
+    std::string last;
+    // the elements of the contentChanges arrays
+    std::string changes;
+    int count = 0;
+    std::chrono::steady_clock::time_point deadline;
+};
+
+static pending_changes pending;
+static std::mutex pending_mutex;
+// never destroyed, the flushing thread waits on it when the process exits
+static std::condition_variable &pending_cv = *new std::condition_variable;
+static std::once_flag flusher_started;
 
 static std::optional<int> find_by_language_name(const std::string_view language) {
     for (const auto &[name, id] : language_ids) {
@@ -39,40 +133,476 @@ static std::array<char, sizeof(LspHeader)> serialize_lsp(const LspHeader &header
     return buf;
 }
 
-void set_lsp_extension_socket(const int sock) {
-    if (lsp_client_sock > 0) {
-        log(INFO, "LSP client sock already initialized, overriding.");
+static int send_lsp_request(const int sock, gnutls_session_t ssl, const int id, const std::string &language, std::string payload) {
+    LspRequest req;
+    req.set_payload(std::move(payload));
+    req.set_language(language);
+
+    const auto n = send_message(sock, ssl, id, Type::LSP_REQUEST, &req);
+    return n < 0 ? -1 : n;
+}
+
+// Sends the pending changes, with pending_mutex held.
+static int flush_pending_changes() {
+    if (pending.count == 0) {
+        return 0;
+    }
+    auto message = std::move(pending.last);
+    if (const auto changes = json_at(message, {"params", "contentChanges"}); pending.count > 1 && changes.has_value()) {
+        message.replace(changes->data() - message.data(), changes->size(), "[" + pending.changes + "]");
+    }
+    log(DEBUG, pending.sock, "Sending %d changes of %s as one", pending.count, pending.uri.c_str());
+    pending.count = 0;
+    pending.changes.clear();
+    return send_lsp_request(pending.sock, pending.ssl, pending.id, pending.language, std::move(message));
+}
+
+static void flush_expired_changes() {
+    std::unique_lock<std::mutex> lock(pending_mutex);
+    while (true) {
+        if (pending.count == 0) {
+            pending_cv.wait(lock);
+        } else if (pending_cv.wait_until(lock, pending.deadline) == std::cv_status::timeout && pending.count > 0 &&
+                   std::chrono::steady_clock::now() >= pending.deadline) {
+            flush_pending_changes();
+        }
+    }
+}
+
+// Keeps a didChange notification to be sent with the next ones of the document, false
+// when it is not one which can be merged.
+static bool coalesce_change(const int sock, gnutls_session_t ssl, const int id, const std::string &language, const std::string &payload) {
+    if (json_string_at(payload, {"method"}) != "textDocument/didChange") {
+        return false;
+    }
+    const auto uri = json_string_at(payload, {"params", "textDocument", "uri"});
+    const auto changes = json_at(payload, {"params", "contentChanges"});
+    if (!uri.has_value() || !changes.has_value() || changes->size() < 2 || changes->front() != '[') {
+        return false;
+    }
+    if (pending.count > 0 && (pending.uri != *uri || pending.language != language)) {
+        flush_pending_changes();
+    }
+    auto elements = changes->substr(1, changes->size() - 2);
+    while (!elements.empty() && isspace(static_cast<unsigned char>(elements.front()))) {
+        elements.remove_prefix(1);
+    }
+    // the whole text replaces everything before it
+    if (changes->find("\"range\"") == std::string_view::npos) {
+        pending.changes.clear();
+    }
+    if (!pending.changes.empty() && !elements.empty()) {
+        pending.changes += ',';
+    }
+    pending.changes += elements;
+    if (pending.count == 0) {
+        pending.deadline = std::chrono::steady_clock::now() + coalesce_window;
+        pending.uri = *uri;
+        pending.language = language;
+    }
+    pending.sock = sock;
+    pending.ssl = ssl;
+    pending.id = id;
+    pending.last = payload;
+    pending.count++;
+    if (pending.changes.size() > max_coalesced_changes) {
+        flush_pending_changes();
+    }
+    pending_cv.notify_all();
+    return true;
+}
+
+struct text_position {
+    int line = 0;
+    // in UTF-16 code units
+    int character = 0;
+};
+
+// The positions of the offsets first <= second of the text, which do not split a character or a CRLF.
+static std::pair<text_position, text_position> positions(const std::string &text, const size_t first, const size_t second) {
+    text_position position, start;
+    for (size_t i = 0; i < second; i++) {
+        if (i == first) {
+            start = position;
+        }
+        const auto c = static_cast<unsigned char>(text[i]);
+        if (c == '\n' || (c == '\r' && (i + 1 == text.size() || text[i + 1] != '\n'))) {
+            position.line++;
+            position.character = 0;
+        } else if (c != '\r' && (c & 0xC0) != 0x80) {
+            // the characters outside of the basic plane are two code units
+            position.character += c >= 0xF0 ? 2 : 1;
+        }
     }
+    return {first == second ? position : start, position};
+}
 
-    lsp_client_sock = sock;
+static bool splits(const std::string &text, const size_t offset) {
+    if (offset == 0 || offset >= text.size()) {
+        return false;
+    }
+    return (static_cast<unsigned char>(text[offset]) & 0xC0) == 0x80 || (text[offset - 1] == '\r' && text[offset] == '\n');
 }
 
-int lsp_request_handler(const int sock, gnutls_session_t ssl, const int id, const int language_id, char *request) {
+static bool takes_incremental_changes(const std::string &capabilities) {
+    const auto sync = json_at(capabilities, {"capabilities", "textDocumentSync"});
+    if (!sync.has_value()) {
+        return false;
+    }
+    if (sync->front() == '{') {
+        return json_at(*sync, {"change"}) == "2";
+    }
+    return *sync == "2";
+}
+
+// Replaces a change with the whole text of the document by the edit of the range which differs.
+static void translate_full_change(const std::string &language, std::string &payload) {
+    const auto method = json_string_at(payload, {"method"});
+    const auto uri = json_string_at(payload, {"params", "textDocument", "uri"});
+    if (!method.has_value() || !uri.has_value() || !method->starts_with("textDocument/did")) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(texts_mutex);
+    if (!incremental_languages.contains(language)) {
+        return;
+    }
+    const std::pair<std::string, std::string> key(language, *uri);
+    if (*method == "textDocument/didOpen") {
+        texts[key] = json_unescape(json_at(payload, {"params", "textDocument", "text"}).value_or(""));
+        return;
+    }
+    if (*method == "textDocument/didClose") {
+        texts.erase(key);
+        return;
+    }
+    const auto changes = json_at(payload, {"params", "contentChanges"});
+    const auto document = json_at(payload, {"params", "textDocument"});
+    if (*method != "textDocument/didChange" || !changes.has_value() || !document.has_value() || changes->front() != '[') {
+        return;
+    }
+    // a single change without a range
+    const auto change = json_at(changes->substr(1), {});
+    const auto text = change.has_value() ? json_at(*change, {"text"}) : std::nullopt;
+    auto rest = changes->substr(change.has_value() ? change->data() + change->size() - changes->data() : 1);
+    while (!rest.empty() && isspace(static_cast<unsigned char>(rest.front()))) {
+        rest.remove_prefix(1);
+    }
+    auto it = texts.find(key);
+    // the ranges of the editor are not applied here, the text is known again with the next full change
+    if (!text.has_value() || json_at(*change, {"range"}).has_value() || rest != "]") {
+        if (it != texts.end()) {
+            texts.erase(it);
+        }
+        return;
+    }
+    auto updated = json_unescape(*text);
+    if (it == texts.end()) {
+        texts[key] = std::move(updated);
+        return;
+    }
+    const auto &old = it->second;
+    size_t prefix = 0;
+    const size_t common = std::min(old.size(), updated.size());
+    while (prefix < common && old[prefix] == updated[prefix]) {
+        prefix++;
+    }
+    while (splits(old, prefix) || splits(updated, prefix)) {
+        prefix--;
+    }
+    size_t suffix = 0;
+    while (suffix < common - prefix && old[old.size() - suffix - 1] == updated[updated.size() - suffix - 1]) {
+        suffix++;
+    }
+    while (suffix > 0 && (splits(old, old.size() - suffix) || splits(updated, updated.size() - suffix))) {
+        suffix--;
+    }
+    const auto [start, end] = positions(old, prefix, old.size() - suffix);
+    const auto position = [](const text_position &p) { return R"({"line":)" + std::to_string(p.line) + R"(,"character":)" + std::to_string(p.character) + "}"; };
+    payload = R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":)" + std::string(*document) +
+              R"(,"contentChanges":[{"range":{"start":)" + position(start) + R"(,"end":)" + position(end) +
+              R"(},"text":)" + json_escape(std::string_view(updated).substr(prefix, updated.size() - suffix - prefix)) + "}]}}";
+    it->second = std::move(updated);
+}
+
+static int forward(const int sock, gnutls_session_t ssl, const int id, const std::string &language, std::string payload) {
+    translate_full_change(language, payload);
+    std::call_once(flusher_started, [] { std::thread(flush_expired_changes).detach(); });
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    if (coalesce_change(sock, ssl, id, language, payload)) {
+        return payload.size();
+    }
+    // the other messages may depend on the changes, they are sent before them
+    if (flush_pending_changes() < 0) {
+        return -1;
+    }
+    return send_lsp_request(sock, ssl, id, language, std::move(payload));
+}
+
+static std::string response_to(std::string_view id, std::string_view result) {
+    return R"({"jsonrpc":"2.0","id":)" + std::string(id) + R"(,"result":)" + std::string(result) + "}";
+}
+
+static void replace_value(std::string &payload, std::string_view value, const std::string &with) { payload.replace(value.data() - payload.data(), value.size(), with); }
+
+// Gives the request an id unique over the windows, with sessions_mutex held.
+static void rewrite_request_id(const int ext_sock, const std::string &language, std::string &payload, std::string_view id, bool initialize) {
+    const auto unique_id = next_request_id++;
+    forwarded[unique_id] = forwarded_request{.ext_sock = ext_sock, .id = std::string(id), .language = language, .initialize = initialize};
+    forwarded_ids[{ext_sock, std::string(id)}] = unique_id;
+    replace_value(payload, id, std::to_string(unique_id));
+}
+
+// False when the message is answered here or not needed by the server, with sessions_mutex held.
+static bool multiplex_request(const int ext_sock, const std::string &language, std::string &payload, std::vector<extension_message> &replies) {
+    auto &session = sessions[language];
+    auto &ext = extensions[ext_sock];
+    ext.languages.insert(language);
+    session.last_extension = ext_sock;
+    // the members of the message itself, the params may have others of the same names
+    const auto method = json_string_at(payload, {"method"});
+    const auto id = json_at(payload, {"id"});
+    if (!method.has_value()) {
+        // the answer of the window to a request of the server keeps its id
+        return true;
+    }
+    const bool shared = std::any_of(extensions.begin(), extensions.end(), [&](const auto &other) { return other.first != ext_sock && other.second.languages.contains(language); });
+    if (*method == "initialize" && id.has_value()) {
+        if (!session.capabilities.empty()) {
+            ext.joined.insert(language);
+            replies.push_back(extension_message{.ext_sock = ext_sock, .payload = response_to(*id, session.capabilities)});
+            return false;
+        }
+        if (session.initializing) {
+            ext.joined.insert(language);
+            session.waiting.emplace_back(ext_sock, std::string(*id));
+            return false;
+        }
+        session.initializing = true;
+        rewrite_request_id(ext_sock, language, payload, *id, true);
+        return true;
+    }
+    if (*method == "initialized") {
+        return !ext.joined.contains(language);
+    }
+    if ((*method == "shutdown" || *method == "exit") && shared) {
+        // the other windows still use the server
+        if (id.has_value()) {
+            replies.push_back(extension_message{.ext_sock = ext_sock, .payload = response_to(*id, "null")});
+        }
+        return false;
+    }
+    if (*method == "shutdown") {
+        session.capabilities.clear();
+        session.initializing = false;
+    }
+    const auto uri = json_string_at(payload, {"params", "textDocument", "uri"});
+    if (*method == "textDocument/didOpen" && uri.has_value()) {
+        const std::string document(*uri);
+        if (!ext.documents.emplace(language, document).second) {
+            return true;
+        }
+        return session.documents[document]++ == 0;
+    }
+    if (*method == "textDocument/didClose" && uri.has_value()) {
+        const std::string document(*uri);
+        if (ext.documents.erase({language, document}) == 0) {
+            return true;
+        }
+        if (--session.documents[document] > 0) {
+            return false;
+        }
+        session.documents.erase(document);
+        return true;
+    }
+    if (const auto cancelled = json_at(payload, {"params", "id"}); *method == "$/cancelRequest" && cancelled.has_value()) {
+        // the id in the params is the one of the window
+        const auto it = forwarded_ids.find({ext_sock, std::string(*cancelled)});
+        if (it == forwarded_ids.end()) {
+            return false;
+        }
+        replace_value(payload, *cancelled, std::to_string(it->second));
+        return true;
+    }
+    if (id.has_value()) {
+        rewrite_request_id(ext_sock, language, payload, *id, false);
+    }
+    return true;
+}
+
+static void reply_extensions(const int language_id, const int id, const std::vector<extension_message> &messages) {
+    for (const auto &message : messages) {
+        write_extension(message.ext_sock, id, language_id, message.payload);
+    }
+}
+
+int lsp_request_handler(const int ext_sock, const int sock, gnutls_session_t ssl, const int id, const int language_id, char *request) {
     const auto language_name = find_by_language_id(language_id);
     if (!language_name.has_value()) {
         log(ERROR, sock, "Unknown language id: %d", language_id);
         return -1;
     };
 
-    LspRequest req;
-    req.set_payload(request);
-    req.set_language(language_name.value());
+    std::string payload(request);
+    std::vector<extension_message> replies;
+    bool needed;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        needed = multiplex_request(ext_sock, language_name.value(), payload, replies);
+    }
+    reply_extensions(language_id, id + 1, replies);
+    if (!needed) {
+        return 1;
+    }
+    return forward(sock, ssl, id, language_name.value(), std::move(payload));
+}
 
-    const auto n = send_message(sock, ssl, id, Type::LSP_REQUEST, &req);
-    return n < 0 ? -1 : n;
+void flush_lsp_changes() {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    flush_pending_changes();
 }
 
-int lsp_response_handler(int sock, gnutls_session_t ssl, int id, LspResponse *response) {
-    if (lsp_client_sock < 0) {
-        log(INFO, sock, "LSP client sock not initialized, aborting.");
-        return 1;
+void open_lsp_extension(const int ext_sock) {
+    std::lock_guard<std::mutex> lock(writers_mutex);
+    writers[ext_sock] = std::make_shared<extension_writer>();
+}
+
+void close_lsp_extension(const int ext_sock, const int sock, gnutls_session_t ssl) {
+    std::shared_ptr<extension_writer> writer;
+    {
+        std::lock_guard<std::mutex> lock(writers_mutex);
+        if (const auto it = writers.find(ext_sock); it != writers.end()) {
+            writer = std::move(it->second);
+            writers.erase(it);
+        }
+    }
+    if (writer != nullptr) {
+        // waits for a write in progress, the socket is closed after this
+        std::lock_guard<std::mutex> lock(writer->mutex);
+        writer->closed = true;
+    }
+    std::vector<std::pair<std::string, std::string>> closed;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        const auto it = extensions.find(ext_sock);
+        if (it == extensions.end()) {
+            return;
+        }
+        // the server keeps the documents open for the other windows only
+        for (const auto &[language, document] : it->second.documents) {
+            auto &session = sessions[language];
+            if (--session.documents[document] == 0) {
+                session.documents.erase(document);
+                closed.emplace_back(language, document);
+            }
+        }
+        extensions.erase(it);
+        for (auto &[language, session] : sessions) {
+            std::erase_if(session.waiting, [ext_sock](const auto &waiting) { return waiting.first == ext_sock; });
+            if (session.last_extension != ext_sock) {
+                continue;
+            }
+            session.last_extension = -1;
+            for (const auto &[other, ext] : extensions) {
+                if (ext.languages.contains(language)) {
+                    session.last_extension = other;
+                }
+            }
+        }
+        std::erase_if(forwarded, [ext_sock](const auto &request) { return request.second.ext_sock == ext_sock; });
+        std::erase_if(forwarded_ids, [ext_sock](const auto &request) { return request.first.first == ext_sock; });
+    }
+    for (const auto &[language, document] : closed) {
+        forward(sock, ssl, 0, language, R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{"textDocument":{"uri":")" + document + R"("}}})");
+    }
+    flush_lsp_changes();
+}
+
+// Finds the windows a message of the server goes to, with sessions_mutex held.
+static void route_response(const std::string &language, std::string payload, std::vector<extension_message> &messages) {
+    auto &session = sessions[language];
+    const auto method = json_string_at(payload, {"method"});
+    const auto id = json_at(payload, {"id"});
+    if (!method.has_value() && id.has_value()) {
+        const auto it = forwarded.find(strtoll(std::string(*id).c_str(), nullptr, 10));
+        if (it == forwarded.end()) {
+            log(DEBUG, "Dropped the response %.*s of the LSP for %s", static_cast<int>(id->size()), id->data(), language.c_str());
+            return;
+        }
+        const auto request = std::move(it->second);
+        forwarded.erase(it);
+        forwarded_ids.erase({request.ext_sock, request.id});
+        if (request.initialize) {
+            session.initializing = false;
+            session.capabilities = json_at(payload, {"result"}).value_or("");
+            if (takes_incremental_changes(session.capabilities)) {
+                std::lock_guard<std::mutex> lock(texts_mutex);
+                incremental_languages.insert(language);
+            }
+            for (const auto &[ext_sock, waiting_id] : session.waiting) {
+                messages.push_back(extension_message{.ext_sock = ext_sock, .payload = response_to(waiting_id, session.capabilities.empty() ? "null" : session.capabilities)});
+            }
+            session.waiting.clear();
+        }
+        replace_value(payload, *id, request.id);
+        messages.push_back(extension_message{.ext_sock = request.ext_sock, .payload = std::move(payload)});
+        return;
+    }
+    if (method.has_value() && id.has_value()) {
+        // a request of the server is answered by one window
+        if (session.last_extension >= 0) {
+            messages.push_back(extension_message{.ext_sock = session.last_extension, .payload = std::move(payload)});
+        }
+        return;
+    }
+    std::vector<int> targets;
+    if (const auto uri = json_string_at(payload, {"params", "uri"}); method == "textDocument/publishDiagnostics" && uri.has_value()) {
+        const std::pair<std::string, std::string> document(language, *uri);
+        for (const auto &[ext_sock, ext] : extensions) {
+            if (ext.documents.contains(document)) {
+                targets.push_back(ext_sock);
+            }
+        }
+    }
+    if (targets.empty()) {
+        for (const auto &[ext_sock, ext] : extensions) {
+            if (ext.languages.contains(language)) {
+                targets.push_back(ext_sock);
+            }
+        }
+    }
+    for (const int ext_sock : targets) {
+        messages.push_back(extension_message{.ext_sock = ext_sock, .payload = payload});
     }
+}
 
-    const auto &payload = response->payload();
+int lsp_response_handler(int sock, gnutls_session_t ssl, int id, LspResponse *response) {
+    (void)ssl;
     const auto language_id = find_by_language_name(response->language());
-    assert(language_id.has_value());
+    if (!language_id.has_value()) {
+        log(ERROR, sock, "Response of the LSP for an unknown language %s", response->language().c_str());
+        return 1;
+    }
+    std::vector<extension_message> messages;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        route_response(response->language(), std::move(*response->mutable_payload()), messages);
+    }
+    reply_extensions(language_id.value(), id + 1, messages);
+    return 0;
+}
 
-    const auto header = LspHeader{.size = static_cast<int32_t>(payload.size()), .id = ++id, .language_id = language_id.value()};
+int write_extension(const int ext_sock, const int id, const int language_id, const std::string &payload) {
+    std::shared_ptr<extension_writer> writer;
+    {
+        std::lock_guard<std::mutex> lock(writers_mutex);
+        const auto it = writers.find(ext_sock);
+        if (it == writers.end()) {
+            log(DEBUG, ext_sock, "Dropped a message for a closed extension");
+            return -1;
+        }
+        writer = it->second;
+    }
+    const auto header = LspHeader{.size = static_cast<int32_t>(payload.size()), .id = id, .language_id = language_id};
     const auto serialized_header = serialize_lsp(header);
 
     const auto buffer_size = HEADER_SIZE + payload.size();
@@ -81,11 +611,20 @@ int lsp_response_handler(int sock, gnutls_session_t ssl, int id, LspResponse *re
     std::memcpy(write_buffer.get(), serialized_header.data(), HEADER_SIZE);
     std::memcpy(write_buffer.get() + HEADER_SIZE, payload.c_str(), payload.size());
 
-    auto n = 0;
-    if (n = write(lsp_client_sock, write_buffer.get(), buffer_size); n < 0) {
-        log(ERROR, lsp_client_sock, "Failed to write to lsp extension socket, error: %s", std::strerror(errno));
+    std::lock_guard<std::mutex> lock(writer->mutex);
+    if (writer->closed) {
         return -1;
     }
-
-    return n;
+    for (size_t written = 0; written < buffer_size;) {
+        const auto n = send(ext_sock, write_buffer.get() + written, buffer_size - written, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            log(ERROR, ext_sock, "Failed to write to lsp extension socket, error: %s", std::strerror(errno));
+            return -1;
+        }
+        written += n;
+    }
+    return buffer_size;
 }
@@ -3,9 +3,19 @@
 #include "../proto/messages.pb.h"
 #include <gnutls/gnutls.h>
 
-int lsp_request_handler(int socket, gnutls_session_t ssl, int id, int language_id, char *request);
+// Consecutive didChange notifications of a document are merged for a moment, the other
+// messages send them first.
+// Any number of extensions (editor windows) share the language servers, see lsp.cpp.
+int lsp_request_handler(int ext_sock, int socket, gnutls_session_t ssl, int id, int language_id, char *request);
+// Sends the merged notifications right away.
+void flush_lsp_changes();
+// Registers the socket of a new extension, the messages to it are written from then on.
+void open_lsp_extension(int ext_sock);
+// Stops writing to the extension, closes the documents only it had open and forgets its requests.
+void close_lsp_extension(int ext_sock, int sock, gnutls_session_t ssl);
 int lsp_response_handler(int sock, gnutls_session_t ssl, int id, LspResponse *response);
-void set_lsp_extension_socket(int sock);
+// Writes the message whole, -1 when the extension is closed or the write fails.
+int write_extension(int ext_sock, int id, int language_id, const std::string &payload);
 
 static std::vector<std::pair<std::string, int>> language_ids = {{"c", 10}, {"cpp", 11}, {"latex", 300}};
 
@@ -1,9 +1,12 @@
 #include "../common/log.h"
+#include "command.h"
 #include "fs.h"
 #include "log.h"
+#include "session.h"
 #include "tcp.h"
 #include <fuse3/fuse.h>
 #include <fuse3/fuse_log.h>
+#include <fuse3/fuse_lowlevel.h>
 #include <gnutls/gnutls.h>
 #include <string>
 #include <thread>
@@ -25,23 +28,26 @@ static struct options {
     const char *cert;
     const char *key;
     const char *srvcert;
+    const char *export_name;
 } opts;
 
 #define OPTION(t, p) {t, offsetof(struct options, p), 1}
 static const struct fuse_opt option_spec[] = {
     OPTION("--host=%s", host), OPTION("-h=%s", host),          OPTION("--port=%d", port), OPTION("-p=%d", port), OPTION("--help", show_help),
     OPTION("--name=%s", name), OPTION("-n=%s", name),          OPTION("--cert=%s", cert), OPTION("-c=%s", cert), OPTION("--key=%s", key),
-    OPTION("-k=%s", key),      OPTION("--server=%s", srvcert), OPTION("-s=%s", srvcert),  FUSE_OPT_END};
+    OPTION("-k=%s", key),      OPTION("--server=%s", srvcert), OPTION("-s=%s", srvcert),  OPTION("--export=%s", export_name),
+    OPTION("-e=%s", export_name), FUSE_OPT_END};
 
 static void show_help(char *progname) {
     log(NONE, "usage: %s [options] <mountpoint>\n\n", progname);
     log(NONE, "File-system specific options:\n"
-              "    -h   --host=<s>      The host of server (required)\n"
+              "    -h   --host=<s>      The host of server or its URL: tls://host[:port], unix:///path, vsock://cid[:port] (required)\n"
               "    -p   --port=<d>      The port of server (default: 5210)\n"
               "    -n   --name=<s>      The display name of user (default: login name)\n"
               "    -c   --cert=<s>      Client x509 PEM certificate path (default: '')\n"
               "    -k   --key=<s>       Client x509 PEM certificate key path (default: '')\n"
               "    -s   --server=<s>    Server x509 PEM certificate path (optional) (default: '')\n"
+              "    -e   --export=<s>    The export of the server to mount (default: the default export)\n"
               "    --help               Print this help\n");
 }
 
@@ -71,14 +77,15 @@ int main(int argc, char *argv[]) {
     opts.cert = NULL;
     opts.key = NULL;
     opts.srvcert = NULL;
+    opts.export_name = NULL;
 
     if (fuse_opt_parse(&args, &opts, option_spec, NULL) == -1) {
         cleanup_routine(&args, -1, nullptr);
         return 1;
     }
 
-    gnutls_session_t session;
-    gnutls_certificate_credentials_t cred;
+    gnutls_session_t session = nullptr;
+    gnutls_certificate_credentials_t cred = nullptr;
     int sock = -1;
     if (opts.show_help) {
         show_help(args.argv[0]);
@@ -91,53 +98,62 @@ int main(int argc, char *argv[]) {
             cleanup_routine(&args, sock, nullptr);
             return 1;
         }
-        if (opts.cert == NULL || opts.key == NULL) {
-            log(ERROR, "Missing TLS key/certificate");
+        Endpoint endpoint;
+        if (!parse_endpoint(opts.host, opts.port, &endpoint)) {
+            log(ERROR, "Invalid server URL %s", opts.host);
             cleanup_routine(&args, -1, nullptr);
+            return 1;
         }
 
         gnutls_global_init();
 
-        gnutls_certificate_allocate_credentials(&cred);
-        int err = gnutls_certificate_set_x509_key_file(cred, opts.cert, opts.key, GNUTLS_X509_FMT_PEM);
-        if (err < 0) {
-            log(ERROR, "Failed to set certificate/key: %s", gnutls_strerror(err));
-            cleanup_routine(&args, -1, nullptr);
-            return 1;
-        }
-
-        if (opts.srvcert != NULL) {
-            gnutls_certificate_set_x509_trust_file(cred, opts.srvcert, GNUTLS_X509_FMT_PEM);
+        // the plain transports are local, they need no certificates
+        if (endpoint.transport == Endpoint::TLS) {
+            if (opts.cert == NULL || opts.key == NULL) {
+                log(ERROR, "Missing TLS key/certificate");
+                cleanup_routine(&args, -1, nullptr);
+                return 1;
+            }
+            gnutls_certificate_allocate_credentials(&cred);
+            int err = gnutls_certificate_set_x509_key_file(cred, opts.cert, opts.key, GNUTLS_X509_FMT_PEM);
+            if (err < 0) {
+                log(ERROR, "Failed to set certificate/key: %s", gnutls_strerror(err));
+                cleanup_routine(&args, -1, nullptr);
+                return 1;
+            }
+
+            if (opts.srvcert != NULL) {
+                gnutls_certificate_set_x509_trust_file(cred, opts.srvcert, GNUTLS_X509_FMT_PEM);
+            }
         }
 
-        gnutls_init(&session, GNUTLS_CLIENT);
-        gnutls_set_default_priority(session);
-        gnutls_credentials_set(session, GNUTLS_CRD_CERTIFICATE, cred);
-
-        sock = connect(opts.host, opts.port);
-        if (sock < 0) {
-            cleanup_routine(&args, sock, &session);
+        if (start_session(endpoint, cred, &sock, &session) < 0) {
+            cleanup_routine(&args, -1, nullptr);
             return 1;
         }
+    }
 
-        gnutls_transport_set_int(session, sock);
-
-        if (gnutls_handshake(session) < 0) {
-            log(ERROR, "TLS handshake failed");
-            cleanup_routine(&args, sock, &session);
-            return 1;
+    if (!opts.show_help) {
+        // the commands of the extension port accept paths below the mount point
+        fuse_cmdline_opts cmdline_opts = {};
+        fuse_args cmdline_args = FUSE_ARGS_INIT(args.argc, args.argv);
+        if (fuse_parse_cmdline(&cmdline_args, &cmdline_opts) == 0 && cmdline_opts.mountpoint != nullptr) {
+            set_mount_point(cmdline_opts.mountpoint);
+            free(cmdline_opts.mountpoint);
         }
+        fuse_opt_free_args(&cmdline_args);
     }
 
     std::thread lsp_thread(listen_lsp, 5211, sock, session);
 
-    config cfg = {.name = opts.name};
+    config cfg = {.name = opts.name, .export_name = opts.export_name != NULL ? opts.export_name : ""};
 
     struct fuse_operations oper = get_fuse_operations(sock, cfg, session);
 
     int ret = fuse_main(args.argc, args.argv, &oper, NULL);
 
-    cleanup_routine(&args, sock, &session);
+    close_session();
+    cleanup_routine(&args, -1, nullptr);
     if (cred != nullptr) {
         gnutls_certificate_free_credentials(cred);
     }
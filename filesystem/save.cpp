@@ -0,0 +1,338 @@
+#include "save.h"
+#include "../common/log.h"
+#include "attr.h"
+#include "session.h"
+#include "tcp.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sys/stat.h>
+
+struct staged_file {
+    // guards the fields below, held while the file is sent to the server
+    std::mutex mutex;
+    // empty when the file was unlinked, the empty file of the same name is on the server
+    std::string path;
+    int mode;
+    std::string content;
+    time_t modified;
+    bool sync = false;
+    // the content is on the server, the requests of the handle go there
+    bool saved = false;
+    int server_fd = -1;
+};
+
+// the staged handles are above the descriptors of the server
+static const uint64_t staged_handle_bit = 1ull << 40;
+static const size_t max_staged_size = 4 << 20;
+
+static std::mutex staged_mutex;
+static std::map<uint64_t, std::shared_ptr<staged_file>> handles;
+// the files which are not saved yet
+static std::map<std::string, std::shared_ptr<staged_file>> paths;
+static uint64_t next_handle = staged_handle_bit;
+
+// The names of the temp files written by editors and tools which save by renaming.
+static bool is_temp_name(const std::string &path) {
+    const std::string name = path.substr(path.find_last_of('/') + 1);
+    static const std::array<const char *, 2> suffixes = {".tmp", "___jb_tmp___"};
+    for (const char *suffix : suffixes) {
+        if (name.size() > strlen(suffix) && name.ends_with(suffix)) {
+            return true;
+        }
+    }
+    // vscode and node write "name.tmp.<random>", gedit ".goutputstream-<random>"
+    return name.find(".tmp.") != std::string::npos || name.starts_with(".goutputstream-");
+}
+
+static std::shared_ptr<staged_file> find_handle(uint64_t handle) {
+    std::lock_guard<std::mutex> lock(staged_mutex);
+    auto it = handles.find(handle);
+    return it != handles.end() ? it->second : nullptr;
+}
+
+static std::shared_ptr<staged_file> find_path(const std::string &path) {
+    std::lock_guard<std::mutex> lock(staged_mutex);
+    auto it = paths.find(path);
+    return it != paths.end() ? it->second : nullptr;
+}
+
+static void forget_path(const std::string &path, const staged_file *file) {
+    std::lock_guard<std::mutex> lock(staged_mutex);
+    auto it = paths.find(path);
+    if (it != paths.end() && it->second.get() == file) {
+        paths.erase(it);
+    }
+}
+
+// Sends the content as path, the empty file on the server is renamed to path when it
+// is another one. Called with the mutex of the file held.
+static int save_locked(int sock, gnutls_session_t ssl, staged_file &file, const std::string &path) {
+    SaveRequest req;
+    req.set_path(path);
+    req.set_data(file.content);
+    req.set_mode(file.mode);
+    req.set_sync(file.sync);
+    if (path != file.path) {
+        req.set_from(file.path);
+    }
+    SaveResponse res;
+    int err = request_response<SaveResponse>(sock, ssl, req, &res, SAVE_REQUEST);
+    if (err < 0) {
+        log(ERROR, sock, "Error sending message");
+        return -ENONET;
+    }
+    log(INFO, sock, "Try to save file: %d", res.error());
+    if (res.error() != 0) {
+        return -res.error();
+    }
+    forget_path(file.path, &file);
+    invalidate_attr(file.path);
+    invalidate_attr(path);
+    store_attr(path, res.attr());
+    file.path = path;
+    file.saved = true;
+    file.content.clear();
+    file.content.shrink_to_fit();
+    return 0;
+}
+
+bool stage_file(int sock, gnutls_session_t ssl, const std::string &path, int mode, int flags, uint64_t *handle,
+                int *error) {
+    if (!is_temp_name(path)) {
+        return false;
+    }
+    // the empty file checks the existence and the permissions like a create, and lists
+    // the temp file in its directory
+    MknodRequest req;
+    req.set_path(path);
+    req.set_mode(S_IFREG | (mode & 07777));
+    req.set_dev(0);
+    MknodResponse res;
+    if (request_response<MknodResponse>(sock, ssl, req, &res, MKNOD_REQUEST) < 0) {
+        log(ERROR, sock, "Error sending message");
+        *error = -ENONET;
+        return true;
+    }
+    log(INFO, sock, "Try to stage file: %d", res.error());
+    invalidate_attr(path);
+    if (res.error() == EEXIST && !(flags & O_EXCL)) {
+        // an existing file is truncated on the server
+        return false;
+    }
+    *error = -res.error();
+    if (res.error() != 0) {
+        return true;
+    }
+    auto file = std::make_shared<staged_file>();
+    file->path = path;
+    file->mode = mode;
+    file->modified = time(nullptr);
+    std::lock_guard<std::mutex> lock(staged_mutex);
+    *handle = next_handle++;
+    handles[*handle] = file;
+    paths[path] = file;
+    return true;
+}
+
+bool is_staged(uint64_t handle) { return (handle & staged_handle_bit) != 0; }
+
+int staged_write(uint64_t handle, const char *buffer, size_t size, off_t offset) {
+    auto file = find_handle(handle);
+    if (file == nullptr) {
+        return -EBADF;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || offset + size > max_staged_size) {
+        return -EAGAIN;
+    }
+    if (file->content.size() < offset + size) {
+        file->content.resize(offset + size);
+    }
+    file->content.replace(offset, size, buffer, size);
+    file->modified = time(nullptr);
+    return size;
+}
+
+int staged_read(uint64_t handle, char *buffer, size_t size, off_t offset) {
+    auto file = find_handle(handle);
+    if (file == nullptr) {
+        return -EBADF;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved) {
+        return -EAGAIN;
+    }
+    if (static_cast<size_t>(offset) >= file->content.size()) {
+        return 0;
+    }
+    size = std::min(size, file->content.size() - offset);
+    memcpy(buffer, file->content.data() + offset, size);
+    return size;
+}
+
+int flush_staged(int sock, gnutls_session_t ssl, uint64_t handle, bool sync) {
+    auto file = find_handle(handle);
+    if (file == nullptr) {
+        return -EBADF;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved) {
+        return -EAGAIN;
+    }
+    if (file->path.empty()) {
+        // unlinked, nothing to keep
+        return 0;
+    }
+    file->sync = file->sync || sync;
+    return save_locked(sock, ssl, *file, file->path);
+}
+
+int release_staged(int sock, gnutls_session_t ssl, uint64_t handle) {
+    auto file = find_handle(handle);
+    if (file == nullptr) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    {
+        std::lock_guard<std::mutex> staged_lock(staged_mutex);
+        handles.erase(handle);
+    }
+    // the flush failed, the close reported it already
+    if (!file->saved && !file->path.empty() && save_locked(sock, ssl, *file, file->path) < 0) {
+        log(ERROR, sock, "Error saving %s", file->path.c_str());
+        forget_path(file->path, file.get());
+        invalidate_attr(file->path);
+    }
+    return file->server_fd;
+}
+
+int handle_fd(int sock, gnutls_session_t ssl, uint64_t handle) {
+    if (!is_staged(handle)) {
+        return handle;
+    }
+    auto file = find_handle(handle);
+    if (file == nullptr) {
+        return -EBADF;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->path.empty()) {
+        // unlinked while open, there is nothing left on the server
+        return -ENOENT;
+    }
+    if (!file->saved) {
+        int err = save_locked(sock, ssl, *file, file->path);
+        if (err < 0) {
+            return err;
+        }
+    }
+    if (file->server_fd < 0) {
+        OpenRequest req;
+        req.set_path(file->path);
+        req.set_flags(O_RDWR);
+        req.set_token(open_token());
+        OpenResponse res;
+        if (request_response<OpenResponse>(sock, ssl, req, &res, OPEN_REQUEST) < 0) {
+            log(ERROR, sock, "Error sending message");
+            return -ENONET;
+        }
+        if (res.error() != 0) {
+            return -res.error();
+        }
+        file->server_fd = track_handle(res.fd(), file->path, O_RDWR, false);
+    }
+    return file->server_fd;
+}
+
+bool staged_attr(const std::string &path, GetAttrResponse *attr) {
+    auto file = find_path(path);
+    if (file == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || file->path != path) {
+        return false;
+    }
+    attr->set_error(0);
+    attr->set_mode(S_IFREG | (file->mode & 07777));
+    attr->set_nlink(1);
+    attr->set_size(file->content.size());
+    attr->set_atime(file->modified);
+    attr->set_mtime(file->modified);
+    attr->set_ctime(file->modified);
+    attr->set_own(true);
+    attr->set_gown(true);
+    return true;
+}
+
+bool staged_chmod(const std::string &path, int mode) {
+    auto file = find_path(path);
+    if (file == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || file->path != path) {
+        return false;
+    }
+    file->mode = mode;
+    return true;
+}
+
+bool staged_truncate(const std::string &path, off_t size) {
+    auto file = find_path(path);
+    if (file == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || file->path != path || static_cast<size_t>(size) > max_staged_size) {
+        return false;
+    }
+    file->content.resize(size);
+    file->modified = time(nullptr);
+    return true;
+}
+
+void drop_staged(const std::string &path) {
+    auto file = find_path(path);
+    if (file == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || file->path != path) {
+        return;
+    }
+    forget_path(path, file.get());
+    file->path.clear();
+    invalidate_attr(path);
+}
+
+bool save_staged(int sock, gnutls_session_t ssl, const std::string &old_path, const std::string &new_path, int *error) {
+    auto file = find_path(old_path);
+    if (file == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || file->path != old_path) {
+        return false;
+    }
+    *error = save_locked(sock, ssl, *file, new_path);
+    return true;
+}
+
+int commit_staged(int sock, gnutls_session_t ssl, const std::string &path) {
+    auto file = find_path(path);
+    if (file == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(file->mutex);
+    if (file->saved || file->path != path) {
+        return 0;
+    }
+    return save_locked(sock, ssl, *file, path);
+}
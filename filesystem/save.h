@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../proto/messages.pb.h"
+#include <cstdint>
+#include <gnutls/gnutls.h>
+#include <string>
+#include <sys/types.h>
+
+// Editors save a file by writing a temp file next to it and renaming the temp file
+// over it, which is a create, the writes, an fsync, a release and a rename, each a
+// round trip. The temp files are recognised by their names and created empty on the
+// server, their writes are kept here and sent with one SAVE request by the flush or
+// the fsync, or by a rename while the file is still open. A temp file which is used
+// otherwise is saved first. Larger temp files are saved when they outgrow the buffer
+// and written as usual.
+
+// Stages the file created at path when its name is the one of a temp file and sets the
+// handle given to the kernel, false when the file has to be created on the server as
+// usual. error is the result of the create otherwise.
+bool stage_file(int sock, gnutls_session_t ssl, const std::string &path, int mode, int flags, uint64_t *handle,
+                int *error);
+bool is_staged(uint64_t handle);
+
+// The operations on a staged handle, -EAGAIN when the handle was saved and the request
+// has to go to the server with the descriptor returned by handle_fd.
+int staged_write(uint64_t handle, const char *buffer, size_t size, off_t offset);
+int staged_read(uint64_t handle, char *buffer, size_t size, off_t offset);
+// Saves the content under the name of the handle and returns the error of the save.
+int flush_staged(int sock, gnutls_session_t ssl, uint64_t handle, bool sync);
+// Forgets the handle, saving the content when the flush did not. Returns the descriptor
+// of the server to release when the handle was opened there, -1 otherwise.
+int release_staged(int sock, gnutls_session_t ssl, uint64_t handle);
+
+// The server descriptor of the handle, the staged handles are saved and opened on the
+// server first. Returns the handle itself for the other handles, -errno on failure.
+int handle_fd(int sock, gnutls_session_t ssl, uint64_t handle);
+
+// The attributes of a staged path, false when the path is not staged.
+bool staged_attr(const std::string &path, GetAttrResponse *attr);
+// Changes of a staged path which stay in memory, false when the path is not staged.
+bool staged_chmod(const std::string &path, int mode);
+bool staged_truncate(const std::string &path, off_t size);
+// Forgets the staged path without saving it, the file on the server is unlinked by the caller.
+void drop_staged(const std::string &path);
+// Saves the staged old_path as new_path with one request, false when old_path is not staged.
+bool save_staged(int sock, gnutls_session_t ssl, const std::string &old_path, const std::string &new_path, int *error);
+// Saves the staged path under its own name before a request uses the path, -errno on failure.
+int commit_staged(int sock, gnutls_session_t ssl, const std::string &path);
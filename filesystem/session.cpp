@@ -0,0 +1,631 @@
+#include "session.h"
+#include "../common/log.h"
+#include "command.h"
+#include "tcp.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <fcntl.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/xattr.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+constexpr auto reconnect_delay_min = std::chrono::milliseconds(50);
+constexpr auto reconnect_delay_max = std::chrono::seconds(5);
+// a link which silently went away is noticed after a few seconds instead of minutes
+constexpr int keepalive_idle = 5;
+constexpr int keepalive_interval = 1;
+constexpr int keepalive_count = 3;
+constexpr unsigned int user_timeout_ms = 5000;
+// a server which accepts the connection but does not finish the handshake or answer the
+// requests of the reconnect is connected to again
+constexpr auto reconnect_timeout = std::chrono::seconds(10);
+
+struct inflight_request {
+    std::string frame;
+    bool replay;
+    // false when it was queued while the connection was down
+    bool sent;
+    // the bytes taken from the window, the request and the data to be read
+    int64_t cost;
+};
+
+struct open_handle {
+    std::string path;
+    int flags;
+    // the descriptor on the server, it differs from the handle after a server restart
+    int server;
+};
+
+class ServerSession : public Connection {
+  public:
+    int send_frame(std::string frame) override;
+
+    Endpoint endpoint;
+    gnutls_certificate_credentials_t cred;
+    int sock = -1;
+    // the session known to the rest of the file system, it only names the connection after a reconnect
+    gnutls_session_t handle = nullptr;
+    // null on the plain transports
+    gnutls_session_t current = nullptr;
+
+    std::mutex mutex;
+    bool connected = false;
+    bool closed = false;
+    std::map<int, inflight_request> inflight;
+    // the window granted by the server, none until the init response arrives
+    int credits = 0;
+    int64_t credit_bytes = 0;
+    int64_t inflight_bytes = 0;
+    std::condition_variable credit_cv;
+    std::string init_body;
+    // resumes the TLS session on the next connection, taken once the server sent it
+    gnutls_datum_t ticket = {.data = nullptr, .size = 0};
+    bool has_ticket = false;
+    uint64_t instance = 0;
+    std::map<uint64_t, open_handle> files;
+    std::map<uint64_t, open_handle> dirs;
+    // the descriptors passed with the open responses by the server descriptor, until the open takes them
+    std::map<int, int> backing;
+    // the handles are translated to the server descriptors since the server was restarted
+    bool translate = false;
+
+    int write_frame(const std::string &frame);
+    bool has_credit(int64_t cost) const;
+    void add_inflight(int id, inflight_request request);
+    std::map<int, inflight_request>::iterator erase_inflight(std::map<int, inflight_request>::iterator it);
+};
+
+static std::shared_ptr<ServerSession> session;
+
+uint64_t open_token() {
+    // the random half keeps the tokens of the mounts apart, they share the handles of an export
+    static const uint64_t mount = static_cast<uint64_t>(std::random_device()()) << 32;
+    static std::atomic<uint32_t> next = 0;
+    return mount | ++next;
+}
+
+// The responses of these requests are waited for, the others are streamed or not answered.
+static bool is_tracked(int type) {
+    return type != Type::LSP_REQUEST && type != Type::SEARCH_REQUEST && type != Type::SEARCH_CANCEL_REQUEST && type != Type::EXEC_REQUEST &&
+           type != Type::EXEC_CANCEL_REQUEST;
+}
+
+static bool appends(uint64_t handle) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    auto it = session->files.find(handle);
+    return it != session->files.end() && (it->second.flags & O_APPEND);
+}
+
+// Requests which have the same effect when the server handles them twice. The opens carry
+// a token, the server hands out the handle of the first one again.
+static bool is_replayable(int type, const std::string &body) {
+    switch (type) {
+    case Type::OPEN_REQUEST: {
+        OpenRequest req;
+        return req.ParseFromString(body) && !(req.flags() & O_EXCL);
+    }
+    case Type::WRITE_REQUEST: {
+        // the offset is ignored on a handle opened with O_APPEND, the data would be appended twice
+        WriteRequest req;
+        return req.ParseFromString(body) && !appends(req.fd());
+    }
+    case Type::SAVE_REQUEST: {
+        // the file renamed after the save is gone the second time
+        SaveRequest req;
+        return req.ParseFromString(body) && req.from().empty();
+    }
+    case Type::SETXATTR_REQUEST: {
+        // fails with EEXIST the second time
+        SetxattrRequest req;
+        return req.ParseFromString(body) && !(req.flags() & XATTR_CREATE);
+    }
+    case Type::INIT_REQUEST:
+    case Type::GET_ATTR_REQUEST:
+    case Type::READ_DIR_REQUEST:
+    case Type::READ_REQUEST:
+    case Type::CHMOD_REQUEST:
+    case Type::TRUNCATE_REQUEST:
+    case Type::READ_LINK_REQUEST:
+    case Type::STATFS_REQUEST:
+    case Type::FSYNC_REQUEST:
+    case Type::GETXATTR_REQUEST:
+    case Type::LISTXATTR_REQUEST:
+    case Type::OPENDIR_REQUEST:
+    case Type::FSYNCDIR_REQUEST:
+    case Type::UTIMENS_REQUEST:
+    case Type::ACCESS_REQUEST:
+    case Type::FALLOCATE_REQUEST:
+    case Type::LSEEK_REQUEST:
+    case Type::COPY_FILE_RANGE_REQUEST:
+    case Type::BATCH_STAT_REQUEST:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The requests which carry handles, nullptr for the others.
+static std::unique_ptr<google::protobuf::Message> handle_message_of(int type) {
+    switch (type) {
+    case Type::RELEASE_REQUEST:
+        return std::make_unique<ReleaseRequest>();
+    case Type::READ_REQUEST:
+        return std::make_unique<ReadRequest>();
+    case Type::WRITE_REQUEST:
+        return std::make_unique<WriteRequest>();
+    case Type::FSYNC_REQUEST:
+        return std::make_unique<FsyncRequest>();
+    case Type::LOCK_REQUEST:
+        return std::make_unique<LockRequest>();
+    case Type::FLOCK_REQUEST:
+        return std::make_unique<FlockRequest>();
+    case Type::FALLOCATE_REQUEST:
+        return std::make_unique<FallocateRequest>();
+    case Type::LSEEK_REQUEST:
+        return std::make_unique<LseekRequest>();
+    case Type::COPY_FILE_RANGE_REQUEST:
+        return std::make_unique<CopyFileRangeRequest>();
+    case Type::READ_DIR_REQUEST:
+        return std::make_unique<ReadDirRequest>();
+    case Type::RELEASEDIR_REQUEST:
+        return std::make_unique<ReleasedirRequest>();
+    case Type::FSYNCDIR_REQUEST:
+        return std::make_unique<FsyncdirRequest>();
+    default:
+        return nullptr;
+    }
+}
+
+static void translate_field(google::protobuf::Message &message, const char *name, const std::map<uint64_t, open_handle> &handles) {
+    const auto *field = message.GetDescriptor()->FindFieldByName(name);
+    if (field == nullptr) {
+        return;
+    }
+    const auto *reflection = message.GetReflection();
+    auto it = handles.find(reflection->GetInt32(message, field));
+    if (it != handles.end()) {
+        reflection->SetInt32(&message, field, it->second.server);
+    }
+}
+
+static std::string make_frame(int id, int type, const google::protobuf::Message &message) {
+    std::string body = message.SerializeAsString();
+    Header header = {.size = static_cast<int32_t>(body.size()), .id = id, .type = type};
+    char *buffer = serialize(&header);
+    std::string frame(buffer, HEADER_SIZE);
+    delete[] buffer;
+    return frame + body;
+}
+
+// Called with the mutex held.
+int ServerSession::write_frame(const std::string &frame) {
+    Header header;
+    deserialize(const_cast<char *>(frame.data()), &header);
+    std::unique_ptr<google::protobuf::Message> message;
+    if (translate && (message = handle_message_of(header.type)) != nullptr && message->ParseFromArray(frame.data() + HEADER_SIZE, header.size)) {
+        translate_field(*message, "fd", files);
+        translate_field(*message, "fd_in", files);
+        translate_field(*message, "fd_out", files);
+        translate_field(*message, "directory_descriptor", dirs);
+        std::string translated = make_frame(header.id, header.type, *message);
+        return full_write(sock, current, *translated.data(), translated.size()) == static_cast<int>(translated.size()) ? frame.size() : -1;
+    }
+    return full_write(sock, current, *const_cast<char *>(frame.data()), frame.size());
+}
+
+// A request larger than the whole window is sent when nothing else is outstanding.
+bool ServerSession::has_credit(int64_t cost) const {
+    if (credits <= 0 || inflight.empty()) {
+        return true;
+    }
+    return static_cast<int>(inflight.size()) < credits && inflight_bytes + cost <= credit_bytes;
+}
+
+void ServerSession::add_inflight(int id, inflight_request request) {
+    inflight_bytes += request.cost;
+    inflight[id] = std::move(request);
+}
+
+std::map<int, inflight_request>::iterator ServerSession::erase_inflight(std::map<int, inflight_request>::iterator it) {
+    inflight_bytes -= it->second.cost;
+    credit_cv.notify_all();
+    return inflight.erase(it);
+}
+
+int ServerSession::send_frame(std::string frame) {
+    Header header;
+    deserialize(frame.data(), &header);
+    const int size = frame.size();
+    const bool tracked = is_tracked(header.type);
+    const bool replay = tracked && is_replayable(header.type, frame.substr(HEADER_SIZE));
+    const int64_t cost = request_cost(header, frame.data() + HEADER_SIZE);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (tracked) {
+        // the server does not read more than it granted, waiting here keeps the requests in order
+        credit_cv.wait(lock, [&] { return closed || has_credit(cost); });
+    }
+    if (closed) {
+        return -1;
+    }
+    if (header.type == Type::INIT_REQUEST) {
+        init_body = frame.substr(HEADER_SIZE);
+    }
+    if (!connected) {
+        // nothing was sent, so it is sent once the connection is back
+        if (!tracked) {
+            return -1;
+        }
+        add_inflight(header.id, inflight_request{.frame = std::move(frame), .replay = replay, .sent = false, .cost = cost});
+        return size;
+    }
+    int n = write_frame(frame);
+    if (tracked) {
+        add_inflight(header.id, inflight_request{.frame = std::move(frame), .replay = replay, .sent = true, .cost = cost});
+    }
+    if (n < size) {
+        // the receiving thread notices the broken connection and reconnects
+        shutdown(sock, SHUT_RDWR);
+        if (!replay) {
+            if (tracked) {
+                erase_inflight(inflight.find(header.id));
+            }
+            return -1;
+        }
+    }
+    return size;
+}
+
+static void configure_socket(int sock) {
+    constexpr int one = 1;
+    setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+    setsockopt(sock, IPPROTO_TCP, TCP_KEEPIDLE, &keepalive_idle, sizeof(keepalive_idle));
+    setsockopt(sock, IPPROTO_TCP, TCP_KEEPINTVL, &keepalive_interval, sizeof(keepalive_interval));
+    setsockopt(sock, IPPROTO_TCP, TCP_KEEPCNT, &keepalive_count, sizeof(keepalive_count));
+    setsockopt(sock, IPPROTO_TCP, TCP_USER_TIMEOUT, &user_timeout_ms, sizeof(user_timeout_ms));
+}
+
+// Returns the TLS session over sock, nullptr when the handshake failed. The ticket of
+// the previous connection makes it an abbreviated handshake.
+static gnutls_session_t handshake(int sock, gnutls_certificate_credentials_t cred, const gnutls_datum_t *ticket) {
+    gnutls_session_t ssl;
+    gnutls_init(&ssl, GNUTLS_CLIENT);
+    gnutls_set_default_priority(ssl);
+    gnutls_credentials_set(ssl, GNUTLS_CRD_CERTIFICATE, cred);
+    if (ticket != nullptr && ticket->size > 0) {
+        gnutls_session_set_data(ssl, ticket->data, ticket->size);
+    }
+    gnutls_transport_set_int(ssl, sock);
+    gnutls_handshake_set_timeout(ssl, std::chrono::duration_cast<std::chrono::milliseconds>(reconnect_timeout).count());
+    int err;
+    do {
+        err = gnutls_handshake(ssl);
+    } while (err < 0 && !gnutls_error_is_fatal(err));
+    if (err < 0) {
+        log(ERROR, sock, "TLS handshake failed: %s", gnutls_strerror(err));
+        gnutls_deinit(ssl);
+        return nullptr;
+    }
+    return ssl;
+}
+
+int start_session(const Endpoint &endpoint, gnutls_certificate_credentials_t cred, int *sock, gnutls_session_t *ssl) {
+    int fd = connect_endpoint(endpoint);
+    if (fd < 0) {
+        return -1;
+    }
+    gnutls_session_t tls = nullptr;
+    if (endpoint.transport == Endpoint::TLS) {
+        configure_socket(fd);
+        tls = handshake(fd, cred, nullptr);
+        if (tls == nullptr) {
+            close(fd);
+            return -1;
+        }
+    }
+    session = std::make_shared<ServerSession>();
+    session->endpoint = endpoint;
+    session->cred = cred;
+    session->sock = fd;
+    session->handle = tls;
+    session->current = tls;
+    session->connected = true;
+    if (tls != nullptr) {
+        gnutls_session_set_ptr(tls, session.get());
+    } else {
+        attach_connection(fd, session.get());
+    }
+    if (endpoint.transport == Endpoint::UNIX) {
+        accept_descriptors(fd);
+    }
+    *sock = fd;
+    *ssl = tls;
+    return 0;
+}
+
+// Keeps the descriptor which came with the response for the open waiting for it.
+static void keep_descriptor(const Header &header, const std::string &body) {
+    int descriptor = take_descriptor(session->sock);
+    if (descriptor < 0) {
+        return;
+    }
+    OpenResponse res;
+    if (header.type != Type::OPEN_RESPONSE || !res.ParseFromString(body) || !res.passthrough()) {
+        close(descriptor);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    auto [it, inserted] = session->backing.try_emplace(res.fd(), descriptor);
+    if (!inserted) {
+        // left by an open which failed before it took it
+        close(it->second);
+        it->second = descriptor;
+    }
+}
+
+int receive_message(recv_handlers &handlers) {
+    char buffer[HEADER_SIZE];
+    if (full_read(session->sock, session->current, *buffer, sizeof(buffer)) < static_cast<int>(sizeof(buffer))) {
+        return 0;
+    }
+    Header header;
+    deserialize(buffer, &header);
+    if (header.size < 0) {
+        log(ERROR, session->sock, "Invalid message size %d", header.size);
+        return 0;
+    }
+    std::string body(header.size, '\0');
+    if (header.size > 0 && full_read(session->sock, session->current, *body.data(), header.size) < header.size) {
+        return 0;
+    }
+    if (!session->has_ticket && session->current != nullptr) {
+        // in TLS 1.3 the ticket arrives after the handshake, it was read with the first response
+        gnutls_free(session->ticket.data);
+        session->ticket = {.data = nullptr, .size = 0};
+        session->has_ticket = gnutls_session_get_data2(session->current, &session->ticket) == 0;
+    }
+    if (session->current == nullptr) {
+        keep_descriptor(header, body);
+    }
+    // the handlers answer through the session known to the file system
+    handle_message(session->sock, session->handle, &header, body.data(), handlers);
+    return 1;
+}
+
+// Reads size bytes, false when the connection dropped or nothing arrived until the deadline.
+static bool read_until(int sock, gnutls_session_t ssl, char *buffer, int size, std::chrono::steady_clock::time_point deadline) {
+    int done = 0;
+    while (done < size) {
+        // the data decrypted already is not seen by poll
+        if (ssl == nullptr || gnutls_record_check_pending(ssl) == 0) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            struct pollfd pfd = {.fd = sock, .events = POLLIN, .revents = 0};
+            int ready = left.count() > 0 ? poll(&pfd, 1, left.count()) : 0;
+            if (ready < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ready <= 0) {
+                return false;
+            }
+        }
+        ssize_t len = transport_recv(sock, ssl, buffer + done, size - done);
+        // also returned after a session ticket was received
+        if (len == GNUTLS_E_INTERRUPTED || len == GNUTLS_E_AGAIN) {
+            continue;
+        }
+        if (len <= 0) {
+            return false;
+        }
+        done += len;
+    }
+    return true;
+}
+
+// Sends a request on a connection nobody else uses yet and reads its response.
+static bool exchange(int sock, gnutls_session_t ssl, int type, const google::protobuf::Message &request, google::protobuf::Message &response) {
+    std::string frame = make_frame(++request_id, type, request);
+    if (full_write(sock, ssl, *frame.data(), frame.size()) < static_cast<int>(frame.size())) {
+        return false;
+    }
+    const auto deadline = std::chrono::steady_clock::now() + reconnect_timeout;
+    char buffer[HEADER_SIZE];
+    if (!read_until(sock, ssl, buffer, sizeof(buffer), deadline)) {
+        return false;
+    }
+    Header header;
+    deserialize(buffer, &header);
+    std::string body(std::max(header.size, 0), '\0');
+    if (header.size > 0 && !read_until(sock, ssl, body.data(), header.size, deadline)) {
+        return false;
+    }
+    return response.ParseFromString(body);
+}
+
+// Opens the handles again on a restarted server, the ones which can not be opened keep
+// an invalid descriptor and their requests fail.
+static bool reopen_handles(int sock, gnutls_session_t ssl) {
+    for (auto &[fh, file] : session->files) {
+        OpenRequest req;
+        req.set_path(file.path);
+        req.set_flags(file.flags & ~(O_CREAT | O_EXCL | O_TRUNC));
+        OpenResponse res;
+        if (!exchange(sock, ssl, Type::OPEN_REQUEST, req, res)) {
+            return false;
+        }
+        file.server = res.error() == 0 ? res.fd() : -1;
+    }
+    for (auto &[fh, dir] : session->dirs) {
+        OpendirRequest req;
+        req.set_path(dir.path);
+        OpendirResponse res;
+        if (!exchange(sock, ssl, Type::OPENDIR_REQUEST, req, res)) {
+            return false;
+        }
+        dir.server = res.error() == 0 ? res.directory_descriptor() : -1;
+    }
+    session->translate = true;
+    return true;
+}
+
+bool reconnect_session() {
+    auto started = std::chrono::steady_clock::now();
+    std::vector<int> failed;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->closed) {
+            return false;
+        }
+        session->connected = false;
+        shutdown(session->sock, SHUT_RDWR);
+        for (auto it = session->inflight.begin(); it != session->inflight.end();) {
+            if (it->second.sent && !it->second.replay) {
+                // the server may have handled it already, repeating it is not safe
+                failed.push_back(it->first);
+                it = session->erase_inflight(it);
+            } else {
+                it->second.sent = false;
+                it++;
+            }
+        }
+    }
+    log(ERROR, session->sock, "Connection to the server lost, %zu requests failed", failed.size());
+    for (int id : failed) {
+        fail_request(id);
+    }
+    abort_commands(ECONNRESET);
+
+    auto delay = reconnect_delay_min;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (session->closed) {
+                return false;
+            }
+        }
+        const bool encrypted = session->endpoint.transport == Endpoint::TLS;
+        int fd = connect_endpoint(session->endpoint);
+        gnutls_session_t tls = nullptr;
+        if (fd >= 0) {
+            // the socket number stays the same for the whole mount
+            dup2(fd, session->sock);
+            close(fd);
+            if (encrypted) {
+                configure_socket(session->sock);
+                tls = handshake(session->sock, session->cred, &session->ticket);
+            }
+        }
+
+        InitRequest init;
+        InitResponse init_res;
+        if (fd >= 0 && (!encrypted || tls != nullptr) && init.ParseFromString(session->init_body) &&
+            exchange(session->sock, tls, Type::INIT_REQUEST, init, init_res) && init_res.error() == 0) {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            bool restarted = init_res.instance() != session->instance;
+            if (!restarted || reopen_handles(session->sock, tls)) {
+                if (session->current != session->handle && session->current != nullptr) {
+                    gnutls_deinit(session->current);
+                }
+                session->current = tls;
+                session->instance = init_res.instance();
+                session->credits = init_res.credits();
+                session->credit_bytes = init_res.credit_bytes();
+                session->connected = true;
+                session->has_ticket = false;
+                for (auto &[id, request] : session->inflight) {
+                    request.sent = true;
+                    if (session->write_frame(request.frame) < static_cast<int>(request.frame.size())) {
+                        shutdown(session->sock, SHUT_RDWR);
+                        break;
+                    }
+                }
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+                log(INFO, session->sock, "Reconnected in %ld ms (%s%s), %zu requests sent again", elapsed.count(),
+                    tls == nullptr ? "plain" : gnutls_session_is_resumed(tls) ? "resumed handshake" : "full handshake", restarted ? ", server restarted" : "",
+                    session->inflight.size());
+                return true;
+            }
+        }
+        if (tls != nullptr) {
+            gnutls_deinit(tls);
+        }
+        shutdown(session->sock, SHUT_RDWR);
+        std::this_thread::sleep_for(delay);
+        delay = std::min<std::chrono::milliseconds>(delay * 2, reconnect_delay_max);
+    }
+}
+
+void close_session() {
+    if (session == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->closed) {
+        return;
+    }
+    session->closed = true;
+    session->credit_cv.notify_all();
+    if (session->connected && session->current != nullptr) {
+        gnutls_bye(session->current, GNUTLS_SHUT_RDWR);
+    }
+    // wakes up the receiving thread, which then stops
+    shutdown(session->sock, SHUT_RDWR);
+}
+
+void complete_request(int id) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    auto it = session->inflight.find(id);
+    if (it != session->inflight.end()) {
+        session->erase_inflight(it);
+    }
+}
+
+void set_server_session(const InitResponse &response) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    session->instance = response.instance();
+    session->credits = response.credits();
+    session->credit_bytes = response.credit_bytes();
+    session->credit_cv.notify_all();
+}
+
+uint64_t track_handle(int fd, const std::string &path, int flags, bool directory) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    auto &handles = directory ? session->dirs : session->files;
+    uint64_t handle = fd;
+    if (session->translate) {
+        // the descriptor may be taken by a handle from before the restart
+        for (uint64_t candidate = INT32_MAX; handles.contains(handle); candidate--) {
+            handle = candidate;
+        }
+    }
+    handles[handle] = open_handle{.path = path, .flags = flags, .server = fd};
+    return handle;
+}
+
+bool passes_descriptors() { return session->endpoint.transport == Endpoint::UNIX; }
+
+int take_backing_descriptor(int fd) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    auto it = session->backing.find(fd);
+    if (it == session->backing.end()) {
+        return -1;
+    }
+    int descriptor = it->second;
+    session->backing.erase(it);
+    return descriptor;
+}
+
+void untrack_handle(uint64_t handle, bool directory) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    (directory ? session->dirs : session->files).erase(handle);
+}
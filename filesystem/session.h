@@ -0,0 +1,43 @@
+#pragma once
+#include "../common/io.h"
+#include <cstdint>
+#include <gnutls/gnutls.h>
+#include <string>
+
+// The connection of the mount to the server outlives the TCP connections. When one
+// drops a new one is made, resuming the TLS session with its ticket, the handles are
+// opened again if the server was restarted and the requests in flight are sent again
+// when it is safe to repeat them. The other requests in flight fail.
+//
+// The session and the socket set by start_session identify the connection for the
+// whole life of the mount, the socket number is kept on reconnects. The session is
+// null on the plain transports.
+int start_session(const Endpoint &endpoint, gnutls_certificate_credentials_t cred, int *sock, gnutls_session_t *ssl);
+// Reads and handles one message, 0 when the connection dropped.
+int receive_message(recv_handlers &handlers);
+// Waits until the connection is made again, false when the session was closed.
+bool reconnect_session();
+void close_session();
+
+// The window asked for at init. The requests waiting for a response and the data they
+// carry or read may not exceed the window granted by the server, the senders wait for
+// the responses to the earlier requests otherwise.
+constexpr int requested_credits = 64;
+constexpr int64_t requested_credit_bytes = 32 << 20;
+
+// The response to the request arrived, it is not sent again and its credit is returned.
+void complete_request(int id);
+// Takes the instance and the window of the server from the init response.
+void set_server_session(const InitResponse &response);
+
+// A token unique to an open or opendir request, the server answers a request sent again
+// after a reconnect with the handle it opened for the first one.
+uint64_t open_token();
+// Registers a handle opened on the server and returns the handle given to the kernel.
+uint64_t track_handle(int fd, const std::string &path, int flags, bool directory);
+void untrack_handle(uint64_t handle, bool directory);
+
+// True when the server is on the same host and passes the descriptors of the opened files.
+bool passes_descriptors();
+// Takes the descriptor passed with the open response for the server descriptor, -1 when there is none.
+int take_backing_descriptor(int fd);
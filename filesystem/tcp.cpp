@@ -1,20 +1,30 @@
 #include "tcp.h"
 #include "../common/io.h"
 #include "../common/log.h"
+#include "./command.h"
 #include "./lsp.h"
+#include "./session.h"
 #include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
 #include <google/protobuf/message.h>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <sys/epoll.h>
 #include <thread>
 
 std::map<int, std::string> messages;
 std::map<int, std::condition_variable> conditions;
+std::set<int> failed_requests;
 std::mutex condition_mutex;
-int request_id = 0;
+std::atomic<int> request_id = 0;
 
 template <typename T> int response_handler(int sock, gnutls_session_t ssl, int id, T message) {
     (void)sock;
     (void)ssl;
+    complete_request(id);
     std::unique_lock<std::mutex> lock(condition_mutex);
     messages[id] = message->SerializeAsString();
     conditions[id].notify_all();
@@ -22,6 +32,17 @@ template <typename T> int response_handler(int sock, gnutls_session_t ssl, int i
     return 0;
 }
 
+static int init_response_handler(int sock, gnutls_session_t ssl, int id, InitResponse *message) {
+    set_server_session(*message);
+    return response_handler(sock, ssl, id, message);
+}
+
+void fail_request(int id) {
+    std::lock_guard<std::mutex> lock(condition_mutex);
+    failed_requests.insert(id);
+    conditions[id].notify_all();
+}
+
 template <typename T> int request_handler(int sock, gnutls_session_t ssl, int id, T message) {
     (void)sock;
     (void)ssl;
@@ -32,7 +53,7 @@ template <typename T> int request_handler(int sock, gnutls_session_t ssl, int id
 
 recv_handlers handlers = {
     .init_request = request_handler<InitRequest *>,
-    .init_response = response_handler<InitResponse *>,
+    .init_response = init_response_handler,
     .get_attr_request = request_handler<GetAttrRequest *>,
     .get_attr_response = response_handler<GetAttrResponse *>,
     .open_request = request_handler<OpenRequest *>,
@@ -99,72 +120,166 @@ recv_handlers handlers = {
     .lseek_response = response_handler<LseekResponse *>,
     .lsp_request = request_handler<LspRequest *>,
     .lsp_response = lsp_response_handler,
+    .copy_file_range_request = request_handler<CopyFileRangeRequest *>,
+    .copy_file_range_response = response_handler<CopyFileRangeResponse *>,
+    .search_request = request_handler<SearchRequest *>,
+    .search_response = search_response_handler,
+    .search_cancel_request = request_handler<SearchCancelRequest *>,
+    .search_cancel_response = response_handler<SearchCancelResponse *>,
+    .batch_stat_request = request_handler<BatchStatRequest *>,
+    .batch_stat_response = response_handler<BatchStatResponse *>,
+    .save_request = request_handler<SaveRequest *>,
+    .save_response = response_handler<SaveResponse *>,
+    .exec_request = request_handler<ExecRequest *>,
+    .exec_response = exec_response_handler,
+    .exec_cancel_request = request_handler<ExecCancelRequest *>,
+    .exec_cancel_response = response_handler<ExecCancelResponse *>,
 };
 
-int connect(std::string host, int port) {
-    int sock;
-    if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
-        log(ERROR, sock, "Error creating socket: %s", strerror(errno));
-        return 1;
-    }
-    struct sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-    addr.sin_addr.s_addr = inet_addr(host.c_str());
-    if (connect(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
-        log(ERROR, sock, "Error connecting to port %d: %s", port, strerror(errno));
-        return -1;
-    }
-    log(INFO, sock, "Connected to port %d", port);
-
-    return sock;
-}
-
 int recv_thread(gnutls_session_t ssl, int sock) {
+    (void)ssl;
     while (true) {
-        int err = handle_recv(sock, ssl, handlers);
-        if (err < 0) {
-            log(ERROR, sock, "Error handling message: %s", strerror(errno));
-            return -1;
-        }
-        if (err == 0) {
-            close(sock);
+        if (receive_message(handlers) == 0 && !reconnect_session()) {
             log(INFO, sock, "Closing connection");
-            exit(1);
             return 0;
         }
     }
     return 1;
 }
 
-static void lsp_handler(const int sock, gnutls_session_t ssl, const int server_sock) {
+static int extension_request_handler(const int ext_sock, const int sock, gnutls_session_t ssl, const int id, const int language_id, char *request) {
+    if (is_command(language_id)) {
+        return command_request_handler(ext_sock, sock, ssl, id, language_id, request);
+    }
+    return lsp_request_handler(ext_sock, sock, ssl, id, language_id, request);
+}
+
+// The messages of an extension are handled in order by a thread of its own, a window whose
+// handler waits (for the send credit of the connection, a busy command, ...) does not hold
+// up the others. The socket is closed by that thread once the queued messages are handled.
+struct extension_queue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::pair<Header, std::string>> messages;
+    bool closed = false;
+};
+
+static void handle_extension(const int ext_sock, const std::shared_ptr<extension_queue> &queue, const int server_sock, gnutls_session_t ssl) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
     while (true) {
-        const auto err = handle_recv_lsp(sock, ssl, server_sock, lsp_request_handler);
-        if (err <= 0) {
-            if (err < 0) {
-                log(ERROR, sock, "Error handling message: %s", strerror(errno));
-            }
-            if (err == 0) {
-                log(INFO, sock, "Closing connection");
-            }
+        queue->cv.wait(lock, [&queue] { return queue->closed || !queue->messages.empty(); });
+        if (queue->messages.empty()) {
+            break;
+        }
+        auto [header, payload] = std::move(queue->messages.front());
+        queue->messages.pop_front();
+        lock.unlock();
+        if (extension_request_handler(ext_sock, server_sock, ssl, header.id, header.type /* language_id */, payload.data()) < 0) {
+            log(ERROR, ext_sock, "Error handling message: %s", strerror(errno));
+            // the reading thread sees the end of the connection and stops queueing
+            shutdown(ext_sock, SHUT_RDWR);
+        }
+        lock.lock();
+    }
+    lock.unlock();
+    close_lsp_extension(ext_sock, server_sock, ssl);
+    close_commands(ext_sock, server_sock, ssl);
+    close(ext_sock);
+}
+
+// Reads what the extension sent and queues the complete messages, false once it is gone.
+static bool read_extension(const int ext_sock, std::string &buffer, extension_queue &queue) {
+    char chunk[1 << 16];
+    const auto n = recv(ext_sock, chunk, sizeof(chunk), MSG_DONTWAIT);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EINTR) {
+            return true;
+        }
+        log(ERROR, ext_sock, "Error reading from the extension: %s", strerror(errno));
+        return false;
+    }
+    if (n == 0) {
+        log(INFO, ext_sock, "Closing connection");
+        return false;
+    }
+    buffer.append(chunk, n);
+
+    size_t offset = 0;
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    while (buffer.size() - offset >= HEADER_SIZE) {
+        Header header = {};
+        deserialize(buffer.data() + offset, &header);
+        if (header.size < 0) {
+            log(ERROR, ext_sock, "Invalid message size %d", header.size);
+            return false;
+        }
+        if (buffer.size() - offset - HEADER_SIZE < static_cast<size_t>(header.size)) {
+            break;
+        }
+        // the handlers get the payload as a string
+        std::string payload = buffer.substr(offset + HEADER_SIZE, header.size);
+        offset += HEADER_SIZE + header.size;
+        log(DEBUG, ext_sock, "Received message: %s", payload.c_str());
+        queue.messages.emplace_back(header, std::move(payload));
+    }
+    queue.cv.notify_one();
+    buffer.erase(0, offset);
+    return true;
+}
+
+static void close_extension(const int epoll_fd, const int ext_sock, extension_queue &queue) {
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, ext_sock, nullptr);
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.closed = true;
+    queue.cv.notify_one();
+}
 
-            set_lsp_extension_socket(-1);
-            close(sock);
-            return;
+// The user owning the other end of a loopback connection, looked up in the socket table of
+// the kernel as TCP over loopback has no SO_PEERCRED. -1 when the socket is not found.
+static long loopback_peer_uid(const int client_sock) {
+    sockaddr_in peer = {};
+    sockaddr_in local = {};
+    socklen_t peer_len = sizeof(peer);
+    socklen_t local_len = sizeof(local);
+    if (getpeername(client_sock, reinterpret_cast<sockaddr *>(&peer), &peer_len) < 0 ||
+        getsockname(client_sock, reinterpret_cast<sockaddr *>(&local), &local_len) < 0) {
+        return -1;
+    }
+    // the kernel prints the addresses as the raw 32 bits and the ports in host order
+    char peer_address[32];
+    char local_address[32];
+    snprintf(peer_address, sizeof(peer_address), "%08X:%04X", peer.sin_addr.s_addr, ntohs(peer.sin_port));
+    snprintf(local_address, sizeof(local_address), "%08X:%04X", local.sin_addr.s_addr, ntohs(local.sin_port));
+    std::ifstream table("/proc/net/tcp");
+    std::string line;
+    std::getline(table, line);
+    while (std::getline(table, line)) {
+        std::istringstream fields(line);
+        std::string slot, from, to, state, queues, timer, retransmits;
+        long uid = -1;
+        if (fields >> slot >> from >> to >> state >> queues >> timer >> retransmits >> uid && from == peer_address && to == local_address) {
+            return uid;
         }
     }
+    return -1;
 }
 
+// the listening socket lives as long as the process, the analyzer option exists since GCC 13
+#if __GNUC__ >= 13
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wanalyzer-fd-leak"
+#endif
+// All extension connections are read by one thread, each editor window has its own. The
+// port runs commands on the server, it listens on loopback and takes the connections of
+// the user running the filesystem (and root) only.
 int listen_lsp(const int port, const int server_sock, gnutls_session_t ssl) {
-    const int sock = socket(AF_INET, SOCK_STREAM, 0);
+    const int sock = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
     if (sock < 0) {
         perror("extension socket");
         return 1;
     }
 
-    sockaddr_in addr = {.sin_family = AF_INET, .sin_port = htons(port), .sin_addr = {.s_addr = INADDR_ANY}, .sin_zero = {}};
+    sockaddr_in addr = {.sin_family = AF_INET, .sin_port = htons(port), .sin_addr = {.s_addr = htonl(INADDR_LOOPBACK)}, .sin_zero = {}};
     constexpr int optval = 1;
     auto err = setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(int));
     if (err < 0) {
@@ -184,19 +299,62 @@ int listen_lsp(const int port, const int server_sock, gnutls_session_t ssl) {
     }
     log(INFO, sock, "Listening for extensions on port %d", port);
 
-    sockaddr_in client_addr;
-    socklen_t client_addr_len = sizeof(client_addr);
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event listening = {.events = EPOLLIN, .data = {.fd = sock}};
+    if (epoll_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, sock, &listening) < 0) {
+        log(ERROR, sock, "Error polling the extensions: %s", strerror(errno));
+        return 1;
+    }
+    // the bytes of the messages which did not arrive completely yet
+    std::map<int, std::string> buffers;
+    std::map<int, std::shared_ptr<extension_queue>> queues;
+    epoll_event events[64];
     while (true) {
-        const auto client_sock = accept(sock, reinterpret_cast<sockaddr *>(&client_addr), &client_addr_len);
-        if (client_sock < 0) {
-            log(ERROR, sock, "Error accepting connection: %s", strerror(errno));
+        const int ready = epoll_wait(epoll_fd, events, 64, -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            log(ERROR, sock, "Error polling the extensions: %s", strerror(errno));
             return 1;
         }
-
-        log(INFO, client_sock, "Accepted connection from %s:%d", inet_ntoa(client_addr.sin_addr), ntohs(client_addr.sin_port));
-        set_lsp_extension_socket(client_sock);
-        std::thread t(lsp_handler, client_sock, ssl, server_sock);
-        t.detach();
+        for (int i = 0; i < ready; i++) {
+            const int fd = events[i].data.fd;
+            if (fd != sock) {
+                if (!read_extension(fd, buffers[fd], *queues[fd])) {
+                    close_extension(epoll_fd, fd, *queues[fd]);
+                    buffers.erase(fd);
+                    queues.erase(fd);
+                }
+                continue;
+            }
+            sockaddr_in client_addr;
+            socklen_t client_addr_len = sizeof(client_addr);
+            const auto client_sock = accept4(sock, reinterpret_cast<sockaddr *>(&client_addr), &client_addr_len, SOCK_CLOEXEC);
+            if (client_sock < 0) {
+                log(ERROR, sock, "Error accepting connection: %s", strerror(errno));
+                continue;
+            }
+            if (const long uid = loopback_peer_uid(client_sock); uid != static_cast<long>(geteuid()) && uid != 0) {
+                log(ERROR, client_sock, "Refused extension of uid %ld", uid);
+                close(client_sock);
+                continue;
+            }
+            log(INFO, client_sock, "Accepted connection from %s:%d", inet_ntoa(client_addr.sin_addr), ntohs(client_addr.sin_port));
+            epoll_event client = {.events = EPOLLIN | EPOLLRDHUP, .data = {.fd = client_sock}};
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client_sock, &client) < 0) {
+                log(ERROR, client_sock, "Error polling the extension: %s", strerror(errno));
+                close(client_sock);
+                continue;
+            }
+            buffers[client_sock].clear();
+            open_lsp_extension(client_sock);
+            const auto queue = std::make_shared<extension_queue>();
+            queues[client_sock] = queue;
+            std::thread(handle_extension, client_sock, queue, server_sock, ssl).detach();
+        }
     }
 }
+#if __GNUC__ >= 13
 #pragma GCC diagnostic pop
+#endif
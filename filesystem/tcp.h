@@ -1,19 +1,24 @@
 #pragma once
 #include "../common/io.h"
 #include "../common/log.h"
+#include <atomic>
 #include <condition_variable>
 #include <gnutls/gnutls.h>
 #include <mutex>
+#include <set>
 #include <string>
 
-extern int request_id;
+extern std::atomic<int> request_id;
 extern std::map<int, std::string> messages;
 extern std::map<int, std::condition_variable> conditions;
+// requests which were lost with the connection
+extern std::set<int> failed_requests;
 extern std::mutex condition_mutex;
 
-int connect(std::string host, int port);
 
 int recv_thread(gnutls_session_t ssl, int sock);
+// Wakes up the caller waiting for the response, request_response returns -1.
+void fail_request(int id);
 
 int listen_lsp(int port, int server_sock, gnutls_session_t ssl);
 
@@ -24,9 +29,12 @@ template <typename T> int request_response(int sock, gnutls_session_t ssl, googl
         return -1;
     }
     std::unique_lock<std::mutex> lock(condition_mutex);
-    if (conditions.find(id) == conditions.end()) {
-        conditions[id].wait(lock);
+    conditions[id].wait(lock, [id] { return messages.contains(id) || failed_requests.contains(id); });
+    conditions.erase(id);
+    if (failed_requests.erase(id) > 0) {
+        return -1;
     }
     response->ParseFromString(messages[id]);
+    messages.erase(id);
     return 0;
 }
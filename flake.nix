@@ -36,6 +36,7 @@
           mkdir -p $out/bin
           cp server/server $out/bin/tea-server
           cp filesystem/filesystem $out/bin/tea-fs
+          cp cli/tea-ctl $out/bin/tea-ctl
         '';
       };
     };
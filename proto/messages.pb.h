@@ -0,0 +1,21515 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: messages.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_messages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_messages_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
+class AccessRequest;
+struct AccessRequestDefaultTypeInternal;
+extern AccessRequestDefaultTypeInternal _AccessRequest_default_instance_;
+class AccessResponse;
+struct AccessResponseDefaultTypeInternal;
+extern AccessResponseDefaultTypeInternal _AccessResponse_default_instance_;
+class BatchStatRequest;
+struct BatchStatRequestDefaultTypeInternal;
+extern BatchStatRequestDefaultTypeInternal _BatchStatRequest_default_instance_;
+class BatchStatResponse;
+struct BatchStatResponseDefaultTypeInternal;
+extern BatchStatResponseDefaultTypeInternal _BatchStatResponse_default_instance_;
+class ChmodRequest;
+struct ChmodRequestDefaultTypeInternal;
+extern ChmodRequestDefaultTypeInternal _ChmodRequest_default_instance_;
+class ChmodResponse;
+struct ChmodResponseDefaultTypeInternal;
+extern ChmodResponseDefaultTypeInternal _ChmodResponse_default_instance_;
+class CopyFileRangeRequest;
+struct CopyFileRangeRequestDefaultTypeInternal;
+extern CopyFileRangeRequestDefaultTypeInternal _CopyFileRangeRequest_default_instance_;
+class CopyFileRangeResponse;
+struct CopyFileRangeResponseDefaultTypeInternal;
+extern CopyFileRangeResponseDefaultTypeInternal _CopyFileRangeResponse_default_instance_;
+class CreateRequest;
+struct CreateRequestDefaultTypeInternal;
+extern CreateRequestDefaultTypeInternal _CreateRequest_default_instance_;
+class CreateResponse;
+struct CreateResponseDefaultTypeInternal;
+extern CreateResponseDefaultTypeInternal _CreateResponse_default_instance_;
+class DirEntry;
+struct DirEntryDefaultTypeInternal;
+extern DirEntryDefaultTypeInternal _DirEntry_default_instance_;
+class ExecCancelRequest;
+struct ExecCancelRequestDefaultTypeInternal;
+extern ExecCancelRequestDefaultTypeInternal _ExecCancelRequest_default_instance_;
+class ExecCancelResponse;
+struct ExecCancelResponseDefaultTypeInternal;
+extern ExecCancelResponseDefaultTypeInternal _ExecCancelResponse_default_instance_;
+class ExecRequest;
+struct ExecRequestDefaultTypeInternal;
+extern ExecRequestDefaultTypeInternal _ExecRequest_default_instance_;
+class ExecResponse;
+struct ExecResponseDefaultTypeInternal;
+extern ExecResponseDefaultTypeInternal _ExecResponse_default_instance_;
+class FallocateRequest;
+struct FallocateRequestDefaultTypeInternal;
+extern FallocateRequestDefaultTypeInternal _FallocateRequest_default_instance_;
+class FallocateResponse;
+struct FallocateResponseDefaultTypeInternal;
+extern FallocateResponseDefaultTypeInternal _FallocateResponse_default_instance_;
+class FlockRequest;
+struct FlockRequestDefaultTypeInternal;
+extern FlockRequestDefaultTypeInternal _FlockRequest_default_instance_;
+class FlockResponse;
+struct FlockResponseDefaultTypeInternal;
+extern FlockResponseDefaultTypeInternal _FlockResponse_default_instance_;
+class FsyncRequest;
+struct FsyncRequestDefaultTypeInternal;
+extern FsyncRequestDefaultTypeInternal _FsyncRequest_default_instance_;
+class FsyncResponse;
+struct FsyncResponseDefaultTypeInternal;
+extern FsyncResponseDefaultTypeInternal _FsyncResponse_default_instance_;
+class FsyncdirRequest;
+struct FsyncdirRequestDefaultTypeInternal;
+extern FsyncdirRequestDefaultTypeInternal _FsyncdirRequest_default_instance_;
+class FsyncdirResponse;
+struct FsyncdirResponseDefaultTypeInternal;
+extern FsyncdirResponseDefaultTypeInternal _FsyncdirResponse_default_instance_;
+class GetAttrRequest;
+struct GetAttrRequestDefaultTypeInternal;
+extern GetAttrRequestDefaultTypeInternal _GetAttrRequest_default_instance_;
+class GetAttrResponse;
+struct GetAttrResponseDefaultTypeInternal;
+extern GetAttrResponseDefaultTypeInternal _GetAttrResponse_default_instance_;
+class GetxattrRequest;
+struct GetxattrRequestDefaultTypeInternal;
+extern GetxattrRequestDefaultTypeInternal _GetxattrRequest_default_instance_;
+class GetxattrResponse;
+struct GetxattrResponseDefaultTypeInternal;
+extern GetxattrResponseDefaultTypeInternal _GetxattrResponse_default_instance_;
+class InitRequest;
+struct InitRequestDefaultTypeInternal;
+extern InitRequestDefaultTypeInternal _InitRequest_default_instance_;
+class InitResponse;
+struct InitResponseDefaultTypeInternal;
+extern InitResponseDefaultTypeInternal _InitResponse_default_instance_;
+class LinkRequest;
+struct LinkRequestDefaultTypeInternal;
+extern LinkRequestDefaultTypeInternal _LinkRequest_default_instance_;
+class LinkResponse;
+struct LinkResponseDefaultTypeInternal;
+extern LinkResponseDefaultTypeInternal _LinkResponse_default_instance_;
+class ListxattrRequest;
+struct ListxattrRequestDefaultTypeInternal;
+extern ListxattrRequestDefaultTypeInternal _ListxattrRequest_default_instance_;
+class ListxattrResponse;
+struct ListxattrResponseDefaultTypeInternal;
+extern ListxattrResponseDefaultTypeInternal _ListxattrResponse_default_instance_;
+class Lock;
+struct LockDefaultTypeInternal;
+extern LockDefaultTypeInternal _Lock_default_instance_;
+class LockRequest;
+struct LockRequestDefaultTypeInternal;
+extern LockRequestDefaultTypeInternal _LockRequest_default_instance_;
+class LockResponse;
+struct LockResponseDefaultTypeInternal;
+extern LockResponseDefaultTypeInternal _LockResponse_default_instance_;
+class LseekRequest;
+struct LseekRequestDefaultTypeInternal;
+extern LseekRequestDefaultTypeInternal _LseekRequest_default_instance_;
+class LseekResponse;
+struct LseekResponseDefaultTypeInternal;
+extern LseekResponseDefaultTypeInternal _LseekResponse_default_instance_;
+class LspRequest;
+struct LspRequestDefaultTypeInternal;
+extern LspRequestDefaultTypeInternal _LspRequest_default_instance_;
+class LspResponse;
+struct LspResponseDefaultTypeInternal;
+extern LspResponseDefaultTypeInternal _LspResponse_default_instance_;
+class MkdirRequest;
+struct MkdirRequestDefaultTypeInternal;
+extern MkdirRequestDefaultTypeInternal _MkdirRequest_default_instance_;
+class MkdirResponse;
+struct MkdirResponseDefaultTypeInternal;
+extern MkdirResponseDefaultTypeInternal _MkdirResponse_default_instance_;
+class MknodRequest;
+struct MknodRequestDefaultTypeInternal;
+extern MknodRequestDefaultTypeInternal _MknodRequest_default_instance_;
+class MknodResponse;
+struct MknodResponseDefaultTypeInternal;
+extern MknodResponseDefaultTypeInternal _MknodResponse_default_instance_;
+class OpenRequest;
+struct OpenRequestDefaultTypeInternal;
+extern OpenRequestDefaultTypeInternal _OpenRequest_default_instance_;
+class OpenResponse;
+struct OpenResponseDefaultTypeInternal;
+extern OpenResponseDefaultTypeInternal _OpenResponse_default_instance_;
+class OpendirRequest;
+struct OpendirRequestDefaultTypeInternal;
+extern OpendirRequestDefaultTypeInternal _OpendirRequest_default_instance_;
+class OpendirResponse;
+struct OpendirResponseDefaultTypeInternal;
+extern OpendirResponseDefaultTypeInternal _OpendirResponse_default_instance_;
+class ReadDirRequest;
+struct ReadDirRequestDefaultTypeInternal;
+extern ReadDirRequestDefaultTypeInternal _ReadDirRequest_default_instance_;
+class ReadDirResponse;
+struct ReadDirResponseDefaultTypeInternal;
+extern ReadDirResponseDefaultTypeInternal _ReadDirResponse_default_instance_;
+class ReadLinkRequest;
+struct ReadLinkRequestDefaultTypeInternal;
+extern ReadLinkRequestDefaultTypeInternal _ReadLinkRequest_default_instance_;
+class ReadLinkResponse;
+struct ReadLinkResponseDefaultTypeInternal;
+extern ReadLinkResponseDefaultTypeInternal _ReadLinkResponse_default_instance_;
+class ReadRequest;
+struct ReadRequestDefaultTypeInternal;
+extern ReadRequestDefaultTypeInternal _ReadRequest_default_instance_;
+class ReadResponse;
+struct ReadResponseDefaultTypeInternal;
+extern ReadResponseDefaultTypeInternal _ReadResponse_default_instance_;
+class ReleaseRequest;
+struct ReleaseRequestDefaultTypeInternal;
+extern ReleaseRequestDefaultTypeInternal _ReleaseRequest_default_instance_;
+class ReleaseResponse;
+struct ReleaseResponseDefaultTypeInternal;
+extern ReleaseResponseDefaultTypeInternal _ReleaseResponse_default_instance_;
+class ReleasedirRequest;
+struct ReleasedirRequestDefaultTypeInternal;
+extern ReleasedirRequestDefaultTypeInternal _ReleasedirRequest_default_instance_;
+class ReleasedirResponse;
+struct ReleasedirResponseDefaultTypeInternal;
+extern ReleasedirResponseDefaultTypeInternal _ReleasedirResponse_default_instance_;
+class RemovexattrRequest;
+struct RemovexattrRequestDefaultTypeInternal;
+extern RemovexattrRequestDefaultTypeInternal _RemovexattrRequest_default_instance_;
+class RemovexattrResponse;
+struct RemovexattrResponseDefaultTypeInternal;
+extern RemovexattrResponseDefaultTypeInternal _RemovexattrResponse_default_instance_;
+class RenameRequest;
+struct RenameRequestDefaultTypeInternal;
+extern RenameRequestDefaultTypeInternal _RenameRequest_default_instance_;
+class RenameResponse;
+struct RenameResponseDefaultTypeInternal;
+extern RenameResponseDefaultTypeInternal _RenameResponse_default_instance_;
+class RmdirRequest;
+struct RmdirRequestDefaultTypeInternal;
+extern RmdirRequestDefaultTypeInternal _RmdirRequest_default_instance_;
+class RmdirResponse;
+struct RmdirResponseDefaultTypeInternal;
+extern RmdirResponseDefaultTypeInternal _RmdirResponse_default_instance_;
+class SaveRequest;
+struct SaveRequestDefaultTypeInternal;
+extern SaveRequestDefaultTypeInternal _SaveRequest_default_instance_;
+class SaveResponse;
+struct SaveResponseDefaultTypeInternal;
+extern SaveResponseDefaultTypeInternal _SaveResponse_default_instance_;
+class SearchCancelRequest;
+struct SearchCancelRequestDefaultTypeInternal;
+extern SearchCancelRequestDefaultTypeInternal _SearchCancelRequest_default_instance_;
+class SearchCancelResponse;
+struct SearchCancelResponseDefaultTypeInternal;
+extern SearchCancelResponseDefaultTypeInternal _SearchCancelResponse_default_instance_;
+class SearchMatch;
+struct SearchMatchDefaultTypeInternal;
+extern SearchMatchDefaultTypeInternal _SearchMatch_default_instance_;
+class SearchRequest;
+struct SearchRequestDefaultTypeInternal;
+extern SearchRequestDefaultTypeInternal _SearchRequest_default_instance_;
+class SearchResponse;
+struct SearchResponseDefaultTypeInternal;
+extern SearchResponseDefaultTypeInternal _SearchResponse_default_instance_;
+class SetxattrRequest;
+struct SetxattrRequestDefaultTypeInternal;
+extern SetxattrRequestDefaultTypeInternal _SetxattrRequest_default_instance_;
+class SetxattrResponse;
+struct SetxattrResponseDefaultTypeInternal;
+extern SetxattrResponseDefaultTypeInternal _SetxattrResponse_default_instance_;
+class StatfsRequest;
+struct StatfsRequestDefaultTypeInternal;
+extern StatfsRequestDefaultTypeInternal _StatfsRequest_default_instance_;
+class StatfsResponse;
+struct StatfsResponseDefaultTypeInternal;
+extern StatfsResponseDefaultTypeInternal _StatfsResponse_default_instance_;
+class SymlinkRequest;
+struct SymlinkRequestDefaultTypeInternal;
+extern SymlinkRequestDefaultTypeInternal _SymlinkRequest_default_instance_;
+class SymlinkResponse;
+struct SymlinkResponseDefaultTypeInternal;
+extern SymlinkResponseDefaultTypeInternal _SymlinkResponse_default_instance_;
+class TeaConfigFile;
+struct TeaConfigFileDefaultTypeInternal;
+extern TeaConfigFileDefaultTypeInternal _TeaConfigFile_default_instance_;
+class TeaConfigFile_LanguageConfigsEntry_DoNotUse;
+struct TeaConfigFile_LanguageConfigsEntry_DoNotUseDefaultTypeInternal;
+extern TeaConfigFile_LanguageConfigsEntry_DoNotUseDefaultTypeInternal _TeaConfigFile_LanguageConfigsEntry_DoNotUse_default_instance_;
+class TruncateRequest;
+struct TruncateRequestDefaultTypeInternal;
+extern TruncateRequestDefaultTypeInternal _TruncateRequest_default_instance_;
+class TruncateResponse;
+struct TruncateResponseDefaultTypeInternal;
+extern TruncateResponseDefaultTypeInternal _TruncateResponse_default_instance_;
+class UnlinkRequest;
+struct UnlinkRequestDefaultTypeInternal;
+extern UnlinkRequestDefaultTypeInternal _UnlinkRequest_default_instance_;
+class UnlinkResponse;
+struct UnlinkResponseDefaultTypeInternal;
+extern UnlinkResponseDefaultTypeInternal _UnlinkResponse_default_instance_;
+class UtimensRequest;
+struct UtimensRequestDefaultTypeInternal;
+extern UtimensRequestDefaultTypeInternal _UtimensRequest_default_instance_;
+class UtimensResponse;
+struct UtimensResponseDefaultTypeInternal;
+extern UtimensResponseDefaultTypeInternal _UtimensResponse_default_instance_;
+class WriteRequest;
+struct WriteRequestDefaultTypeInternal;
+extern WriteRequestDefaultTypeInternal _WriteRequest_default_instance_;
+class WriteResponse;
+struct WriteResponseDefaultTypeInternal;
+extern WriteResponseDefaultTypeInternal _WriteResponse_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::AccessRequest* Arena::CreateMaybeMessage<::AccessRequest>(Arena*);
+template<> ::AccessResponse* Arena::CreateMaybeMessage<::AccessResponse>(Arena*);
+template<> ::BatchStatRequest* Arena::CreateMaybeMessage<::BatchStatRequest>(Arena*);
+template<> ::BatchStatResponse* Arena::CreateMaybeMessage<::BatchStatResponse>(Arena*);
+template<> ::ChmodRequest* Arena::CreateMaybeMessage<::ChmodRequest>(Arena*);
+template<> ::ChmodResponse* Arena::CreateMaybeMessage<::ChmodResponse>(Arena*);
+template<> ::CopyFileRangeRequest* Arena::CreateMaybeMessage<::CopyFileRangeRequest>(Arena*);
+template<> ::CopyFileRangeResponse* Arena::CreateMaybeMessage<::CopyFileRangeResponse>(Arena*);
+template<> ::CreateRequest* Arena::CreateMaybeMessage<::CreateRequest>(Arena*);
+template<> ::CreateResponse* Arena::CreateMaybeMessage<::CreateResponse>(Arena*);
+template<> ::DirEntry* Arena::CreateMaybeMessage<::DirEntry>(Arena*);
+template<> ::ExecCancelRequest* Arena::CreateMaybeMessage<::ExecCancelRequest>(Arena*);
+template<> ::ExecCancelResponse* Arena::CreateMaybeMessage<::ExecCancelResponse>(Arena*);
+template<> ::ExecRequest* Arena::CreateMaybeMessage<::ExecRequest>(Arena*);
+template<> ::ExecResponse* Arena::CreateMaybeMessage<::ExecResponse>(Arena*);
+template<> ::FallocateRequest* Arena::CreateMaybeMessage<::FallocateRequest>(Arena*);
+template<> ::FallocateResponse* Arena::CreateMaybeMessage<::FallocateResponse>(Arena*);
+template<> ::FlockRequest* Arena::CreateMaybeMessage<::FlockRequest>(Arena*);
+template<> ::FlockResponse* Arena::CreateMaybeMessage<::FlockResponse>(Arena*);
+template<> ::FsyncRequest* Arena::CreateMaybeMessage<::FsyncRequest>(Arena*);
+template<> ::FsyncResponse* Arena::CreateMaybeMessage<::FsyncResponse>(Arena*);
+template<> ::FsyncdirRequest* Arena::CreateMaybeMessage<::FsyncdirRequest>(Arena*);
+template<> ::FsyncdirResponse* Arena::CreateMaybeMessage<::FsyncdirResponse>(Arena*);
+template<> ::GetAttrRequest* Arena::CreateMaybeMessage<::GetAttrRequest>(Arena*);
+template<> ::GetAttrResponse* Arena::CreateMaybeMessage<::GetAttrResponse>(Arena*);
+template<> ::GetxattrRequest* Arena::CreateMaybeMessage<::GetxattrRequest>(Arena*);
+template<> ::GetxattrResponse* Arena::CreateMaybeMessage<::GetxattrResponse>(Arena*);
+template<> ::InitRequest* Arena::CreateMaybeMessage<::InitRequest>(Arena*);
+template<> ::InitResponse* Arena::CreateMaybeMessage<::InitResponse>(Arena*);
+template<> ::LinkRequest* Arena::CreateMaybeMessage<::LinkRequest>(Arena*);
+template<> ::LinkResponse* Arena::CreateMaybeMessage<::LinkResponse>(Arena*);
+template<> ::ListxattrRequest* Arena::CreateMaybeMessage<::ListxattrRequest>(Arena*);
+template<> ::ListxattrResponse* Arena::CreateMaybeMessage<::ListxattrResponse>(Arena*);
+template<> ::Lock* Arena::CreateMaybeMessage<::Lock>(Arena*);
+template<> ::LockRequest* Arena::CreateMaybeMessage<::LockRequest>(Arena*);
+template<> ::LockResponse* Arena::CreateMaybeMessage<::LockResponse>(Arena*);
+template<> ::LseekRequest* Arena::CreateMaybeMessage<::LseekRequest>(Arena*);
+template<> ::LseekResponse* Arena::CreateMaybeMessage<::LseekResponse>(Arena*);
+template<> ::LspRequest* Arena::CreateMaybeMessage<::LspRequest>(Arena*);
+template<> ::LspResponse* Arena::CreateMaybeMessage<::LspResponse>(Arena*);
+template<> ::MkdirRequest* Arena::CreateMaybeMessage<::MkdirRequest>(Arena*);
+template<> ::MkdirResponse* Arena::CreateMaybeMessage<::MkdirResponse>(Arena*);
+template<> ::MknodRequest* Arena::CreateMaybeMessage<::MknodRequest>(Arena*);
+template<> ::MknodResponse* Arena::CreateMaybeMessage<::MknodResponse>(Arena*);
+template<> ::OpenRequest* Arena::CreateMaybeMessage<::OpenRequest>(Arena*);
+template<> ::OpenResponse* Arena::CreateMaybeMessage<::OpenResponse>(Arena*);
+template<> ::OpendirRequest* Arena::CreateMaybeMessage<::OpendirRequest>(Arena*);
+template<> ::OpendirResponse* Arena::CreateMaybeMessage<::OpendirResponse>(Arena*);
+template<> ::ReadDirRequest* Arena::CreateMaybeMessage<::ReadDirRequest>(Arena*);
+template<> ::ReadDirResponse* Arena::CreateMaybeMessage<::ReadDirResponse>(Arena*);
+template<> ::ReadLinkRequest* Arena::CreateMaybeMessage<::ReadLinkRequest>(Arena*);
+template<> ::ReadLinkResponse* Arena::CreateMaybeMessage<::ReadLinkResponse>(Arena*);
+template<> ::ReadRequest* Arena::CreateMaybeMessage<::ReadRequest>(Arena*);
+template<> ::ReadResponse* Arena::CreateMaybeMessage<::ReadResponse>(Arena*);
+template<> ::ReleaseRequest* Arena::CreateMaybeMessage<::ReleaseRequest>(Arena*);
+template<> ::ReleaseResponse* Arena::CreateMaybeMessage<::ReleaseResponse>(Arena*);
+template<> ::ReleasedirRequest* Arena::CreateMaybeMessage<::ReleasedirRequest>(Arena*);
+template<> ::ReleasedirResponse* Arena::CreateMaybeMessage<::ReleasedirResponse>(Arena*);
+template<> ::RemovexattrRequest* Arena::CreateMaybeMessage<::RemovexattrRequest>(Arena*);
+template<> ::RemovexattrResponse* Arena::CreateMaybeMessage<::RemovexattrResponse>(Arena*);
+template<> ::RenameRequest* Arena::CreateMaybeMessage<::RenameRequest>(Arena*);
+template<> ::RenameResponse* Arena::CreateMaybeMessage<::RenameResponse>(Arena*);
+template<> ::RmdirRequest* Arena::CreateMaybeMessage<::RmdirRequest>(Arena*);
+template<> ::RmdirResponse* Arena::CreateMaybeMessage<::RmdirResponse>(Arena*);
+template<> ::SaveRequest* Arena::CreateMaybeMessage<::SaveRequest>(Arena*);
+template<> ::SaveResponse* Arena::CreateMaybeMessage<::SaveResponse>(Arena*);
+template<> ::SearchCancelRequest* Arena::CreateMaybeMessage<::SearchCancelRequest>(Arena*);
+template<> ::SearchCancelResponse* Arena::CreateMaybeMessage<::SearchCancelResponse>(Arena*);
+template<> ::SearchMatch* Arena::CreateMaybeMessage<::SearchMatch>(Arena*);
+template<> ::SearchRequest* Arena::CreateMaybeMessage<::SearchRequest>(Arena*);
+template<> ::SearchResponse* Arena::CreateMaybeMessage<::SearchResponse>(Arena*);
+template<> ::SetxattrRequest* Arena::CreateMaybeMessage<::SetxattrRequest>(Arena*);
+template<> ::SetxattrResponse* Arena::CreateMaybeMessage<::SetxattrResponse>(Arena*);
+template<> ::StatfsRequest* Arena::CreateMaybeMessage<::StatfsRequest>(Arena*);
+template<> ::StatfsResponse* Arena::CreateMaybeMessage<::StatfsResponse>(Arena*);
+template<> ::SymlinkRequest* Arena::CreateMaybeMessage<::SymlinkRequest>(Arena*);
+template<> ::SymlinkResponse* Arena::CreateMaybeMessage<::SymlinkResponse>(Arena*);
+template<> ::TeaConfigFile* Arena::CreateMaybeMessage<::TeaConfigFile>(Arena*);
+template<> ::TeaConfigFile_LanguageConfigsEntry_DoNotUse* Arena::CreateMaybeMessage<::TeaConfigFile_LanguageConfigsEntry_DoNotUse>(Arena*);
+template<> ::TruncateRequest* Arena::CreateMaybeMessage<::TruncateRequest>(Arena*);
+template<> ::TruncateResponse* Arena::CreateMaybeMessage<::TruncateResponse>(Arena*);
+template<> ::UnlinkRequest* Arena::CreateMaybeMessage<::UnlinkRequest>(Arena*);
+template<> ::UnlinkResponse* Arena::CreateMaybeMessage<::UnlinkResponse>(Arena*);
+template<> ::UtimensRequest* Arena::CreateMaybeMessage<::UtimensRequest>(Arena*);
+template<> ::UtimensResponse* Arena::CreateMaybeMessage<::UtimensResponse>(Arena*);
+template<> ::WriteRequest* Arena::CreateMaybeMessage<::WriteRequest>(Arena*);
+template<> ::WriteResponse* Arena::CreateMaybeMessage<::WriteResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum Type : int {
+  INIT_REQUEST = 0,
+  INIT_RESPONSE = 1,
+  GET_ATTR_REQUEST = 2,
+  GET_ATTR_RESPONSE = 3,
+  OPEN_REQUEST = 4,
+  OPEN_RESPONSE = 5,
+  RELEASE_REQUEST = 6,
+  RELEASE_RESPONSE = 7,
+  READ_DIR_REQUEST = 8,
+  READ_DIR_RESPONSE = 9,
+  READ_REQUEST = 10,
+  READ_RESPONSE = 11,
+  WRITE_REQUEST = 12,
+  WRITE_RESPONSE = 13,
+  CREATE_REQUEST = 14,
+  CREATE_RESPONSE = 15,
+  MKDIR_REQUEST = 16,
+  MKDIR_RESPONSE = 17,
+  UNLINK_REQUEST = 18,
+  UNLINK_RESPONSE = 19,
+  RMDIR_REQUEST = 20,
+  RMDIR_RESPONSE = 21,
+  RENAME_REQUEST = 22,
+  RENAME_RESPONSE = 23,
+  CHMOD_REQUEST = 24,
+  CHMOD_RESPONSE = 25,
+  TRUNCATE_REQUEST = 26,
+  TRUNCATE_RESPONSE = 27,
+  MKNOD_REQUEST = 28,
+  MKNOD_RESPONSE = 29,
+  LINK_REQUEST = 30,
+  LINK_RESPONSE = 31,
+  SYMLINK_REQUEST = 32,
+  SYMLINK_RESPONSE = 33,
+  READ_LINK_REQUEST = 34,
+  READ_LINK_RESPONSE = 35,
+  STATFS_REQUEST = 36,
+  STATFS_RESPONSE = 37,
+  FSYNC_REQUEST = 38,
+  FSYNC_RESPONSE = 39,
+  SETXATTR_REQUEST = 40,
+  SETXATTR_RESPONSE = 41,
+  GETXATTR_REQUEST = 42,
+  GETXATTR_RESPONSE = 43,
+  LISTXATTR_REQUEST = 44,
+  LISTXATTR_RESPONSE = 45,
+  REMOVEXATTR_REQUEST = 46,
+  REMOVEXATTR_RESPONSE = 47,
+  OPENDIR_REQUEST = 48,
+  OPENDIR_RESPONSE = 49,
+  RELEASEDIR_REQUEST = 50,
+  RELEASEDIR_RESPONSE = 51,
+  FSYNCDIR_REQUEST = 52,
+  FSYNCDIR_RESPONSE = 53,
+  UTIMENS_REQUEST = 54,
+  UTIMENS_RESPONSE = 55,
+  ACCESS_REQUEST = 56,
+  ACCESS_RESPONSE = 57,
+  LOCK_REQUEST = 58,
+  LOCK_RESPONSE = 59,
+  FLOCK_REQUEST = 60,
+  FLOCK_RESPONSE = 61,
+  FALLOCATE_REQUEST = 62,
+  FALLOCATE_RESPONSE = 63,
+  LSEEK_REQUEST = 64,
+  LSEEK_RESPONSE = 65,
+  LSP_REQUEST = 66,
+  LSP_RESPONSE = 67,
+  COPY_FILE_RANGE_REQUEST = 68,
+  COPY_FILE_RANGE_RESPONSE = 69,
+  SEARCH_REQUEST = 70,
+  SEARCH_RESPONSE = 71,
+  SEARCH_CANCEL_REQUEST = 72,
+  SEARCH_CANCEL_RESPONSE = 73,
+  BATCH_STAT_REQUEST = 74,
+  BATCH_STAT_RESPONSE = 75,
+  SAVE_REQUEST = 76,
+  SAVE_RESPONSE = 77,
+  EXEC_REQUEST = 78,
+  EXEC_RESPONSE = 79,
+  EXEC_CANCEL_REQUEST = 80,
+  EXEC_CANCEL_RESPONSE = 81,
+  Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Type_IsValid(int value);
+constexpr Type Type_MIN = INIT_REQUEST;
+constexpr Type Type_MAX = EXEC_CANCEL_RESPONSE;
+constexpr int Type_ARRAYSIZE = Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor();
+template<typename T>
+inline const std::string& Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Type_descriptor(), enum_t_value);
+}
+inline bool Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Type>(
+    Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class InitRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:InitRequest) */ {
+ public:
+  inline InitRequest() : InitRequest(nullptr) {}
+  ~InitRequest() override;
+  explicit PROTOBUF_CONSTEXPR InitRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InitRequest(const InitRequest& from);
+  InitRequest(InitRequest&& from) noexcept
+    : InitRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline InitRequest& operator=(const InitRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InitRequest& operator=(InitRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InitRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InitRequest* internal_default_instance() {
+    return reinterpret_cast<const InitRequest*>(
+               &_InitRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(InitRequest& a, InitRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InitRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InitRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InitRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InitRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InitRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InitRequest& from) {
+    InitRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InitRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "InitRequest";
+  }
+  protected:
+  explicit InitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kExportNameFieldNumber = 4,
+    kCreditBytesFieldNumber = 3,
+    kCreditsFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string export_name = 4;
+  void clear_export_name();
+  const std::string& export_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_export_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_export_name();
+  PROTOBUF_NODISCARD std::string* release_export_name();
+  void set_allocated_export_name(std::string* export_name);
+  private:
+  const std::string& _internal_export_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_export_name(const std::string& value);
+  std::string* _internal_mutable_export_name();
+  public:
+
+  // int64 credit_bytes = 3;
+  void clear_credit_bytes();
+  int64_t credit_bytes() const;
+  void set_credit_bytes(int64_t value);
+  private:
+  int64_t _internal_credit_bytes() const;
+  void _internal_set_credit_bytes(int64_t value);
+  public:
+
+  // int32 credits = 2;
+  void clear_credits();
+  int32_t credits() const;
+  void set_credits(int32_t value);
+  private:
+  int32_t _internal_credits() const;
+  void _internal_set_credits(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:InitRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr export_name_;
+    int64_t credit_bytes_;
+    int32_t credits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InitResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:InitResponse) */ {
+ public:
+  inline InitResponse() : InitResponse(nullptr) {}
+  ~InitResponse() override;
+  explicit PROTOBUF_CONSTEXPR InitResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InitResponse(const InitResponse& from);
+  InitResponse(InitResponse&& from) noexcept
+    : InitResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InitResponse& operator=(const InitResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InitResponse& operator=(InitResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InitResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InitResponse* internal_default_instance() {
+    return reinterpret_cast<const InitResponse*>(
+               &_InitResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(InitResponse& a, InitResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InitResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InitResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InitResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InitResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InitResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InitResponse& from) {
+    InitResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InitResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "InitResponse";
+  }
+  protected:
+  explicit InitResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInstanceFieldNumber = 2,
+    kErrorFieldNumber = 1,
+    kCreditsFieldNumber = 3,
+    kCreditBytesFieldNumber = 4,
+  };
+  // uint64 instance = 2;
+  void clear_instance();
+  uint64_t instance() const;
+  void set_instance(uint64_t value);
+  private:
+  uint64_t _internal_instance() const;
+  void _internal_set_instance(uint64_t value);
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 credits = 3;
+  void clear_credits();
+  int32_t credits() const;
+  void set_credits(int32_t value);
+  private:
+  int32_t _internal_credits() const;
+  void _internal_set_credits(int32_t value);
+  public:
+
+  // int64 credit_bytes = 4;
+  void clear_credit_bytes();
+  int64_t credit_bytes() const;
+  void set_credit_bytes(int64_t value);
+  private:
+  int64_t _internal_credit_bytes() const;
+  void _internal_set_credit_bytes(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:InitResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t instance_;
+    int32_t error_;
+    int32_t credits_;
+    int64_t credit_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetAttrRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GetAttrRequest) */ {
+ public:
+  inline GetAttrRequest() : GetAttrRequest(nullptr) {}
+  ~GetAttrRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetAttrRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetAttrRequest(const GetAttrRequest& from);
+  GetAttrRequest(GetAttrRequest&& from) noexcept
+    : GetAttrRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAttrRequest& operator=(const GetAttrRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetAttrRequest& operator=(GetAttrRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttrRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetAttrRequest* internal_default_instance() {
+    return reinterpret_cast<const GetAttrRequest*>(
+               &_GetAttrRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(GetAttrRequest& a, GetAttrRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetAttrRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttrRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetAttrRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetAttrRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetAttrRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttrRequest& from) {
+    GetAttrRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetAttrRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GetAttrRequest";
+  }
+  protected:
+  explicit GetAttrRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:GetAttrRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetAttrResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GetAttrResponse) */ {
+ public:
+  inline GetAttrResponse() : GetAttrResponse(nullptr) {}
+  ~GetAttrResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetAttrResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetAttrResponse(const GetAttrResponse& from);
+  GetAttrResponse(GetAttrResponse&& from) noexcept
+    : GetAttrResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAttrResponse& operator=(const GetAttrResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetAttrResponse& operator=(GetAttrResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttrResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetAttrResponse* internal_default_instance() {
+    return reinterpret_cast<const GetAttrResponse*>(
+               &_GetAttrResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(GetAttrResponse& a, GetAttrResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetAttrResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttrResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetAttrResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetAttrResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetAttrResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttrResponse& from) {
+    GetAttrResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetAttrResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GetAttrResponse";
+  }
+  protected:
+  explicit GetAttrResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kModeFieldNumber = 2,
+    kSizeFieldNumber = 4,
+    kAtimeFieldNumber = 5,
+    kMtimeFieldNumber = 6,
+    kNlinkFieldNumber = 3,
+    kOwnFieldNumber = 8,
+    kGownFieldNumber = 9,
+    kCtimeFieldNumber = 7,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // int64 size = 4;
+  void clear_size();
+  int64_t size() const;
+  void set_size(int64_t value);
+  private:
+  int64_t _internal_size() const;
+  void _internal_set_size(int64_t value);
+  public:
+
+  // int64 atime = 5;
+  void clear_atime();
+  int64_t atime() const;
+  void set_atime(int64_t value);
+  private:
+  int64_t _internal_atime() const;
+  void _internal_set_atime(int64_t value);
+  public:
+
+  // int64 mtime = 6;
+  void clear_mtime();
+  int64_t mtime() const;
+  void set_mtime(int64_t value);
+  private:
+  int64_t _internal_mtime() const;
+  void _internal_set_mtime(int64_t value);
+  public:
+
+  // int32 nlink = 3;
+  void clear_nlink();
+  int32_t nlink() const;
+  void set_nlink(int32_t value);
+  private:
+  int32_t _internal_nlink() const;
+  void _internal_set_nlink(int32_t value);
+  public:
+
+  // bool own = 8;
+  void clear_own();
+  bool own() const;
+  void set_own(bool value);
+  private:
+  bool _internal_own() const;
+  void _internal_set_own(bool value);
+  public:
+
+  // bool gown = 9;
+  void clear_gown();
+  bool gown() const;
+  void set_gown(bool value);
+  private:
+  bool _internal_gown() const;
+  void _internal_set_gown(bool value);
+  public:
+
+  // int64 ctime = 7;
+  void clear_ctime();
+  int64_t ctime() const;
+  void set_ctime(int64_t value);
+  private:
+  int64_t _internal_ctime() const;
+  void _internal_set_ctime(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:GetAttrResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t mode_;
+    int64_t size_;
+    int64_t atime_;
+    int64_t mtime_;
+    int32_t nlink_;
+    bool own_;
+    bool gown_;
+    int64_t ctime_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpenRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpenRequest) */ {
+ public:
+  inline OpenRequest() : OpenRequest(nullptr) {}
+  ~OpenRequest() override;
+  explicit PROTOBUF_CONSTEXPR OpenRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpenRequest(const OpenRequest& from);
+  OpenRequest(OpenRequest&& from) noexcept
+    : OpenRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline OpenRequest& operator=(const OpenRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpenRequest& operator=(OpenRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpenRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpenRequest* internal_default_instance() {
+    return reinterpret_cast<const OpenRequest*>(
+               &_OpenRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(OpenRequest& a, OpenRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpenRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpenRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpenRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpenRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpenRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpenRequest& from) {
+    OpenRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpenRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OpenRequest";
+  }
+  protected:
+  explicit OpenRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kFlagsFieldNumber = 2,
+    kPassthroughFieldNumber = 3,
+    kTokenFieldNumber = 4,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 flags = 2;
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // bool passthrough = 3;
+  void clear_passthrough();
+  bool passthrough() const;
+  void set_passthrough(bool value);
+  private:
+  bool _internal_passthrough() const;
+  void _internal_set_passthrough(bool value);
+  public:
+
+  // uint64 token = 4;
+  void clear_token();
+  uint64_t token() const;
+  void set_token(uint64_t value);
+  private:
+  uint64_t _internal_token() const;
+  void _internal_set_token(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:OpenRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t flags_;
+    bool passthrough_;
+    uint64_t token_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpenResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpenResponse) */ {
+ public:
+  inline OpenResponse() : OpenResponse(nullptr) {}
+  ~OpenResponse() override;
+  explicit PROTOBUF_CONSTEXPR OpenResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpenResponse(const OpenResponse& from);
+  OpenResponse(OpenResponse&& from) noexcept
+    : OpenResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline OpenResponse& operator=(const OpenResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpenResponse& operator=(OpenResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpenResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpenResponse* internal_default_instance() {
+    return reinterpret_cast<const OpenResponse*>(
+               &_OpenResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(OpenResponse& a, OpenResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpenResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpenResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpenResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpenResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpenResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpenResponse& from) {
+    OpenResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpenResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OpenResponse";
+  }
+  protected:
+  explicit OpenResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kFdFieldNumber = 2,
+    kPassthroughFieldNumber = 3,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 fd = 2;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // bool passthrough = 3;
+  void clear_passthrough();
+  bool passthrough() const;
+  void set_passthrough(bool value);
+  private:
+  bool _internal_passthrough() const;
+  void _internal_set_passthrough(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:OpenResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t fd_;
+    bool passthrough_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReleaseRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReleaseRequest) */ {
+ public:
+  inline ReleaseRequest() : ReleaseRequest(nullptr) {}
+  ~ReleaseRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReleaseRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReleaseRequest(const ReleaseRequest& from);
+  ReleaseRequest(ReleaseRequest&& from) noexcept
+    : ReleaseRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReleaseRequest& operator=(const ReleaseRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReleaseRequest& operator=(ReleaseRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleaseRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReleaseRequest* internal_default_instance() {
+    return reinterpret_cast<const ReleaseRequest*>(
+               &_ReleaseRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ReleaseRequest& a, ReleaseRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReleaseRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReleaseRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReleaseRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReleaseRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReleaseRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleaseRequest& from) {
+    ReleaseRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReleaseRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReleaseRequest";
+  }
+  protected:
+  explicit ReleaseRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFdFieldNumber = 1,
+  };
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReleaseRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t fd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReleaseResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReleaseResponse) */ {
+ public:
+  inline ReleaseResponse() : ReleaseResponse(nullptr) {}
+  ~ReleaseResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReleaseResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReleaseResponse(const ReleaseResponse& from);
+  ReleaseResponse(ReleaseResponse&& from) noexcept
+    : ReleaseResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReleaseResponse& operator=(const ReleaseResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReleaseResponse& operator=(ReleaseResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleaseResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReleaseResponse* internal_default_instance() {
+    return reinterpret_cast<const ReleaseResponse*>(
+               &_ReleaseResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ReleaseResponse& a, ReleaseResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReleaseResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReleaseResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReleaseResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReleaseResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReleaseResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleaseResponse& from) {
+    ReleaseResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReleaseResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReleaseResponse";
+  }
+  protected:
+  explicit ReleaseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReleaseResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadDirRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadDirRequest) */ {
+ public:
+  inline ReadDirRequest() : ReadDirRequest(nullptr) {}
+  ~ReadDirRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadDirRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadDirRequest(const ReadDirRequest& from);
+  ReadDirRequest(ReadDirRequest&& from) noexcept
+    : ReadDirRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadDirRequest& operator=(const ReadDirRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadDirRequest& operator=(ReadDirRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadDirRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadDirRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadDirRequest*>(
+               &_ReadDirRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ReadDirRequest& a, ReadDirRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadDirRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadDirRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadDirRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadDirRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadDirRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadDirRequest& from) {
+    ReadDirRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadDirRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadDirRequest";
+  }
+  protected:
+  explicit ReadDirRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kDirectoryDescriptorFieldNumber = 1,
+    kSizeFieldNumber = 3,
+  };
+  // int64 offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 directory_descriptor = 1;
+  void clear_directory_descriptor();
+  int32_t directory_descriptor() const;
+  void set_directory_descriptor(int32_t value);
+  private:
+  int32_t _internal_directory_descriptor() const;
+  void _internal_set_directory_descriptor(int32_t value);
+  public:
+
+  // int32 size = 3;
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReadDirRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_;
+    int32_t directory_descriptor_;
+    int32_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DirEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:DirEntry) */ {
+ public:
+  inline DirEntry() : DirEntry(nullptr) {}
+  ~DirEntry() override;
+  explicit PROTOBUF_CONSTEXPR DirEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DirEntry(const DirEntry& from);
+  DirEntry(DirEntry&& from) noexcept
+    : DirEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline DirEntry& operator=(const DirEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DirEntry& operator=(DirEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DirEntry* internal_default_instance() {
+    return reinterpret_cast<const DirEntry*>(
+               &_DirEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(DirEntry& a, DirEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DirEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DirEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DirEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DirEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirEntry& from) {
+    DirEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DirEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "DirEntry";
+  }
+  protected:
+  explicit DirEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+    kTypeFieldNumber = 3,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // int64 offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 type = 3;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:DirEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t offset_;
+    int32_t type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadDirResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadDirResponse) */ {
+ public:
+  inline ReadDirResponse() : ReadDirResponse(nullptr) {}
+  ~ReadDirResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadDirResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadDirResponse(const ReadDirResponse& from);
+  ReadDirResponse(ReadDirResponse&& from) noexcept
+    : ReadDirResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadDirResponse& operator=(const ReadDirResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadDirResponse& operator=(ReadDirResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadDirResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadDirResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadDirResponse*>(
+               &_ReadDirResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ReadDirResponse& a, ReadDirResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadDirResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadDirResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadDirResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadDirResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadDirResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadDirResponse& from) {
+    ReadDirResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadDirResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadDirResponse";
+  }
+  protected:
+  explicit ReadDirResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 2,
+    kErrorFieldNumber = 1,
+    kEofFieldNumber = 3,
+  };
+  // repeated .DirEntry entries = 2;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::DirEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DirEntry >*
+      mutable_entries();
+  private:
+  const ::DirEntry& _internal_entries(int index) const;
+  ::DirEntry* _internal_add_entries();
+  public:
+  const ::DirEntry& entries(int index) const;
+  ::DirEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DirEntry >&
+      entries() const;
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // bool eof = 3;
+  void clear_eof();
+  bool eof() const;
+  void set_eof(bool value);
+  private:
+  bool _internal_eof() const;
+  void _internal_set_eof(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReadDirResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DirEntry > entries_;
+    int32_t error_;
+    bool eof_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadRequest) */ {
+ public:
+  inline ReadRequest() : ReadRequest(nullptr) {}
+  ~ReadRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadRequest(const ReadRequest& from);
+  ReadRequest(ReadRequest&& from) noexcept
+    : ReadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadRequest& operator=(const ReadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadRequest& operator=(ReadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadRequest*>(
+               &_ReadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ReadRequest& a, ReadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadRequest& from) {
+    ReadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadRequest";
+  }
+  protected:
+  explicit ReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kFdFieldNumber = 1,
+    kSizeFieldNumber = 3,
+  };
+  // int64 offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // int32 size = 3;
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_;
+    int32_t fd_;
+    int32_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadResponse) */ {
+ public:
+  inline ReadResponse() : ReadResponse(nullptr) {}
+  ~ReadResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadResponse(const ReadResponse& from);
+  ReadResponse(ReadResponse&& from) noexcept
+    : ReadResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadResponse& operator=(const ReadResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadResponse& operator=(ReadResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadResponse*>(
+               &_ReadResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ReadResponse& a, ReadResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadResponse& from) {
+    ReadResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadResponse";
+  }
+  protected:
+  explicit ReadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // bytes data = 2;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReadResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteRequest) */ {
+ public:
+  inline WriteRequest() : WriteRequest(nullptr) {}
+  ~WriteRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteRequest(const WriteRequest& from);
+  WriteRequest(WriteRequest&& from) noexcept
+    : WriteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteRequest& operator=(const WriteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteRequest& operator=(WriteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteRequest*>(
+               &_WriteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(WriteRequest& a, WriteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteRequest& from) {
+    WriteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteRequest";
+  }
+  protected:
+  explicit WriteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kOffsetFieldNumber = 2,
+    kFdFieldNumber = 1,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // int64 offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:WriteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int64_t offset_;
+    int32_t fd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteResponse) */ {
+ public:
+  inline WriteResponse() : WriteResponse(nullptr) {}
+  ~WriteResponse() override;
+  explicit PROTOBUF_CONSTEXPR WriteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteResponse(const WriteResponse& from);
+  WriteResponse(WriteResponse&& from) noexcept
+    : WriteResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteResponse& operator=(const WriteResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteResponse& operator=(WriteResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteResponse* internal_default_instance() {
+    return reinterpret_cast<const WriteResponse*>(
+               &_WriteResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(WriteResponse& a, WriteResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteResponse& from) {
+    WriteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteResponse";
+  }
+  protected:
+  explicit WriteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kSizeFieldNumber = 2,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 size = 2;
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:WriteResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CreateRequest) */ {
+ public:
+  inline CreateRequest() : CreateRequest(nullptr) {}
+  ~CreateRequest() override;
+  explicit PROTOBUF_CONSTEXPR CreateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateRequest(const CreateRequest& from);
+  CreateRequest(CreateRequest&& from) noexcept
+    : CreateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateRequest& operator=(const CreateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateRequest& operator=(CreateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateRequest* internal_default_instance() {
+    return reinterpret_cast<const CreateRequest*>(
+               &_CreateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CreateRequest& a, CreateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateRequest& from) {
+    CreateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CreateRequest";
+  }
+  protected:
+  explicit CreateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kModeFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CreateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CreateResponse) */ {
+ public:
+  inline CreateResponse() : CreateResponse(nullptr) {}
+  ~CreateResponse() override;
+  explicit PROTOBUF_CONSTEXPR CreateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateResponse(const CreateResponse& from);
+  CreateResponse(CreateResponse&& from) noexcept
+    : CreateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateResponse& operator=(const CreateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateResponse& operator=(CreateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateResponse* internal_default_instance() {
+    return reinterpret_cast<const CreateResponse*>(
+               &_CreateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CreateResponse& a, CreateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateResponse& from) {
+    CreateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CreateResponse";
+  }
+  protected:
+  explicit CreateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kFdFieldNumber = 2,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 fd = 2;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CreateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t fd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MkdirRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MkdirRequest) */ {
+ public:
+  inline MkdirRequest() : MkdirRequest(nullptr) {}
+  ~MkdirRequest() override;
+  explicit PROTOBUF_CONSTEXPR MkdirRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MkdirRequest(const MkdirRequest& from);
+  MkdirRequest(MkdirRequest&& from) noexcept
+    : MkdirRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MkdirRequest& operator=(const MkdirRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MkdirRequest& operator=(MkdirRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MkdirRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MkdirRequest* internal_default_instance() {
+    return reinterpret_cast<const MkdirRequest*>(
+               &_MkdirRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(MkdirRequest& a, MkdirRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MkdirRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MkdirRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MkdirRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MkdirRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MkdirRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MkdirRequest& from) {
+    MkdirRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MkdirRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MkdirRequest";
+  }
+  protected:
+  explicit MkdirRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kModeFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MkdirRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MkdirResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MkdirResponse) */ {
+ public:
+  inline MkdirResponse() : MkdirResponse(nullptr) {}
+  ~MkdirResponse() override;
+  explicit PROTOBUF_CONSTEXPR MkdirResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MkdirResponse(const MkdirResponse& from);
+  MkdirResponse(MkdirResponse&& from) noexcept
+    : MkdirResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MkdirResponse& operator=(const MkdirResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MkdirResponse& operator=(MkdirResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MkdirResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MkdirResponse* internal_default_instance() {
+    return reinterpret_cast<const MkdirResponse*>(
+               &_MkdirResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(MkdirResponse& a, MkdirResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MkdirResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MkdirResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MkdirResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MkdirResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MkdirResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MkdirResponse& from) {
+    MkdirResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MkdirResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MkdirResponse";
+  }
+  protected:
+  explicit MkdirResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MkdirResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnlinkRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UnlinkRequest) */ {
+ public:
+  inline UnlinkRequest() : UnlinkRequest(nullptr) {}
+  ~UnlinkRequest() override;
+  explicit PROTOBUF_CONSTEXPR UnlinkRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnlinkRequest(const UnlinkRequest& from);
+  UnlinkRequest(UnlinkRequest&& from) noexcept
+    : UnlinkRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UnlinkRequest& operator=(const UnlinkRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnlinkRequest& operator=(UnlinkRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnlinkRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnlinkRequest* internal_default_instance() {
+    return reinterpret_cast<const UnlinkRequest*>(
+               &_UnlinkRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(UnlinkRequest& a, UnlinkRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnlinkRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnlinkRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnlinkRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnlinkRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnlinkRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnlinkRequest& from) {
+    UnlinkRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnlinkRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UnlinkRequest";
+  }
+  protected:
+  explicit UnlinkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:UnlinkRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnlinkResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UnlinkResponse) */ {
+ public:
+  inline UnlinkResponse() : UnlinkResponse(nullptr) {}
+  ~UnlinkResponse() override;
+  explicit PROTOBUF_CONSTEXPR UnlinkResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnlinkResponse(const UnlinkResponse& from);
+  UnlinkResponse(UnlinkResponse&& from) noexcept
+    : UnlinkResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline UnlinkResponse& operator=(const UnlinkResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnlinkResponse& operator=(UnlinkResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnlinkResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnlinkResponse* internal_default_instance() {
+    return reinterpret_cast<const UnlinkResponse*>(
+               &_UnlinkResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(UnlinkResponse& a, UnlinkResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnlinkResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnlinkResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnlinkResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnlinkResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnlinkResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnlinkResponse& from) {
+    UnlinkResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnlinkResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UnlinkResponse";
+  }
+  protected:
+  explicit UnlinkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:UnlinkResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RmdirRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RmdirRequest) */ {
+ public:
+  inline RmdirRequest() : RmdirRequest(nullptr) {}
+  ~RmdirRequest() override;
+  explicit PROTOBUF_CONSTEXPR RmdirRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RmdirRequest(const RmdirRequest& from);
+  RmdirRequest(RmdirRequest&& from) noexcept
+    : RmdirRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RmdirRequest& operator=(const RmdirRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RmdirRequest& operator=(RmdirRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RmdirRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RmdirRequest* internal_default_instance() {
+    return reinterpret_cast<const RmdirRequest*>(
+               &_RmdirRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(RmdirRequest& a, RmdirRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RmdirRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RmdirRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RmdirRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RmdirRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RmdirRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RmdirRequest& from) {
+    RmdirRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RmdirRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RmdirRequest";
+  }
+  protected:
+  explicit RmdirRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:RmdirRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RmdirResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RmdirResponse) */ {
+ public:
+  inline RmdirResponse() : RmdirResponse(nullptr) {}
+  ~RmdirResponse() override;
+  explicit PROTOBUF_CONSTEXPR RmdirResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RmdirResponse(const RmdirResponse& from);
+  RmdirResponse(RmdirResponse&& from) noexcept
+    : RmdirResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RmdirResponse& operator=(const RmdirResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RmdirResponse& operator=(RmdirResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RmdirResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RmdirResponse* internal_default_instance() {
+    return reinterpret_cast<const RmdirResponse*>(
+               &_RmdirResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(RmdirResponse& a, RmdirResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RmdirResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RmdirResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RmdirResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RmdirResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RmdirResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RmdirResponse& from) {
+    RmdirResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RmdirResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RmdirResponse";
+  }
+  protected:
+  explicit RmdirResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RmdirResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RenameRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RenameRequest) */ {
+ public:
+  inline RenameRequest() : RenameRequest(nullptr) {}
+  ~RenameRequest() override;
+  explicit PROTOBUF_CONSTEXPR RenameRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RenameRequest(const RenameRequest& from);
+  RenameRequest(RenameRequest&& from) noexcept
+    : RenameRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RenameRequest& operator=(const RenameRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RenameRequest& operator=(RenameRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RenameRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RenameRequest* internal_default_instance() {
+    return reinterpret_cast<const RenameRequest*>(
+               &_RenameRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(RenameRequest& a, RenameRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RenameRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RenameRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RenameRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RenameRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RenameRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RenameRequest& from) {
+    RenameRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RenameRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RenameRequest";
+  }
+  protected:
+  explicit RenameRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOldPathFieldNumber = 1,
+    kNewPathFieldNumber = 2,
+    kFlagsFieldNumber = 3,
+  };
+  // string old_path = 1;
+  void clear_old_path();
+  const std::string& old_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_old_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_old_path();
+  PROTOBUF_NODISCARD std::string* release_old_path();
+  void set_allocated_old_path(std::string* old_path);
+  private:
+  const std::string& _internal_old_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_old_path(const std::string& value);
+  std::string* _internal_mutable_old_path();
+  public:
+
+  // string new_path = 2;
+  void clear_new_path();
+  const std::string& new_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_new_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_new_path();
+  PROTOBUF_NODISCARD std::string* release_new_path();
+  void set_allocated_new_path(std::string* new_path);
+  private:
+  const std::string& _internal_new_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_new_path(const std::string& value);
+  std::string* _internal_mutable_new_path();
+  public:
+
+  // int32 flags = 3;
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RenameRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr old_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr new_path_;
+    int32_t flags_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RenameResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RenameResponse) */ {
+ public:
+  inline RenameResponse() : RenameResponse(nullptr) {}
+  ~RenameResponse() override;
+  explicit PROTOBUF_CONSTEXPR RenameResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RenameResponse(const RenameResponse& from);
+  RenameResponse(RenameResponse&& from) noexcept
+    : RenameResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RenameResponse& operator=(const RenameResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RenameResponse& operator=(RenameResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RenameResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RenameResponse* internal_default_instance() {
+    return reinterpret_cast<const RenameResponse*>(
+               &_RenameResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(RenameResponse& a, RenameResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RenameResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RenameResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RenameResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RenameResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RenameResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RenameResponse& from) {
+    RenameResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RenameResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RenameResponse";
+  }
+  protected:
+  explicit RenameResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RenameResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChmodRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChmodRequest) */ {
+ public:
+  inline ChmodRequest() : ChmodRequest(nullptr) {}
+  ~ChmodRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChmodRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChmodRequest(const ChmodRequest& from);
+  ChmodRequest(ChmodRequest&& from) noexcept
+    : ChmodRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChmodRequest& operator=(const ChmodRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChmodRequest& operator=(ChmodRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChmodRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChmodRequest* internal_default_instance() {
+    return reinterpret_cast<const ChmodRequest*>(
+               &_ChmodRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ChmodRequest& a, ChmodRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChmodRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChmodRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChmodRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChmodRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChmodRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChmodRequest& from) {
+    ChmodRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChmodRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChmodRequest";
+  }
+  protected:
+  explicit ChmodRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kModeFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChmodRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChmodResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChmodResponse) */ {
+ public:
+  inline ChmodResponse() : ChmodResponse(nullptr) {}
+  ~ChmodResponse() override;
+  explicit PROTOBUF_CONSTEXPR ChmodResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChmodResponse(const ChmodResponse& from);
+  ChmodResponse(ChmodResponse&& from) noexcept
+    : ChmodResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ChmodResponse& operator=(const ChmodResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChmodResponse& operator=(ChmodResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChmodResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChmodResponse* internal_default_instance() {
+    return reinterpret_cast<const ChmodResponse*>(
+               &_ChmodResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(ChmodResponse& a, ChmodResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChmodResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChmodResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChmodResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChmodResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChmodResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChmodResponse& from) {
+    ChmodResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChmodResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChmodResponse";
+  }
+  protected:
+  explicit ChmodResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChmodResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TruncateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TruncateRequest) */ {
+ public:
+  inline TruncateRequest() : TruncateRequest(nullptr) {}
+  ~TruncateRequest() override;
+  explicit PROTOBUF_CONSTEXPR TruncateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TruncateRequest(const TruncateRequest& from);
+  TruncateRequest(TruncateRequest&& from) noexcept
+    : TruncateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TruncateRequest& operator=(const TruncateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TruncateRequest& operator=(TruncateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TruncateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TruncateRequest* internal_default_instance() {
+    return reinterpret_cast<const TruncateRequest*>(
+               &_TruncateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(TruncateRequest& a, TruncateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TruncateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TruncateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TruncateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TruncateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TruncateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TruncateRequest& from) {
+    TruncateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TruncateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TruncateRequest";
+  }
+  protected:
+  explicit TruncateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kSizeFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int64 size = 2;
+  void clear_size();
+  int64_t size() const;
+  void set_size(int64_t value);
+  private:
+  int64_t _internal_size() const;
+  void _internal_set_size(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TruncateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int64_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TruncateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TruncateResponse) */ {
+ public:
+  inline TruncateResponse() : TruncateResponse(nullptr) {}
+  ~TruncateResponse() override;
+  explicit PROTOBUF_CONSTEXPR TruncateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TruncateResponse(const TruncateResponse& from);
+  TruncateResponse(TruncateResponse&& from) noexcept
+    : TruncateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TruncateResponse& operator=(const TruncateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TruncateResponse& operator=(TruncateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TruncateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TruncateResponse* internal_default_instance() {
+    return reinterpret_cast<const TruncateResponse*>(
+               &_TruncateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(TruncateResponse& a, TruncateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TruncateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TruncateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TruncateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TruncateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TruncateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TruncateResponse& from) {
+    TruncateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TruncateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TruncateResponse";
+  }
+  protected:
+  explicit TruncateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TruncateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MknodRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MknodRequest) */ {
+ public:
+  inline MknodRequest() : MknodRequest(nullptr) {}
+  ~MknodRequest() override;
+  explicit PROTOBUF_CONSTEXPR MknodRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MknodRequest(const MknodRequest& from);
+  MknodRequest(MknodRequest&& from) noexcept
+    : MknodRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MknodRequest& operator=(const MknodRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MknodRequest& operator=(MknodRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MknodRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MknodRequest* internal_default_instance() {
+    return reinterpret_cast<const MknodRequest*>(
+               &_MknodRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(MknodRequest& a, MknodRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MknodRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MknodRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MknodRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MknodRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MknodRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MknodRequest& from) {
+    MknodRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MknodRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MknodRequest";
+  }
+  protected:
+  explicit MknodRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kModeFieldNumber = 2,
+    kDevFieldNumber = 3,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // int32 dev = 3;
+  void clear_dev();
+  int32_t dev() const;
+  void set_dev(int32_t value);
+  private:
+  int32_t _internal_dev() const;
+  void _internal_set_dev(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MknodRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t mode_;
+    int32_t dev_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MknodResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MknodResponse) */ {
+ public:
+  inline MknodResponse() : MknodResponse(nullptr) {}
+  ~MknodResponse() override;
+  explicit PROTOBUF_CONSTEXPR MknodResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MknodResponse(const MknodResponse& from);
+  MknodResponse(MknodResponse&& from) noexcept
+    : MknodResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MknodResponse& operator=(const MknodResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MknodResponse& operator=(MknodResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MknodResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MknodResponse* internal_default_instance() {
+    return reinterpret_cast<const MknodResponse*>(
+               &_MknodResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(MknodResponse& a, MknodResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MknodResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MknodResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MknodResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MknodResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MknodResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MknodResponse& from) {
+    MknodResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MknodResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MknodResponse";
+  }
+  protected:
+  explicit MknodResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MknodResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LinkRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LinkRequest) */ {
+ public:
+  inline LinkRequest() : LinkRequest(nullptr) {}
+  ~LinkRequest() override;
+  explicit PROTOBUF_CONSTEXPR LinkRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LinkRequest(const LinkRequest& from);
+  LinkRequest(LinkRequest&& from) noexcept
+    : LinkRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LinkRequest& operator=(const LinkRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LinkRequest& operator=(LinkRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LinkRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LinkRequest* internal_default_instance() {
+    return reinterpret_cast<const LinkRequest*>(
+               &_LinkRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(LinkRequest& a, LinkRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LinkRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LinkRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LinkRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LinkRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LinkRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LinkRequest& from) {
+    LinkRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LinkRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LinkRequest";
+  }
+  protected:
+  explicit LinkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOldPathFieldNumber = 1,
+    kNewPathFieldNumber = 2,
+  };
+  // string old_path = 1;
+  void clear_old_path();
+  const std::string& old_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_old_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_old_path();
+  PROTOBUF_NODISCARD std::string* release_old_path();
+  void set_allocated_old_path(std::string* old_path);
+  private:
+  const std::string& _internal_old_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_old_path(const std::string& value);
+  std::string* _internal_mutable_old_path();
+  public:
+
+  // string new_path = 2;
+  void clear_new_path();
+  const std::string& new_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_new_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_new_path();
+  PROTOBUF_NODISCARD std::string* release_new_path();
+  void set_allocated_new_path(std::string* new_path);
+  private:
+  const std::string& _internal_new_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_new_path(const std::string& value);
+  std::string* _internal_mutable_new_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:LinkRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr old_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr new_path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LinkResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LinkResponse) */ {
+ public:
+  inline LinkResponse() : LinkResponse(nullptr) {}
+  ~LinkResponse() override;
+  explicit PROTOBUF_CONSTEXPR LinkResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LinkResponse(const LinkResponse& from);
+  LinkResponse(LinkResponse&& from) noexcept
+    : LinkResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LinkResponse& operator=(const LinkResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LinkResponse& operator=(LinkResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LinkResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LinkResponse* internal_default_instance() {
+    return reinterpret_cast<const LinkResponse*>(
+               &_LinkResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(LinkResponse& a, LinkResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LinkResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LinkResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LinkResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LinkResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LinkResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LinkResponse& from) {
+    LinkResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LinkResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LinkResponse";
+  }
+  protected:
+  explicit LinkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LinkResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SymlinkRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SymlinkRequest) */ {
+ public:
+  inline SymlinkRequest() : SymlinkRequest(nullptr) {}
+  ~SymlinkRequest() override;
+  explicit PROTOBUF_CONSTEXPR SymlinkRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SymlinkRequest(const SymlinkRequest& from);
+  SymlinkRequest(SymlinkRequest&& from) noexcept
+    : SymlinkRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SymlinkRequest& operator=(const SymlinkRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SymlinkRequest& operator=(SymlinkRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SymlinkRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SymlinkRequest* internal_default_instance() {
+    return reinterpret_cast<const SymlinkRequest*>(
+               &_SymlinkRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(SymlinkRequest& a, SymlinkRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SymlinkRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SymlinkRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SymlinkRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SymlinkRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SymlinkRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SymlinkRequest& from) {
+    SymlinkRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SymlinkRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SymlinkRequest";
+  }
+  protected:
+  explicit SymlinkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOldPathFieldNumber = 1,
+    kNewPathFieldNumber = 2,
+  };
+  // string old_path = 1;
+  void clear_old_path();
+  const std::string& old_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_old_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_old_path();
+  PROTOBUF_NODISCARD std::string* release_old_path();
+  void set_allocated_old_path(std::string* old_path);
+  private:
+  const std::string& _internal_old_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_old_path(const std::string& value);
+  std::string* _internal_mutable_old_path();
+  public:
+
+  // string new_path = 2;
+  void clear_new_path();
+  const std::string& new_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_new_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_new_path();
+  PROTOBUF_NODISCARD std::string* release_new_path();
+  void set_allocated_new_path(std::string* new_path);
+  private:
+  const std::string& _internal_new_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_new_path(const std::string& value);
+  std::string* _internal_mutable_new_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:SymlinkRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr old_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr new_path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SymlinkResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SymlinkResponse) */ {
+ public:
+  inline SymlinkResponse() : SymlinkResponse(nullptr) {}
+  ~SymlinkResponse() override;
+  explicit PROTOBUF_CONSTEXPR SymlinkResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SymlinkResponse(const SymlinkResponse& from);
+  SymlinkResponse(SymlinkResponse&& from) noexcept
+    : SymlinkResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SymlinkResponse& operator=(const SymlinkResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SymlinkResponse& operator=(SymlinkResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SymlinkResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SymlinkResponse* internal_default_instance() {
+    return reinterpret_cast<const SymlinkResponse*>(
+               &_SymlinkResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(SymlinkResponse& a, SymlinkResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SymlinkResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SymlinkResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SymlinkResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SymlinkResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SymlinkResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SymlinkResponse& from) {
+    SymlinkResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SymlinkResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SymlinkResponse";
+  }
+  protected:
+  explicit SymlinkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SymlinkResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadLinkRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadLinkRequest) */ {
+ public:
+  inline ReadLinkRequest() : ReadLinkRequest(nullptr) {}
+  ~ReadLinkRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadLinkRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadLinkRequest(const ReadLinkRequest& from);
+  ReadLinkRequest(ReadLinkRequest&& from) noexcept
+    : ReadLinkRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadLinkRequest& operator=(const ReadLinkRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadLinkRequest& operator=(ReadLinkRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadLinkRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadLinkRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadLinkRequest*>(
+               &_ReadLinkRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(ReadLinkRequest& a, ReadLinkRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadLinkRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadLinkRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadLinkRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadLinkRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadLinkRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadLinkRequest& from) {
+    ReadLinkRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadLinkRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadLinkRequest";
+  }
+  protected:
+  explicit ReadLinkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReadLinkRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadLinkResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadLinkResponse) */ {
+ public:
+  inline ReadLinkResponse() : ReadLinkResponse(nullptr) {}
+  ~ReadLinkResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadLinkResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadLinkResponse(const ReadLinkResponse& from);
+  ReadLinkResponse(ReadLinkResponse&& from) noexcept
+    : ReadLinkResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadLinkResponse& operator=(const ReadLinkResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadLinkResponse& operator=(ReadLinkResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadLinkResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadLinkResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadLinkResponse*>(
+               &_ReadLinkResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(ReadLinkResponse& a, ReadLinkResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadLinkResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadLinkResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadLinkResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadLinkResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadLinkResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadLinkResponse& from) {
+    ReadLinkResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadLinkResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadLinkResponse";
+  }
+  protected:
+  explicit ReadLinkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // string path = 2;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReadLinkResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatfsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StatfsRequest) */ {
+ public:
+  inline StatfsRequest() : StatfsRequest(nullptr) {}
+  ~StatfsRequest() override;
+  explicit PROTOBUF_CONSTEXPR StatfsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatfsRequest(const StatfsRequest& from);
+  StatfsRequest(StatfsRequest&& from) noexcept
+    : StatfsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatfsRequest& operator=(const StatfsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatfsRequest& operator=(StatfsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatfsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatfsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatfsRequest*>(
+               &_StatfsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(StatfsRequest& a, StatfsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatfsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatfsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatfsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatfsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatfsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatfsRequest& from) {
+    StatfsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatfsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StatfsRequest";
+  }
+  protected:
+  explicit StatfsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:StatfsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatfsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StatfsResponse) */ {
+ public:
+  inline StatfsResponse() : StatfsResponse(nullptr) {}
+  ~StatfsResponse() override;
+  explicit PROTOBUF_CONSTEXPR StatfsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatfsResponse(const StatfsResponse& from);
+  StatfsResponse(StatfsResponse&& from) noexcept
+    : StatfsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StatfsResponse& operator=(const StatfsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatfsResponse& operator=(StatfsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatfsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatfsResponse* internal_default_instance() {
+    return reinterpret_cast<const StatfsResponse*>(
+               &_StatfsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(StatfsResponse& a, StatfsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatfsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatfsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatfsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatfsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatfsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatfsResponse& from) {
+    StatfsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatfsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StatfsResponse";
+  }
+  protected:
+  explicit StatfsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrsizeFieldNumber = 2,
+    kBlocksFieldNumber = 3,
+    kBfreeFieldNumber = 4,
+    kBavailFieldNumber = 5,
+    kErrorFieldNumber = 1,
+    kTypeFieldNumber = 10,
+    kBsizeFieldNumber = 6,
+    kFilesFieldNumber = 7,
+    kFfreeFieldNumber = 8,
+    kNamemaxFieldNumber = 9,
+  };
+  // int64 frsize = 2;
+  void clear_frsize();
+  int64_t frsize() const;
+  void set_frsize(int64_t value);
+  private:
+  int64_t _internal_frsize() const;
+  void _internal_set_frsize(int64_t value);
+  public:
+
+  // int64 blocks = 3;
+  void clear_blocks();
+  int64_t blocks() const;
+  void set_blocks(int64_t value);
+  private:
+  int64_t _internal_blocks() const;
+  void _internal_set_blocks(int64_t value);
+  public:
+
+  // int64 bfree = 4;
+  void clear_bfree();
+  int64_t bfree() const;
+  void set_bfree(int64_t value);
+  private:
+  int64_t _internal_bfree() const;
+  void _internal_set_bfree(int64_t value);
+  public:
+
+  // int64 bavail = 5;
+  void clear_bavail();
+  int64_t bavail() const;
+  void set_bavail(int64_t value);
+  private:
+  int64_t _internal_bavail() const;
+  void _internal_set_bavail(int64_t value);
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 type = 10;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // int64 bsize = 6;
+  void clear_bsize();
+  int64_t bsize() const;
+  void set_bsize(int64_t value);
+  private:
+  int64_t _internal_bsize() const;
+  void _internal_set_bsize(int64_t value);
+  public:
+
+  // int64 files = 7;
+  void clear_files();
+  int64_t files() const;
+  void set_files(int64_t value);
+  private:
+  int64_t _internal_files() const;
+  void _internal_set_files(int64_t value);
+  public:
+
+  // int64 ffree = 8;
+  void clear_ffree();
+  int64_t ffree() const;
+  void set_ffree(int64_t value);
+  private:
+  int64_t _internal_ffree() const;
+  void _internal_set_ffree(int64_t value);
+  public:
+
+  // int64 namemax = 9;
+  void clear_namemax();
+  int64_t namemax() const;
+  void set_namemax(int64_t value);
+  private:
+  int64_t _internal_namemax() const;
+  void _internal_set_namemax(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:StatfsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t frsize_;
+    int64_t blocks_;
+    int64_t bfree_;
+    int64_t bavail_;
+    int32_t error_;
+    int32_t type_;
+    int64_t bsize_;
+    int64_t files_;
+    int64_t ffree_;
+    int64_t namemax_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FsyncRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FsyncRequest) */ {
+ public:
+  inline FsyncRequest() : FsyncRequest(nullptr) {}
+  ~FsyncRequest() override;
+  explicit PROTOBUF_CONSTEXPR FsyncRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FsyncRequest(const FsyncRequest& from);
+  FsyncRequest(FsyncRequest&& from) noexcept
+    : FsyncRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FsyncRequest& operator=(const FsyncRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FsyncRequest& operator=(FsyncRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FsyncRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FsyncRequest* internal_default_instance() {
+    return reinterpret_cast<const FsyncRequest*>(
+               &_FsyncRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(FsyncRequest& a, FsyncRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FsyncRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FsyncRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FsyncRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FsyncRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FsyncRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FsyncRequest& from) {
+    FsyncRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FsyncRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FsyncRequest";
+  }
+  protected:
+  explicit FsyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFdFieldNumber = 1,
+    kDatasyncFieldNumber = 2,
+  };
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // bool datasync = 2;
+  void clear_datasync();
+  bool datasync() const;
+  void set_datasync(bool value);
+  private:
+  bool _internal_datasync() const;
+  void _internal_set_datasync(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FsyncRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t fd_;
+    bool datasync_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FsyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FsyncResponse) */ {
+ public:
+  inline FsyncResponse() : FsyncResponse(nullptr) {}
+  ~FsyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR FsyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FsyncResponse(const FsyncResponse& from);
+  FsyncResponse(FsyncResponse&& from) noexcept
+    : FsyncResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FsyncResponse& operator=(const FsyncResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FsyncResponse& operator=(FsyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FsyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FsyncResponse* internal_default_instance() {
+    return reinterpret_cast<const FsyncResponse*>(
+               &_FsyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(FsyncResponse& a, FsyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FsyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FsyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FsyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FsyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FsyncResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FsyncResponse& from) {
+    FsyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FsyncResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FsyncResponse";
+  }
+  protected:
+  explicit FsyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FsyncResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetxattrRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SetxattrRequest) */ {
+ public:
+  inline SetxattrRequest() : SetxattrRequest(nullptr) {}
+  ~SetxattrRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetxattrRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetxattrRequest(const SetxattrRequest& from);
+  SetxattrRequest(SetxattrRequest&& from) noexcept
+    : SetxattrRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SetxattrRequest& operator=(const SetxattrRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetxattrRequest& operator=(SetxattrRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetxattrRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetxattrRequest* internal_default_instance() {
+    return reinterpret_cast<const SetxattrRequest*>(
+               &_SetxattrRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(SetxattrRequest& a, SetxattrRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetxattrRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetxattrRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetxattrRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetxattrRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetxattrRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetxattrRequest& from) {
+    SetxattrRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetxattrRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SetxattrRequest";
+  }
+  protected:
+  explicit SetxattrRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kFlagsFieldNumber = 4,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // bytes value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 flags = 4;
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SetxattrRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t flags_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetxattrResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SetxattrResponse) */ {
+ public:
+  inline SetxattrResponse() : SetxattrResponse(nullptr) {}
+  ~SetxattrResponse() override;
+  explicit PROTOBUF_CONSTEXPR SetxattrResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetxattrResponse(const SetxattrResponse& from);
+  SetxattrResponse(SetxattrResponse&& from) noexcept
+    : SetxattrResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetxattrResponse& operator=(const SetxattrResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetxattrResponse& operator=(SetxattrResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetxattrResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetxattrResponse* internal_default_instance() {
+    return reinterpret_cast<const SetxattrResponse*>(
+               &_SetxattrResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    42;
+
+  friend void swap(SetxattrResponse& a, SetxattrResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetxattrResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetxattrResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetxattrResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetxattrResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetxattrResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetxattrResponse& from) {
+    SetxattrResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetxattrResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SetxattrResponse";
+  }
+  protected:
+  explicit SetxattrResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SetxattrResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetxattrRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GetxattrRequest) */ {
+ public:
+  inline GetxattrRequest() : GetxattrRequest(nullptr) {}
+  ~GetxattrRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetxattrRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetxattrRequest(const GetxattrRequest& from);
+  GetxattrRequest(GetxattrRequest&& from) noexcept
+    : GetxattrRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetxattrRequest& operator=(const GetxattrRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetxattrRequest& operator=(GetxattrRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetxattrRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetxattrRequest* internal_default_instance() {
+    return reinterpret_cast<const GetxattrRequest*>(
+               &_GetxattrRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    43;
+
+  friend void swap(GetxattrRequest& a, GetxattrRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetxattrRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetxattrRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetxattrRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetxattrRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetxattrRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetxattrRequest& from) {
+    GetxattrRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetxattrRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GetxattrRequest";
+  }
+  protected:
+  explicit GetxattrRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kNameFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:GetxattrRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetxattrResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GetxattrResponse) */ {
+ public:
+  inline GetxattrResponse() : GetxattrResponse(nullptr) {}
+  ~GetxattrResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetxattrResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetxattrResponse(const GetxattrResponse& from);
+  GetxattrResponse(GetxattrResponse&& from) noexcept
+    : GetxattrResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetxattrResponse& operator=(const GetxattrResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetxattrResponse& operator=(GetxattrResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetxattrResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetxattrResponse* internal_default_instance() {
+    return reinterpret_cast<const GetxattrResponse*>(
+               &_GetxattrResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(GetxattrResponse& a, GetxattrResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetxattrResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetxattrResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetxattrResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetxattrResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetxattrResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetxattrResponse& from) {
+    GetxattrResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetxattrResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GetxattrResponse";
+  }
+  protected:
+  explicit GetxattrResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // bytes value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:GetxattrResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListxattrRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ListxattrRequest) */ {
+ public:
+  inline ListxattrRequest() : ListxattrRequest(nullptr) {}
+  ~ListxattrRequest() override;
+  explicit PROTOBUF_CONSTEXPR ListxattrRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListxattrRequest(const ListxattrRequest& from);
+  ListxattrRequest(ListxattrRequest&& from) noexcept
+    : ListxattrRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ListxattrRequest& operator=(const ListxattrRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListxattrRequest& operator=(ListxattrRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListxattrRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListxattrRequest* internal_default_instance() {
+    return reinterpret_cast<const ListxattrRequest*>(
+               &_ListxattrRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(ListxattrRequest& a, ListxattrRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListxattrRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListxattrRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListxattrRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListxattrRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListxattrRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListxattrRequest& from) {
+    ListxattrRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListxattrRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ListxattrRequest";
+  }
+  protected:
+  explicit ListxattrRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ListxattrRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListxattrResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ListxattrResponse) */ {
+ public:
+  inline ListxattrResponse() : ListxattrResponse(nullptr) {}
+  ~ListxattrResponse() override;
+  explicit PROTOBUF_CONSTEXPR ListxattrResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListxattrResponse(const ListxattrResponse& from);
+  ListxattrResponse(ListxattrResponse&& from) noexcept
+    : ListxattrResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ListxattrResponse& operator=(const ListxattrResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListxattrResponse& operator=(ListxattrResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListxattrResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListxattrResponse* internal_default_instance() {
+    return reinterpret_cast<const ListxattrResponse*>(
+               &_ListxattrResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    46;
+
+  friend void swap(ListxattrResponse& a, ListxattrResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListxattrResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListxattrResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListxattrResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListxattrResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListxattrResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListxattrResponse& from) {
+    ListxattrResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListxattrResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ListxattrResponse";
+  }
+  protected:
+  explicit ListxattrResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNamesFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // repeated string names = 2;
+  int names_size() const;
+  private:
+  int _internal_names_size() const;
+  public:
+  void clear_names();
+  const std::string& names(int index) const;
+  std::string* mutable_names(int index);
+  void set_names(int index, const std::string& value);
+  void set_names(int index, std::string&& value);
+  void set_names(int index, const char* value);
+  void set_names(int index, const char* value, size_t size);
+  std::string* add_names();
+  void add_names(const std::string& value);
+  void add_names(std::string&& value);
+  void add_names(const char* value);
+  void add_names(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_names();
+  private:
+  const std::string& _internal_names(int index) const;
+  std::string* _internal_add_names();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ListxattrResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> names_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RemovexattrRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemovexattrRequest) */ {
+ public:
+  inline RemovexattrRequest() : RemovexattrRequest(nullptr) {}
+  ~RemovexattrRequest() override;
+  explicit PROTOBUF_CONSTEXPR RemovexattrRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RemovexattrRequest(const RemovexattrRequest& from);
+  RemovexattrRequest(RemovexattrRequest&& from) noexcept
+    : RemovexattrRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RemovexattrRequest& operator=(const RemovexattrRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RemovexattrRequest& operator=(RemovexattrRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RemovexattrRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RemovexattrRequest* internal_default_instance() {
+    return reinterpret_cast<const RemovexattrRequest*>(
+               &_RemovexattrRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(RemovexattrRequest& a, RemovexattrRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RemovexattrRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RemovexattrRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RemovexattrRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RemovexattrRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RemovexattrRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RemovexattrRequest& from) {
+    RemovexattrRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RemovexattrRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RemovexattrRequest";
+  }
+  protected:
+  explicit RemovexattrRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kNameFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:RemovexattrRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RemovexattrResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemovexattrResponse) */ {
+ public:
+  inline RemovexattrResponse() : RemovexattrResponse(nullptr) {}
+  ~RemovexattrResponse() override;
+  explicit PROTOBUF_CONSTEXPR RemovexattrResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RemovexattrResponse(const RemovexattrResponse& from);
+  RemovexattrResponse(RemovexattrResponse&& from) noexcept
+    : RemovexattrResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RemovexattrResponse& operator=(const RemovexattrResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RemovexattrResponse& operator=(RemovexattrResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RemovexattrResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RemovexattrResponse* internal_default_instance() {
+    return reinterpret_cast<const RemovexattrResponse*>(
+               &_RemovexattrResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    48;
+
+  friend void swap(RemovexattrResponse& a, RemovexattrResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RemovexattrResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RemovexattrResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RemovexattrResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RemovexattrResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RemovexattrResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RemovexattrResponse& from) {
+    RemovexattrResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RemovexattrResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RemovexattrResponse";
+  }
+  protected:
+  explicit RemovexattrResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RemovexattrResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpendirRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpendirRequest) */ {
+ public:
+  inline OpendirRequest() : OpendirRequest(nullptr) {}
+  ~OpendirRequest() override;
+  explicit PROTOBUF_CONSTEXPR OpendirRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpendirRequest(const OpendirRequest& from);
+  OpendirRequest(OpendirRequest&& from) noexcept
+    : OpendirRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline OpendirRequest& operator=(const OpendirRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpendirRequest& operator=(OpendirRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpendirRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpendirRequest* internal_default_instance() {
+    return reinterpret_cast<const OpendirRequest*>(
+               &_OpendirRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    49;
+
+  friend void swap(OpendirRequest& a, OpendirRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpendirRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpendirRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpendirRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpendirRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpendirRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpendirRequest& from) {
+    OpendirRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpendirRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OpendirRequest";
+  }
+  protected:
+  explicit OpendirRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kTokenFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // uint64 token = 2;
+  void clear_token();
+  uint64_t token() const;
+  void set_token(uint64_t value);
+  private:
+  uint64_t _internal_token() const;
+  void _internal_set_token(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:OpendirRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    uint64_t token_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpendirResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpendirResponse) */ {
+ public:
+  inline OpendirResponse() : OpendirResponse(nullptr) {}
+  ~OpendirResponse() override;
+  explicit PROTOBUF_CONSTEXPR OpendirResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpendirResponse(const OpendirResponse& from);
+  OpendirResponse(OpendirResponse&& from) noexcept
+    : OpendirResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline OpendirResponse& operator=(const OpendirResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpendirResponse& operator=(OpendirResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpendirResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpendirResponse* internal_default_instance() {
+    return reinterpret_cast<const OpendirResponse*>(
+               &_OpendirResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    50;
+
+  friend void swap(OpendirResponse& a, OpendirResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpendirResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpendirResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpendirResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpendirResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpendirResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpendirResponse& from) {
+    OpendirResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpendirResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OpendirResponse";
+  }
+  protected:
+  explicit OpendirResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kDirectoryDescriptorFieldNumber = 2,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 directory_descriptor = 2;
+  void clear_directory_descriptor();
+  int32_t directory_descriptor() const;
+  void set_directory_descriptor(int32_t value);
+  private:
+  int32_t _internal_directory_descriptor() const;
+  void _internal_set_directory_descriptor(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:OpendirResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t directory_descriptor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReleasedirRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReleasedirRequest) */ {
+ public:
+  inline ReleasedirRequest() : ReleasedirRequest(nullptr) {}
+  ~ReleasedirRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReleasedirRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReleasedirRequest(const ReleasedirRequest& from);
+  ReleasedirRequest(ReleasedirRequest&& from) noexcept
+    : ReleasedirRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReleasedirRequest& operator=(const ReleasedirRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReleasedirRequest& operator=(ReleasedirRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleasedirRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReleasedirRequest* internal_default_instance() {
+    return reinterpret_cast<const ReleasedirRequest*>(
+               &_ReleasedirRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(ReleasedirRequest& a, ReleasedirRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReleasedirRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReleasedirRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReleasedirRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReleasedirRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReleasedirRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleasedirRequest& from) {
+    ReleasedirRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReleasedirRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReleasedirRequest";
+  }
+  protected:
+  explicit ReleasedirRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDirectoryDescriptorFieldNumber = 1,
+  };
+  // int32 directory_descriptor = 1;
+  void clear_directory_descriptor();
+  int32_t directory_descriptor() const;
+  void set_directory_descriptor(int32_t value);
+  private:
+  int32_t _internal_directory_descriptor() const;
+  void _internal_set_directory_descriptor(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReleasedirRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t directory_descriptor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReleasedirResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReleasedirResponse) */ {
+ public:
+  inline ReleasedirResponse() : ReleasedirResponse(nullptr) {}
+  ~ReleasedirResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReleasedirResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReleasedirResponse(const ReleasedirResponse& from);
+  ReleasedirResponse(ReleasedirResponse&& from) noexcept
+    : ReleasedirResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReleasedirResponse& operator=(const ReleasedirResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReleasedirResponse& operator=(ReleasedirResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleasedirResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReleasedirResponse* internal_default_instance() {
+    return reinterpret_cast<const ReleasedirResponse*>(
+               &_ReleasedirResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    52;
+
+  friend void swap(ReleasedirResponse& a, ReleasedirResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReleasedirResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReleasedirResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReleasedirResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReleasedirResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReleasedirResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleasedirResponse& from) {
+    ReleasedirResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReleasedirResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReleasedirResponse";
+  }
+  protected:
+  explicit ReleasedirResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReleasedirResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FsyncdirRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FsyncdirRequest) */ {
+ public:
+  inline FsyncdirRequest() : FsyncdirRequest(nullptr) {}
+  ~FsyncdirRequest() override;
+  explicit PROTOBUF_CONSTEXPR FsyncdirRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FsyncdirRequest(const FsyncdirRequest& from);
+  FsyncdirRequest(FsyncdirRequest&& from) noexcept
+    : FsyncdirRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FsyncdirRequest& operator=(const FsyncdirRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FsyncdirRequest& operator=(FsyncdirRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FsyncdirRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FsyncdirRequest* internal_default_instance() {
+    return reinterpret_cast<const FsyncdirRequest*>(
+               &_FsyncdirRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    53;
+
+  friend void swap(FsyncdirRequest& a, FsyncdirRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FsyncdirRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FsyncdirRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FsyncdirRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FsyncdirRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FsyncdirRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FsyncdirRequest& from) {
+    FsyncdirRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FsyncdirRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FsyncdirRequest";
+  }
+  protected:
+  explicit FsyncdirRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDirectoryDescriptorFieldNumber = 1,
+  };
+  // int32 directory_descriptor = 1;
+  void clear_directory_descriptor();
+  int32_t directory_descriptor() const;
+  void set_directory_descriptor(int32_t value);
+  private:
+  int32_t _internal_directory_descriptor() const;
+  void _internal_set_directory_descriptor(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FsyncdirRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t directory_descriptor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FsyncdirResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FsyncdirResponse) */ {
+ public:
+  inline FsyncdirResponse() : FsyncdirResponse(nullptr) {}
+  ~FsyncdirResponse() override;
+  explicit PROTOBUF_CONSTEXPR FsyncdirResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FsyncdirResponse(const FsyncdirResponse& from);
+  FsyncdirResponse(FsyncdirResponse&& from) noexcept
+    : FsyncdirResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FsyncdirResponse& operator=(const FsyncdirResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FsyncdirResponse& operator=(FsyncdirResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FsyncdirResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FsyncdirResponse* internal_default_instance() {
+    return reinterpret_cast<const FsyncdirResponse*>(
+               &_FsyncdirResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    54;
+
+  friend void swap(FsyncdirResponse& a, FsyncdirResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FsyncdirResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FsyncdirResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FsyncdirResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FsyncdirResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FsyncdirResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FsyncdirResponse& from) {
+    FsyncdirResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FsyncdirResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FsyncdirResponse";
+  }
+  protected:
+  explicit FsyncdirResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FsyncdirResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UtimensRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UtimensRequest) */ {
+ public:
+  inline UtimensRequest() : UtimensRequest(nullptr) {}
+  ~UtimensRequest() override;
+  explicit PROTOBUF_CONSTEXPR UtimensRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UtimensRequest(const UtimensRequest& from);
+  UtimensRequest(UtimensRequest&& from) noexcept
+    : UtimensRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UtimensRequest& operator=(const UtimensRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UtimensRequest& operator=(UtimensRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UtimensRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UtimensRequest* internal_default_instance() {
+    return reinterpret_cast<const UtimensRequest*>(
+               &_UtimensRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    55;
+
+  friend void swap(UtimensRequest& a, UtimensRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UtimensRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UtimensRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UtimensRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UtimensRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UtimensRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UtimensRequest& from) {
+    UtimensRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UtimensRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UtimensRequest";
+  }
+  protected:
+  explicit UtimensRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kAtimeFieldNumber = 2,
+    kMtimeFieldNumber = 3,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int64 atime = 2;
+  void clear_atime();
+  int64_t atime() const;
+  void set_atime(int64_t value);
+  private:
+  int64_t _internal_atime() const;
+  void _internal_set_atime(int64_t value);
+  public:
+
+  // int64 mtime = 3;
+  void clear_mtime();
+  int64_t mtime() const;
+  void set_mtime(int64_t value);
+  private:
+  int64_t _internal_mtime() const;
+  void _internal_set_mtime(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:UtimensRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int64_t atime_;
+    int64_t mtime_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UtimensResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UtimensResponse) */ {
+ public:
+  inline UtimensResponse() : UtimensResponse(nullptr) {}
+  ~UtimensResponse() override;
+  explicit PROTOBUF_CONSTEXPR UtimensResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UtimensResponse(const UtimensResponse& from);
+  UtimensResponse(UtimensResponse&& from) noexcept
+    : UtimensResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline UtimensResponse& operator=(const UtimensResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UtimensResponse& operator=(UtimensResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UtimensResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UtimensResponse* internal_default_instance() {
+    return reinterpret_cast<const UtimensResponse*>(
+               &_UtimensResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    56;
+
+  friend void swap(UtimensResponse& a, UtimensResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UtimensResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UtimensResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UtimensResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UtimensResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UtimensResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UtimensResponse& from) {
+    UtimensResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UtimensResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UtimensResponse";
+  }
+  protected:
+  explicit UtimensResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:UtimensResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AccessRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:AccessRequest) */ {
+ public:
+  inline AccessRequest() : AccessRequest(nullptr) {}
+  ~AccessRequest() override;
+  explicit PROTOBUF_CONSTEXPR AccessRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AccessRequest(const AccessRequest& from);
+  AccessRequest(AccessRequest&& from) noexcept
+    : AccessRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline AccessRequest& operator=(const AccessRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AccessRequest& operator=(AccessRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AccessRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AccessRequest* internal_default_instance() {
+    return reinterpret_cast<const AccessRequest*>(
+               &_AccessRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    57;
+
+  friend void swap(AccessRequest& a, AccessRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AccessRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AccessRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AccessRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AccessRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AccessRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AccessRequest& from) {
+    AccessRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AccessRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "AccessRequest";
+  }
+  protected:
+  explicit AccessRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kModeFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:AccessRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int32_t mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AccessResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:AccessResponse) */ {
+ public:
+  inline AccessResponse() : AccessResponse(nullptr) {}
+  ~AccessResponse() override;
+  explicit PROTOBUF_CONSTEXPR AccessResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AccessResponse(const AccessResponse& from);
+  AccessResponse(AccessResponse&& from) noexcept
+    : AccessResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AccessResponse& operator=(const AccessResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AccessResponse& operator=(AccessResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AccessResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AccessResponse* internal_default_instance() {
+    return reinterpret_cast<const AccessResponse*>(
+               &_AccessResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    58;
+
+  friend void swap(AccessResponse& a, AccessResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AccessResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AccessResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AccessResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AccessResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AccessResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AccessResponse& from) {
+    AccessResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AccessResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "AccessResponse";
+  }
+  protected:
+  explicit AccessResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:AccessResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Lock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lock) */ {
+ public:
+  inline Lock() : Lock(nullptr) {}
+  ~Lock() override;
+  explicit PROTOBUF_CONSTEXPR Lock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Lock(const Lock& from);
+  Lock(Lock&& from) noexcept
+    : Lock() {
+    *this = ::std::move(from);
+  }
+
+  inline Lock& operator=(const Lock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Lock& operator=(Lock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Lock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Lock* internal_default_instance() {
+    return reinterpret_cast<const Lock*>(
+               &_Lock_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    59;
+
+  friend void swap(Lock& a, Lock& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Lock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Lock* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Lock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Lock>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Lock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Lock& from) {
+    Lock::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Lock* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lock";
+  }
+  protected:
+  explicit Lock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLTypeFieldNumber = 3,
+    kLWhenceFieldNumber = 4,
+    kLStartFieldNumber = 5,
+    kLLenFieldNumber = 6,
+  };
+  // int32 l_type = 3;
+  void clear_l_type();
+  int32_t l_type() const;
+  void set_l_type(int32_t value);
+  private:
+  int32_t _internal_l_type() const;
+  void _internal_set_l_type(int32_t value);
+  public:
+
+  // int32 l_whence = 4;
+  void clear_l_whence();
+  int32_t l_whence() const;
+  void set_l_whence(int32_t value);
+  private:
+  int32_t _internal_l_whence() const;
+  void _internal_set_l_whence(int32_t value);
+  public:
+
+  // int64 l_start = 5;
+  void clear_l_start();
+  int64_t l_start() const;
+  void set_l_start(int64_t value);
+  private:
+  int64_t _internal_l_start() const;
+  void _internal_set_l_start(int64_t value);
+  public:
+
+  // int64 l_len = 6;
+  void clear_l_len();
+  int64_t l_len() const;
+  void set_l_len(int64_t value);
+  private:
+  int64_t _internal_l_len() const;
+  void _internal_set_l_len(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lock)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t l_type_;
+    int32_t l_whence_;
+    int64_t l_start_;
+    int64_t l_len_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LockRequest) */ {
+ public:
+  inline LockRequest() : LockRequest(nullptr) {}
+  ~LockRequest() override;
+  explicit PROTOBUF_CONSTEXPR LockRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockRequest(const LockRequest& from);
+  LockRequest(LockRequest&& from) noexcept
+    : LockRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LockRequest& operator=(const LockRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockRequest& operator=(LockRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockRequest* internal_default_instance() {
+    return reinterpret_cast<const LockRequest*>(
+               &_LockRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    60;
+
+  friend void swap(LockRequest& a, LockRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockRequest& from) {
+    LockRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LockRequest";
+  }
+  protected:
+  explicit LockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLockFieldNumber = 3,
+    kFdFieldNumber = 1,
+    kCmdFieldNumber = 2,
+  };
+  // .Lock lock = 3;
+  bool has_lock() const;
+  private:
+  bool _internal_has_lock() const;
+  public:
+  void clear_lock();
+  const ::Lock& lock() const;
+  PROTOBUF_NODISCARD ::Lock* release_lock();
+  ::Lock* mutable_lock();
+  void set_allocated_lock(::Lock* lock);
+  private:
+  const ::Lock& _internal_lock() const;
+  ::Lock* _internal_mutable_lock();
+  public:
+  void unsafe_arena_set_allocated_lock(
+      ::Lock* lock);
+  ::Lock* unsafe_arena_release_lock();
+
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // int32 cmd = 2;
+  void clear_cmd();
+  int32_t cmd() const;
+  void set_cmd(int32_t value);
+  private:
+  int32_t _internal_cmd() const;
+  void _internal_set_cmd(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LockRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::Lock* lock_;
+    int32_t fd_;
+    int32_t cmd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LockResponse) */ {
+ public:
+  inline LockResponse() : LockResponse(nullptr) {}
+  ~LockResponse() override;
+  explicit PROTOBUF_CONSTEXPR LockResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockResponse(const LockResponse& from);
+  LockResponse(LockResponse&& from) noexcept
+    : LockResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LockResponse& operator=(const LockResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockResponse& operator=(LockResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockResponse* internal_default_instance() {
+    return reinterpret_cast<const LockResponse*>(
+               &_LockResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    61;
+
+  friend void swap(LockResponse& a, LockResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockResponse& from) {
+    LockResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LockResponse";
+  }
+  protected:
+  explicit LockResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLockFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // optional .Lock lock = 2;
+  bool has_lock() const;
+  private:
+  bool _internal_has_lock() const;
+  public:
+  void clear_lock();
+  const ::Lock& lock() const;
+  PROTOBUF_NODISCARD ::Lock* release_lock();
+  ::Lock* mutable_lock();
+  void set_allocated_lock(::Lock* lock);
+  private:
+  const ::Lock& _internal_lock() const;
+  ::Lock* _internal_mutable_lock();
+  public:
+  void unsafe_arena_set_allocated_lock(
+      ::Lock* lock);
+  ::Lock* unsafe_arena_release_lock();
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LockResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Lock* lock_;
+    int32_t error_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FlockRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FlockRequest) */ {
+ public:
+  inline FlockRequest() : FlockRequest(nullptr) {}
+  ~FlockRequest() override;
+  explicit PROTOBUF_CONSTEXPR FlockRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FlockRequest(const FlockRequest& from);
+  FlockRequest(FlockRequest&& from) noexcept
+    : FlockRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FlockRequest& operator=(const FlockRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FlockRequest& operator=(FlockRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlockRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FlockRequest* internal_default_instance() {
+    return reinterpret_cast<const FlockRequest*>(
+               &_FlockRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    62;
+
+  friend void swap(FlockRequest& a, FlockRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FlockRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FlockRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FlockRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FlockRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FlockRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FlockRequest& from) {
+    FlockRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FlockRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FlockRequest";
+  }
+  protected:
+  explicit FlockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFdFieldNumber = 1,
+    kOpFieldNumber = 2,
+  };
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // int32 op = 2;
+  void clear_op();
+  int32_t op() const;
+  void set_op(int32_t value);
+  private:
+  int32_t _internal_op() const;
+  void _internal_set_op(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FlockRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t fd_;
+    int32_t op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FlockResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FlockResponse) */ {
+ public:
+  inline FlockResponse() : FlockResponse(nullptr) {}
+  ~FlockResponse() override;
+  explicit PROTOBUF_CONSTEXPR FlockResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FlockResponse(const FlockResponse& from);
+  FlockResponse(FlockResponse&& from) noexcept
+    : FlockResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FlockResponse& operator=(const FlockResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FlockResponse& operator=(FlockResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlockResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FlockResponse* internal_default_instance() {
+    return reinterpret_cast<const FlockResponse*>(
+               &_FlockResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    63;
+
+  friend void swap(FlockResponse& a, FlockResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FlockResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FlockResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FlockResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FlockResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FlockResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FlockResponse& from) {
+    FlockResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FlockResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FlockResponse";
+  }
+  protected:
+  explicit FlockResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FlockResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FallocateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FallocateRequest) */ {
+ public:
+  inline FallocateRequest() : FallocateRequest(nullptr) {}
+  ~FallocateRequest() override;
+  explicit PROTOBUF_CONSTEXPR FallocateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FallocateRequest(const FallocateRequest& from);
+  FallocateRequest(FallocateRequest&& from) noexcept
+    : FallocateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FallocateRequest& operator=(const FallocateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FallocateRequest& operator=(FallocateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FallocateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FallocateRequest* internal_default_instance() {
+    return reinterpret_cast<const FallocateRequest*>(
+               &_FallocateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    64;
+
+  friend void swap(FallocateRequest& a, FallocateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FallocateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FallocateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FallocateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FallocateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FallocateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FallocateRequest& from) {
+    FallocateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FallocateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FallocateRequest";
+  }
+  protected:
+  explicit FallocateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFdFieldNumber = 1,
+    kModeFieldNumber = 2,
+    kOffsetFieldNumber = 3,
+    kLenFieldNumber = 4,
+  };
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // int32 mode = 2;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // int64 offset = 3;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int64 len = 4;
+  void clear_len();
+  int64_t len() const;
+  void set_len(int64_t value);
+  private:
+  int64_t _internal_len() const;
+  void _internal_set_len(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FallocateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t fd_;
+    int32_t mode_;
+    int64_t offset_;
+    int64_t len_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FallocateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:FallocateResponse) */ {
+ public:
+  inline FallocateResponse() : FallocateResponse(nullptr) {}
+  ~FallocateResponse() override;
+  explicit PROTOBUF_CONSTEXPR FallocateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FallocateResponse(const FallocateResponse& from);
+  FallocateResponse(FallocateResponse&& from) noexcept
+    : FallocateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FallocateResponse& operator=(const FallocateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FallocateResponse& operator=(FallocateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FallocateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FallocateResponse* internal_default_instance() {
+    return reinterpret_cast<const FallocateResponse*>(
+               &_FallocateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    65;
+
+  friend void swap(FallocateResponse& a, FallocateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FallocateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FallocateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FallocateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FallocateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FallocateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FallocateResponse& from) {
+    FallocateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FallocateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "FallocateResponse";
+  }
+  protected:
+  explicit FallocateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:FallocateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LseekRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LseekRequest) */ {
+ public:
+  inline LseekRequest() : LseekRequest(nullptr) {}
+  ~LseekRequest() override;
+  explicit PROTOBUF_CONSTEXPR LseekRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LseekRequest(const LseekRequest& from);
+  LseekRequest(LseekRequest&& from) noexcept
+    : LseekRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LseekRequest& operator=(const LseekRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LseekRequest& operator=(LseekRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LseekRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LseekRequest* internal_default_instance() {
+    return reinterpret_cast<const LseekRequest*>(
+               &_LseekRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    66;
+
+  friend void swap(LseekRequest& a, LseekRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LseekRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LseekRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LseekRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LseekRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LseekRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LseekRequest& from) {
+    LseekRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LseekRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LseekRequest";
+  }
+  protected:
+  explicit LseekRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kFdFieldNumber = 1,
+    kWhenceFieldNumber = 3,
+  };
+  // int64 offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 fd = 1;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // int32 whence = 3;
+  void clear_whence();
+  int32_t whence() const;
+  void set_whence(int32_t value);
+  private:
+  int32_t _internal_whence() const;
+  void _internal_set_whence(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LseekRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_;
+    int32_t fd_;
+    int32_t whence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LseekResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LseekResponse) */ {
+ public:
+  inline LseekResponse() : LseekResponse(nullptr) {}
+  ~LseekResponse() override;
+  explicit PROTOBUF_CONSTEXPR LseekResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LseekResponse(const LseekResponse& from);
+  LseekResponse(LseekResponse&& from) noexcept
+    : LseekResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LseekResponse& operator=(const LseekResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LseekResponse& operator=(LseekResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LseekResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LseekResponse* internal_default_instance() {
+    return reinterpret_cast<const LseekResponse*>(
+               &_LseekResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    67;
+
+  friend void swap(LseekResponse& a, LseekResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LseekResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LseekResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LseekResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LseekResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LseekResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LseekResponse& from) {
+    LseekResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LseekResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LseekResponse";
+  }
+  protected:
+  explicit LseekResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // int64 offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LseekResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LspRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LspRequest) */ {
+ public:
+  inline LspRequest() : LspRequest(nullptr) {}
+  ~LspRequest() override;
+  explicit PROTOBUF_CONSTEXPR LspRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LspRequest(const LspRequest& from);
+  LspRequest(LspRequest&& from) noexcept
+    : LspRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LspRequest& operator=(const LspRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LspRequest& operator=(LspRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LspRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LspRequest* internal_default_instance() {
+    return reinterpret_cast<const LspRequest*>(
+               &_LspRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    68;
+
+  friend void swap(LspRequest& a, LspRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LspRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LspRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LspRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LspRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LspRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LspRequest& from) {
+    LspRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LspRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LspRequest";
+  }
+  protected:
+  explicit LspRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 1,
+    kLanguageFieldNumber = 2,
+  };
+  // string payload = 1;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // string language = 2;
+  void clear_language();
+  const std::string& language() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_language(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_language();
+  PROTOBUF_NODISCARD std::string* release_language();
+  void set_allocated_language(std::string* language);
+  private:
+  const std::string& _internal_language() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_language(const std::string& value);
+  std::string* _internal_mutable_language();
+  public:
+
+  // @@protoc_insertion_point(class_scope:LspRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LspResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LspResponse) */ {
+ public:
+  inline LspResponse() : LspResponse(nullptr) {}
+  ~LspResponse() override;
+  explicit PROTOBUF_CONSTEXPR LspResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LspResponse(const LspResponse& from);
+  LspResponse(LspResponse&& from) noexcept
+    : LspResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LspResponse& operator=(const LspResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LspResponse& operator=(LspResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LspResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LspResponse* internal_default_instance() {
+    return reinterpret_cast<const LspResponse*>(
+               &_LspResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    69;
+
+  friend void swap(LspResponse& a, LspResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LspResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LspResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LspResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LspResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LspResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LspResponse& from) {
+    LspResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LspResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LspResponse";
+  }
+  protected:
+  explicit LspResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 1,
+    kLanguageFieldNumber = 2,
+  };
+  // string payload = 1;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // string language = 2;
+  void clear_language();
+  const std::string& language() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_language(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_language();
+  PROTOBUF_NODISCARD std::string* release_language();
+  void set_allocated_language(std::string* language);
+  private:
+  const std::string& _internal_language() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_language(const std::string& value);
+  std::string* _internal_mutable_language();
+  public:
+
+  // @@protoc_insertion_point(class_scope:LspResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CopyFileRangeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CopyFileRangeRequest) */ {
+ public:
+  inline CopyFileRangeRequest() : CopyFileRangeRequest(nullptr) {}
+  ~CopyFileRangeRequest() override;
+  explicit PROTOBUF_CONSTEXPR CopyFileRangeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CopyFileRangeRequest(const CopyFileRangeRequest& from);
+  CopyFileRangeRequest(CopyFileRangeRequest&& from) noexcept
+    : CopyFileRangeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CopyFileRangeRequest& operator=(const CopyFileRangeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CopyFileRangeRequest& operator=(CopyFileRangeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CopyFileRangeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CopyFileRangeRequest* internal_default_instance() {
+    return reinterpret_cast<const CopyFileRangeRequest*>(
+               &_CopyFileRangeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    70;
+
+  friend void swap(CopyFileRangeRequest& a, CopyFileRangeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CopyFileRangeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CopyFileRangeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CopyFileRangeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CopyFileRangeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CopyFileRangeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CopyFileRangeRequest& from) {
+    CopyFileRangeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CopyFileRangeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CopyFileRangeRequest";
+  }
+  protected:
+  explicit CopyFileRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetInFieldNumber = 2,
+    kFdInFieldNumber = 1,
+    kFdOutFieldNumber = 3,
+    kOffsetOutFieldNumber = 4,
+    kSizeFieldNumber = 5,
+    kFlagsFieldNumber = 6,
+  };
+  // int64 offset_in = 2;
+  void clear_offset_in();
+  int64_t offset_in() const;
+  void set_offset_in(int64_t value);
+  private:
+  int64_t _internal_offset_in() const;
+  void _internal_set_offset_in(int64_t value);
+  public:
+
+  // int32 fd_in = 1;
+  void clear_fd_in();
+  int32_t fd_in() const;
+  void set_fd_in(int32_t value);
+  private:
+  int32_t _internal_fd_in() const;
+  void _internal_set_fd_in(int32_t value);
+  public:
+
+  // int32 fd_out = 3;
+  void clear_fd_out();
+  int32_t fd_out() const;
+  void set_fd_out(int32_t value);
+  private:
+  int32_t _internal_fd_out() const;
+  void _internal_set_fd_out(int32_t value);
+  public:
+
+  // int64 offset_out = 4;
+  void clear_offset_out();
+  int64_t offset_out() const;
+  void set_offset_out(int64_t value);
+  private:
+  int64_t _internal_offset_out() const;
+  void _internal_set_offset_out(int64_t value);
+  public:
+
+  // int64 size = 5;
+  void clear_size();
+  int64_t size() const;
+  void set_size(int64_t value);
+  private:
+  int64_t _internal_size() const;
+  void _internal_set_size(int64_t value);
+  public:
+
+  // int32 flags = 6;
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CopyFileRangeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_in_;
+    int32_t fd_in_;
+    int32_t fd_out_;
+    int64_t offset_out_;
+    int64_t size_;
+    int32_t flags_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CopyFileRangeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CopyFileRangeResponse) */ {
+ public:
+  inline CopyFileRangeResponse() : CopyFileRangeResponse(nullptr) {}
+  ~CopyFileRangeResponse() override;
+  explicit PROTOBUF_CONSTEXPR CopyFileRangeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CopyFileRangeResponse(const CopyFileRangeResponse& from);
+  CopyFileRangeResponse(CopyFileRangeResponse&& from) noexcept
+    : CopyFileRangeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CopyFileRangeResponse& operator=(const CopyFileRangeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CopyFileRangeResponse& operator=(CopyFileRangeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CopyFileRangeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CopyFileRangeResponse* internal_default_instance() {
+    return reinterpret_cast<const CopyFileRangeResponse*>(
+               &_CopyFileRangeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    71;
+
+  friend void swap(CopyFileRangeResponse& a, CopyFileRangeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CopyFileRangeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CopyFileRangeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CopyFileRangeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CopyFileRangeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CopyFileRangeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CopyFileRangeResponse& from) {
+    CopyFileRangeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CopyFileRangeResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CopyFileRangeResponse";
+  }
+  protected:
+  explicit CopyFileRangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSizeFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // int64 size = 2;
+  void clear_size();
+  int64_t size() const;
+  void set_size(int64_t value);
+  private:
+  int64_t _internal_size() const;
+  void _internal_set_size(int64_t value);
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CopyFileRangeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t size_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SearchRequest) */ {
+ public:
+  inline SearchRequest() : SearchRequest(nullptr) {}
+  ~SearchRequest() override;
+  explicit PROTOBUF_CONSTEXPR SearchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchRequest(const SearchRequest& from);
+  SearchRequest(SearchRequest&& from) noexcept
+    : SearchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchRequest& operator=(const SearchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchRequest& operator=(SearchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchRequest* internal_default_instance() {
+    return reinterpret_cast<const SearchRequest*>(
+               &_SearchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    72;
+
+  friend void swap(SearchRequest& a, SearchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchRequest& from) {
+    SearchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SearchRequest";
+  }
+  protected:
+  explicit SearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGlobsFieldNumber = 3,
+    kPatternFieldNumber = 1,
+    kPathFieldNumber = 2,
+    kRegexFieldNumber = 4,
+    kIgnoreCaseFieldNumber = 5,
+    kHiddenFieldNumber = 6,
+    kMaxResultsFieldNumber = 7,
+  };
+  // repeated string globs = 3;
+  int globs_size() const;
+  private:
+  int _internal_globs_size() const;
+  public:
+  void clear_globs();
+  const std::string& globs(int index) const;
+  std::string* mutable_globs(int index);
+  void set_globs(int index, const std::string& value);
+  void set_globs(int index, std::string&& value);
+  void set_globs(int index, const char* value);
+  void set_globs(int index, const char* value, size_t size);
+  std::string* add_globs();
+  void add_globs(const std::string& value);
+  void add_globs(std::string&& value);
+  void add_globs(const char* value);
+  void add_globs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& globs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_globs();
+  private:
+  const std::string& _internal_globs(int index) const;
+  std::string* _internal_add_globs();
+  public:
+
+  // string pattern = 1;
+  void clear_pattern();
+  const std::string& pattern() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pattern(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pattern();
+  PROTOBUF_NODISCARD std::string* release_pattern();
+  void set_allocated_pattern(std::string* pattern);
+  private:
+  const std::string& _internal_pattern() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pattern(const std::string& value);
+  std::string* _internal_mutable_pattern();
+  public:
+
+  // string path = 2;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // bool regex = 4;
+  void clear_regex();
+  bool regex() const;
+  void set_regex(bool value);
+  private:
+  bool _internal_regex() const;
+  void _internal_set_regex(bool value);
+  public:
+
+  // bool ignore_case = 5;
+  void clear_ignore_case();
+  bool ignore_case() const;
+  void set_ignore_case(bool value);
+  private:
+  bool _internal_ignore_case() const;
+  void _internal_set_ignore_case(bool value);
+  public:
+
+  // bool hidden = 6;
+  void clear_hidden();
+  bool hidden() const;
+  void set_hidden(bool value);
+  private:
+  bool _internal_hidden() const;
+  void _internal_set_hidden(bool value);
+  public:
+
+  // int32 max_results = 7;
+  void clear_max_results();
+  int32_t max_results() const;
+  void set_max_results(int32_t value);
+  private:
+  int32_t _internal_max_results() const;
+  void _internal_set_max_results(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SearchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> globs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pattern_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    bool regex_;
+    bool ignore_case_;
+    bool hidden_;
+    int32_t max_results_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchMatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SearchMatch) */ {
+ public:
+  inline SearchMatch() : SearchMatch(nullptr) {}
+  ~SearchMatch() override;
+  explicit PROTOBUF_CONSTEXPR SearchMatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchMatch(const SearchMatch& from);
+  SearchMatch(SearchMatch&& from) noexcept
+    : SearchMatch() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchMatch& operator=(const SearchMatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchMatch& operator=(SearchMatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchMatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchMatch* internal_default_instance() {
+    return reinterpret_cast<const SearchMatch*>(
+               &_SearchMatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    73;
+
+  friend void swap(SearchMatch& a, SearchMatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchMatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchMatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchMatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchMatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchMatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchMatch& from) {
+    SearchMatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchMatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SearchMatch";
+  }
+  protected:
+  explicit SearchMatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kTextFieldNumber = 4,
+    kLineFieldNumber = 2,
+    kColumnFieldNumber = 3,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string text = 4;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // int32 line = 2;
+  void clear_line();
+  int32_t line() const;
+  void set_line(int32_t value);
+  private:
+  int32_t _internal_line() const;
+  void _internal_set_line(int32_t value);
+  public:
+
+  // int32 column = 3;
+  void clear_column();
+  int32_t column() const;
+  void set_column(int32_t value);
+  private:
+  int32_t _internal_column() const;
+  void _internal_set_column(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SearchMatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    int32_t line_;
+    int32_t column_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SearchResponse) */ {
+ public:
+  inline SearchResponse() : SearchResponse(nullptr) {}
+  ~SearchResponse() override;
+  explicit PROTOBUF_CONSTEXPR SearchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchResponse(const SearchResponse& from);
+  SearchResponse(SearchResponse&& from) noexcept
+    : SearchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchResponse& operator=(const SearchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchResponse& operator=(SearchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchResponse* internal_default_instance() {
+    return reinterpret_cast<const SearchResponse*>(
+               &_SearchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    74;
+
+  friend void swap(SearchResponse& a, SearchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchResponse& from) {
+    SearchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SearchResponse";
+  }
+  protected:
+  explicit SearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMatchesFieldNumber = 2,
+    kErrorFieldNumber = 1,
+    kDoneFieldNumber = 3,
+  };
+  // repeated .SearchMatch matches = 2;
+  int matches_size() const;
+  private:
+  int _internal_matches_size() const;
+  public:
+  void clear_matches();
+  ::SearchMatch* mutable_matches(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SearchMatch >*
+      mutable_matches();
+  private:
+  const ::SearchMatch& _internal_matches(int index) const;
+  ::SearchMatch* _internal_add_matches();
+  public:
+  const ::SearchMatch& matches(int index) const;
+  ::SearchMatch* add_matches();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SearchMatch >&
+      matches() const;
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // bool done = 3;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SearchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SearchMatch > matches_;
+    int32_t error_;
+    bool done_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchCancelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SearchCancelRequest) */ {
+ public:
+  inline SearchCancelRequest() : SearchCancelRequest(nullptr) {}
+  ~SearchCancelRequest() override;
+  explicit PROTOBUF_CONSTEXPR SearchCancelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchCancelRequest(const SearchCancelRequest& from);
+  SearchCancelRequest(SearchCancelRequest&& from) noexcept
+    : SearchCancelRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchCancelRequest& operator=(const SearchCancelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchCancelRequest& operator=(SearchCancelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchCancelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchCancelRequest* internal_default_instance() {
+    return reinterpret_cast<const SearchCancelRequest*>(
+               &_SearchCancelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    75;
+
+  friend void swap(SearchCancelRequest& a, SearchCancelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchCancelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchCancelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchCancelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchCancelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchCancelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchCancelRequest& from) {
+    SearchCancelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchCancelRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SearchCancelRequest";
+  }
+  protected:
+  explicit SearchCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSearchIdFieldNumber = 1,
+  };
+  // int32 search_id = 1;
+  void clear_search_id();
+  int32_t search_id() const;
+  void set_search_id(int32_t value);
+  private:
+  int32_t _internal_search_id() const;
+  void _internal_set_search_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SearchCancelRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t search_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchCancelResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SearchCancelResponse) */ {
+ public:
+  inline SearchCancelResponse() : SearchCancelResponse(nullptr) {}
+  ~SearchCancelResponse() override;
+  explicit PROTOBUF_CONSTEXPR SearchCancelResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchCancelResponse(const SearchCancelResponse& from);
+  SearchCancelResponse(SearchCancelResponse&& from) noexcept
+    : SearchCancelResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchCancelResponse& operator=(const SearchCancelResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchCancelResponse& operator=(SearchCancelResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchCancelResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchCancelResponse* internal_default_instance() {
+    return reinterpret_cast<const SearchCancelResponse*>(
+               &_SearchCancelResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    76;
+
+  friend void swap(SearchCancelResponse& a, SearchCancelResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchCancelResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchCancelResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchCancelResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchCancelResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchCancelResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchCancelResponse& from) {
+    SearchCancelResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchCancelResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SearchCancelResponse";
+  }
+  protected:
+  explicit SearchCancelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SearchCancelResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchStatRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:BatchStatRequest) */ {
+ public:
+  inline BatchStatRequest() : BatchStatRequest(nullptr) {}
+  ~BatchStatRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchStatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchStatRequest(const BatchStatRequest& from);
+  BatchStatRequest(BatchStatRequest&& from) noexcept
+    : BatchStatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchStatRequest& operator=(const BatchStatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchStatRequest& operator=(BatchStatRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchStatRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchStatRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchStatRequest*>(
+               &_BatchStatRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    77;
+
+  friend void swap(BatchStatRequest& a, BatchStatRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchStatRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchStatRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchStatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchStatRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchStatRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchStatRequest& from) {
+    BatchStatRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchStatRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "BatchStatRequest";
+  }
+  protected:
+  explicit BatchStatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathsFieldNumber = 1,
+  };
+  // repeated string paths = 1;
+  int paths_size() const;
+  private:
+  int _internal_paths_size() const;
+  public:
+  void clear_paths();
+  const std::string& paths(int index) const;
+  std::string* mutable_paths(int index);
+  void set_paths(int index, const std::string& value);
+  void set_paths(int index, std::string&& value);
+  void set_paths(int index, const char* value);
+  void set_paths(int index, const char* value, size_t size);
+  std::string* add_paths();
+  void add_paths(const std::string& value);
+  void add_paths(std::string&& value);
+  void add_paths(const char* value);
+  void add_paths(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& paths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_paths();
+  private:
+  const std::string& _internal_paths(int index) const;
+  std::string* _internal_add_paths();
+  public:
+
+  // @@protoc_insertion_point(class_scope:BatchStatRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> paths_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchStatResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:BatchStatResponse) */ {
+ public:
+  inline BatchStatResponse() : BatchStatResponse(nullptr) {}
+  ~BatchStatResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchStatResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchStatResponse(const BatchStatResponse& from);
+  BatchStatResponse(BatchStatResponse&& from) noexcept
+    : BatchStatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchStatResponse& operator=(const BatchStatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchStatResponse& operator=(BatchStatResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchStatResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchStatResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchStatResponse*>(
+               &_BatchStatResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    78;
+
+  friend void swap(BatchStatResponse& a, BatchStatResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchStatResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchStatResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchStatResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchStatResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchStatResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchStatResponse& from) {
+    BatchStatResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchStatResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "BatchStatResponse";
+  }
+  protected:
+  explicit BatchStatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // repeated .GetAttrResponse results = 2;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::GetAttrResponse* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GetAttrResponse >*
+      mutable_results();
+  private:
+  const ::GetAttrResponse& _internal_results(int index) const;
+  ::GetAttrResponse* _internal_add_results();
+  public:
+  const ::GetAttrResponse& results(int index) const;
+  ::GetAttrResponse* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GetAttrResponse >&
+      results() const;
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:BatchStatResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GetAttrResponse > results_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TeaConfigFile_LanguageConfigsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TeaConfigFile_LanguageConfigsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TeaConfigFile_LanguageConfigsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  TeaConfigFile_LanguageConfigsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR TeaConfigFile_LanguageConfigsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit TeaConfigFile_LanguageConfigsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TeaConfigFile_LanguageConfigsEntry_DoNotUse& other);
+  static const TeaConfigFile_LanguageConfigsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TeaConfigFile_LanguageConfigsEntry_DoNotUse*>(&_TeaConfigFile_LanguageConfigsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TeaConfigFile.LanguageConfigsEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TeaConfigFile.LanguageConfigsEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_messages_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class TeaConfigFile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TeaConfigFile) */ {
+ public:
+  inline TeaConfigFile() : TeaConfigFile(nullptr) {}
+  ~TeaConfigFile() override;
+  explicit PROTOBUF_CONSTEXPR TeaConfigFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TeaConfigFile(const TeaConfigFile& from);
+  TeaConfigFile(TeaConfigFile&& from) noexcept
+    : TeaConfigFile() {
+    *this = ::std::move(from);
+  }
+
+  inline TeaConfigFile& operator=(const TeaConfigFile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TeaConfigFile& operator=(TeaConfigFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TeaConfigFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TeaConfigFile* internal_default_instance() {
+    return reinterpret_cast<const TeaConfigFile*>(
+               &_TeaConfigFile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    80;
+
+  friend void swap(TeaConfigFile& a, TeaConfigFile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TeaConfigFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TeaConfigFile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TeaConfigFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TeaConfigFile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TeaConfigFile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TeaConfigFile& from) {
+    TeaConfigFile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TeaConfigFile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TeaConfigFile";
+  }
+  protected:
+  explicit TeaConfigFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLanguageConfigsFieldNumber = 1,
+    kPrespawnFieldNumber = 2,
+    kIdleTimeoutFieldNumber = 3,
+    kMemoryLimitFieldNumber = 4,
+  };
+  // map<string, string> language_configs = 1;
+  int language_configs_size() const;
+  private:
+  int _internal_language_configs_size() const;
+  public:
+  void clear_language_configs();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_language_configs() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_language_configs();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      language_configs() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_language_configs();
+
+  // repeated string prespawn = 2;
+  int prespawn_size() const;
+  private:
+  int _internal_prespawn_size() const;
+  public:
+  void clear_prespawn();
+  const std::string& prespawn(int index) const;
+  std::string* mutable_prespawn(int index);
+  void set_prespawn(int index, const std::string& value);
+  void set_prespawn(int index, std::string&& value);
+  void set_prespawn(int index, const char* value);
+  void set_prespawn(int index, const char* value, size_t size);
+  std::string* add_prespawn();
+  void add_prespawn(const std::string& value);
+  void add_prespawn(std::string&& value);
+  void add_prespawn(const char* value);
+  void add_prespawn(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& prespawn() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_prespawn();
+  private:
+  const std::string& _internal_prespawn(int index) const;
+  std::string* _internal_add_prespawn();
+  public:
+
+  // int32 idle_timeout = 3;
+  void clear_idle_timeout();
+  int32_t idle_timeout() const;
+  void set_idle_timeout(int32_t value);
+  private:
+  int32_t _internal_idle_timeout() const;
+  void _internal_set_idle_timeout(int32_t value);
+  public:
+
+  // int32 memory_limit = 4;
+  void clear_memory_limit();
+  int32_t memory_limit() const;
+  void set_memory_limit(int32_t value);
+  private:
+  int32_t _internal_memory_limit() const;
+  void _internal_set_memory_limit(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TeaConfigFile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        TeaConfigFile_LanguageConfigsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> language_configs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> prespawn_;
+    int32_t idle_timeout_;
+    int32_t memory_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SaveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SaveRequest) */ {
+ public:
+  inline SaveRequest() : SaveRequest(nullptr) {}
+  ~SaveRequest() override;
+  explicit PROTOBUF_CONSTEXPR SaveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SaveRequest(const SaveRequest& from);
+  SaveRequest(SaveRequest&& from) noexcept
+    : SaveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SaveRequest& operator=(const SaveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SaveRequest& operator=(SaveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SaveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SaveRequest* internal_default_instance() {
+    return reinterpret_cast<const SaveRequest*>(
+               &_SaveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    81;
+
+  friend void swap(SaveRequest& a, SaveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SaveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SaveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SaveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SaveRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SaveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SaveRequest& from) {
+    SaveRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SaveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SaveRequest";
+  }
+  protected:
+  explicit SaveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kDataFieldNumber = 2,
+    kFromFieldNumber = 5,
+    kModeFieldNumber = 3,
+    kSyncFieldNumber = 4,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // bytes data = 2;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // string from = 5;
+  void clear_from();
+  const std::string& from() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from();
+  PROTOBUF_NODISCARD std::string* release_from();
+  void set_allocated_from(std::string* from);
+  private:
+  const std::string& _internal_from() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from(const std::string& value);
+  std::string* _internal_mutable_from();
+  public:
+
+  // int32 mode = 3;
+  void clear_mode();
+  int32_t mode() const;
+  void set_mode(int32_t value);
+  private:
+  int32_t _internal_mode() const;
+  void _internal_set_mode(int32_t value);
+  public:
+
+  // bool sync = 4;
+  void clear_sync();
+  bool sync() const;
+  void set_sync(bool value);
+  private:
+  bool _internal_sync() const;
+  void _internal_set_sync(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SaveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_;
+    int32_t mode_;
+    bool sync_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SaveResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SaveResponse) */ {
+ public:
+  inline SaveResponse() : SaveResponse(nullptr) {}
+  ~SaveResponse() override;
+  explicit PROTOBUF_CONSTEXPR SaveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SaveResponse(const SaveResponse& from);
+  SaveResponse(SaveResponse&& from) noexcept
+    : SaveResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SaveResponse& operator=(const SaveResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SaveResponse& operator=(SaveResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SaveResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SaveResponse* internal_default_instance() {
+    return reinterpret_cast<const SaveResponse*>(
+               &_SaveResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    82;
+
+  friend void swap(SaveResponse& a, SaveResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SaveResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SaveResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SaveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SaveResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SaveResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SaveResponse& from) {
+    SaveResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SaveResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SaveResponse";
+  }
+  protected:
+  explicit SaveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // .GetAttrResponse attr = 2;
+  bool has_attr() const;
+  private:
+  bool _internal_has_attr() const;
+  public:
+  void clear_attr();
+  const ::GetAttrResponse& attr() const;
+  PROTOBUF_NODISCARD ::GetAttrResponse* release_attr();
+  ::GetAttrResponse* mutable_attr();
+  void set_allocated_attr(::GetAttrResponse* attr);
+  private:
+  const ::GetAttrResponse& _internal_attr() const;
+  ::GetAttrResponse* _internal_mutable_attr();
+  public:
+  void unsafe_arena_set_allocated_attr(
+      ::GetAttrResponse* attr);
+  ::GetAttrResponse* unsafe_arena_release_attr();
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SaveResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::GetAttrResponse* attr_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExecRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ExecRequest) */ {
+ public:
+  inline ExecRequest() : ExecRequest(nullptr) {}
+  ~ExecRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExecRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExecRequest(const ExecRequest& from);
+  ExecRequest(ExecRequest&& from) noexcept
+    : ExecRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ExecRequest& operator=(const ExecRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecRequest& operator=(ExecRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExecRequest* internal_default_instance() {
+    return reinterpret_cast<const ExecRequest*>(
+               &_ExecRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    83;
+
+  friend void swap(ExecRequest& a, ExecRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExecRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExecRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExecRequest& from) {
+    ExecRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExecRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ExecRequest";
+  }
+  protected:
+  explicit ExecRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgvFieldNumber = 1,
+    kEnvFieldNumber = 3,
+    kPathFieldNumber = 2,
+  };
+  // repeated string argv = 1;
+  int argv_size() const;
+  private:
+  int _internal_argv_size() const;
+  public:
+  void clear_argv();
+  const std::string& argv(int index) const;
+  std::string* mutable_argv(int index);
+  void set_argv(int index, const std::string& value);
+  void set_argv(int index, std::string&& value);
+  void set_argv(int index, const char* value);
+  void set_argv(int index, const char* value, size_t size);
+  std::string* add_argv();
+  void add_argv(const std::string& value);
+  void add_argv(std::string&& value);
+  void add_argv(const char* value);
+  void add_argv(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& argv() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_argv();
+  private:
+  const std::string& _internal_argv(int index) const;
+  std::string* _internal_add_argv();
+  public:
+
+  // repeated string env = 3;
+  int env_size() const;
+  private:
+  int _internal_env_size() const;
+  public:
+  void clear_env();
+  const std::string& env(int index) const;
+  std::string* mutable_env(int index);
+  void set_env(int index, const std::string& value);
+  void set_env(int index, std::string&& value);
+  void set_env(int index, const char* value);
+  void set_env(int index, const char* value, size_t size);
+  std::string* add_env();
+  void add_env(const std::string& value);
+  void add_env(std::string&& value);
+  void add_env(const char* value);
+  void add_env(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& env() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_env();
+  private:
+  const std::string& _internal_env(int index) const;
+  std::string* _internal_add_env();
+  public:
+
+  // string path = 2;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ExecRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> argv_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> env_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExecResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ExecResponse) */ {
+ public:
+  inline ExecResponse() : ExecResponse(nullptr) {}
+  ~ExecResponse() override;
+  explicit PROTOBUF_CONSTEXPR ExecResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExecResponse(const ExecResponse& from);
+  ExecResponse(ExecResponse&& from) noexcept
+    : ExecResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ExecResponse& operator=(const ExecResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecResponse& operator=(ExecResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExecResponse* internal_default_instance() {
+    return reinterpret_cast<const ExecResponse*>(
+               &_ExecResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    84;
+
+  friend void swap(ExecResponse& a, ExecResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExecResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExecResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExecResponse& from) {
+    ExecResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExecResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ExecResponse";
+  }
+  protected:
+  explicit ExecResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOutputFieldNumber = 2,
+    kErrorOutputFieldNumber = 3,
+    kErrorFieldNumber = 1,
+    kDoneFieldNumber = 4,
+    kExitCodeFieldNumber = 5,
+    kSignalFieldNumber = 6,
+  };
+  // bytes output = 2;
+  void clear_output();
+  const std::string& output() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_output(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_output();
+  PROTOBUF_NODISCARD std::string* release_output();
+  void set_allocated_output(std::string* output);
+  private:
+  const std::string& _internal_output() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_output(const std::string& value);
+  std::string* _internal_mutable_output();
+  public:
+
+  // bytes error_output = 3;
+  void clear_error_output();
+  const std::string& error_output() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_output(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_output();
+  PROTOBUF_NODISCARD std::string* release_error_output();
+  void set_allocated_error_output(std::string* error_output);
+  private:
+  const std::string& _internal_error_output() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_output(const std::string& value);
+  std::string* _internal_mutable_error_output();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // bool done = 4;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // int32 exit_code = 5;
+  void clear_exit_code();
+  int32_t exit_code() const;
+  void set_exit_code(int32_t value);
+  private:
+  int32_t _internal_exit_code() const;
+  void _internal_set_exit_code(int32_t value);
+  public:
+
+  // int32 signal = 6;
+  void clear_signal();
+  int32_t signal() const;
+  void set_signal(int32_t value);
+  private:
+  int32_t _internal_signal() const;
+  void _internal_set_signal(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ExecResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr output_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_output_;
+    int32_t error_;
+    bool done_;
+    int32_t exit_code_;
+    int32_t signal_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExecCancelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ExecCancelRequest) */ {
+ public:
+  inline ExecCancelRequest() : ExecCancelRequest(nullptr) {}
+  ~ExecCancelRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExecCancelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExecCancelRequest(const ExecCancelRequest& from);
+  ExecCancelRequest(ExecCancelRequest&& from) noexcept
+    : ExecCancelRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ExecCancelRequest& operator=(const ExecCancelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecCancelRequest& operator=(ExecCancelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecCancelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExecCancelRequest* internal_default_instance() {
+    return reinterpret_cast<const ExecCancelRequest*>(
+               &_ExecCancelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    85;
+
+  friend void swap(ExecCancelRequest& a, ExecCancelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExecCancelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecCancelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecCancelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecCancelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExecCancelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExecCancelRequest& from) {
+    ExecCancelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExecCancelRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ExecCancelRequest";
+  }
+  protected:
+  explicit ExecCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExecIdFieldNumber = 1,
+  };
+  // int32 exec_id = 1;
+  void clear_exec_id();
+  int32_t exec_id() const;
+  void set_exec_id(int32_t value);
+  private:
+  int32_t _internal_exec_id() const;
+  void _internal_set_exec_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ExecCancelRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t exec_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExecCancelResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ExecCancelResponse) */ {
+ public:
+  inline ExecCancelResponse() : ExecCancelResponse(nullptr) {}
+  ~ExecCancelResponse() override;
+  explicit PROTOBUF_CONSTEXPR ExecCancelResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExecCancelResponse(const ExecCancelResponse& from);
+  ExecCancelResponse(ExecCancelResponse&& from) noexcept
+    : ExecCancelResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ExecCancelResponse& operator=(const ExecCancelResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecCancelResponse& operator=(ExecCancelResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecCancelResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExecCancelResponse* internal_default_instance() {
+    return reinterpret_cast<const ExecCancelResponse*>(
+               &_ExecCancelResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    86;
+
+  friend void swap(ExecCancelResponse& a, ExecCancelResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExecCancelResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecCancelResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecCancelResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecCancelResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExecCancelResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExecCancelResponse& from) {
+    ExecCancelResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExecCancelResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ExecCancelResponse";
+  }
+  protected:
+  explicit ExecCancelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ExecCancelResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// InitRequest
+
+// string name = 1;
+inline void InitRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& InitRequest::name() const {
+  // @@protoc_insertion_point(field_get:InitRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InitRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:InitRequest.name)
+}
+inline std::string* InitRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:InitRequest.name)
+  return _s;
+}
+inline const std::string& InitRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void InitRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InitRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InitRequest::release_name() {
+  // @@protoc_insertion_point(field_release:InitRequest.name)
+  return _impl_.name_.Release();
+}
+inline void InitRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:InitRequest.name)
+}
+
+// int32 credits = 2;
+inline void InitRequest::clear_credits() {
+  _impl_.credits_ = 0;
+}
+inline int32_t InitRequest::_internal_credits() const {
+  return _impl_.credits_;
+}
+inline int32_t InitRequest::credits() const {
+  // @@protoc_insertion_point(field_get:InitRequest.credits)
+  return _internal_credits();
+}
+inline void InitRequest::_internal_set_credits(int32_t value) {
+  
+  _impl_.credits_ = value;
+}
+inline void InitRequest::set_credits(int32_t value) {
+  _internal_set_credits(value);
+  // @@protoc_insertion_point(field_set:InitRequest.credits)
+}
+
+// int64 credit_bytes = 3;
+inline void InitRequest::clear_credit_bytes() {
+  _impl_.credit_bytes_ = int64_t{0};
+}
+inline int64_t InitRequest::_internal_credit_bytes() const {
+  return _impl_.credit_bytes_;
+}
+inline int64_t InitRequest::credit_bytes() const {
+  // @@protoc_insertion_point(field_get:InitRequest.credit_bytes)
+  return _internal_credit_bytes();
+}
+inline void InitRequest::_internal_set_credit_bytes(int64_t value) {
+  
+  _impl_.credit_bytes_ = value;
+}
+inline void InitRequest::set_credit_bytes(int64_t value) {
+  _internal_set_credit_bytes(value);
+  // @@protoc_insertion_point(field_set:InitRequest.credit_bytes)
+}
+
+// string export_name = 4;
+inline void InitRequest::clear_export_name() {
+  _impl_.export_name_.ClearToEmpty();
+}
+inline const std::string& InitRequest::export_name() const {
+  // @@protoc_insertion_point(field_get:InitRequest.export_name)
+  return _internal_export_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InitRequest::set_export_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.export_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:InitRequest.export_name)
+}
+inline std::string* InitRequest::mutable_export_name() {
+  std::string* _s = _internal_mutable_export_name();
+  // @@protoc_insertion_point(field_mutable:InitRequest.export_name)
+  return _s;
+}
+inline const std::string& InitRequest::_internal_export_name() const {
+  return _impl_.export_name_.Get();
+}
+inline void InitRequest::_internal_set_export_name(const std::string& value) {
+  
+  _impl_.export_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InitRequest::_internal_mutable_export_name() {
+  
+  return _impl_.export_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InitRequest::release_export_name() {
+  // @@protoc_insertion_point(field_release:InitRequest.export_name)
+  return _impl_.export_name_.Release();
+}
+inline void InitRequest::set_allocated_export_name(std::string* export_name) {
+  if (export_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.export_name_.SetAllocated(export_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.export_name_.IsDefault()) {
+    _impl_.export_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:InitRequest.export_name)
+}
+
+// -------------------------------------------------------------------
+
+// InitResponse
+
+// int32 error = 1;
+inline void InitResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t InitResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t InitResponse::error() const {
+  // @@protoc_insertion_point(field_get:InitResponse.error)
+  return _internal_error();
+}
+inline void InitResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void InitResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:InitResponse.error)
+}
+
+// uint64 instance = 2;
+inline void InitResponse::clear_instance() {
+  _impl_.instance_ = uint64_t{0u};
+}
+inline uint64_t InitResponse::_internal_instance() const {
+  return _impl_.instance_;
+}
+inline uint64_t InitResponse::instance() const {
+  // @@protoc_insertion_point(field_get:InitResponse.instance)
+  return _internal_instance();
+}
+inline void InitResponse::_internal_set_instance(uint64_t value) {
+  
+  _impl_.instance_ = value;
+}
+inline void InitResponse::set_instance(uint64_t value) {
+  _internal_set_instance(value);
+  // @@protoc_insertion_point(field_set:InitResponse.instance)
+}
+
+// int32 credits = 3;
+inline void InitResponse::clear_credits() {
+  _impl_.credits_ = 0;
+}
+inline int32_t InitResponse::_internal_credits() const {
+  return _impl_.credits_;
+}
+inline int32_t InitResponse::credits() const {
+  // @@protoc_insertion_point(field_get:InitResponse.credits)
+  return _internal_credits();
+}
+inline void InitResponse::_internal_set_credits(int32_t value) {
+  
+  _impl_.credits_ = value;
+}
+inline void InitResponse::set_credits(int32_t value) {
+  _internal_set_credits(value);
+  // @@protoc_insertion_point(field_set:InitResponse.credits)
+}
+
+// int64 credit_bytes = 4;
+inline void InitResponse::clear_credit_bytes() {
+  _impl_.credit_bytes_ = int64_t{0};
+}
+inline int64_t InitResponse::_internal_credit_bytes() const {
+  return _impl_.credit_bytes_;
+}
+inline int64_t InitResponse::credit_bytes() const {
+  // @@protoc_insertion_point(field_get:InitResponse.credit_bytes)
+  return _internal_credit_bytes();
+}
+inline void InitResponse::_internal_set_credit_bytes(int64_t value) {
+  
+  _impl_.credit_bytes_ = value;
+}
+inline void InitResponse::set_credit_bytes(int64_t value) {
+  _internal_set_credit_bytes(value);
+  // @@protoc_insertion_point(field_set:InitResponse.credit_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// GetAttrRequest
+
+// string path = 1;
+inline void GetAttrRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& GetAttrRequest::path() const {
+  // @@protoc_insertion_point(field_get:GetAttrRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAttrRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetAttrRequest.path)
+}
+inline std::string* GetAttrRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:GetAttrRequest.path)
+  return _s;
+}
+inline const std::string& GetAttrRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void GetAttrRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetAttrRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetAttrRequest::release_path() {
+  // @@protoc_insertion_point(field_release:GetAttrRequest.path)
+  return _impl_.path_.Release();
+}
+inline void GetAttrRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetAttrRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// GetAttrResponse
+
+// int32 error = 1;
+inline void GetAttrResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t GetAttrResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t GetAttrResponse::error() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.error)
+  return _internal_error();
+}
+inline void GetAttrResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void GetAttrResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.error)
+}
+
+// int32 mode = 2;
+inline void GetAttrResponse::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t GetAttrResponse::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t GetAttrResponse::mode() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.mode)
+  return _internal_mode();
+}
+inline void GetAttrResponse::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void GetAttrResponse::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.mode)
+}
+
+// int32 nlink = 3;
+inline void GetAttrResponse::clear_nlink() {
+  _impl_.nlink_ = 0;
+}
+inline int32_t GetAttrResponse::_internal_nlink() const {
+  return _impl_.nlink_;
+}
+inline int32_t GetAttrResponse::nlink() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.nlink)
+  return _internal_nlink();
+}
+inline void GetAttrResponse::_internal_set_nlink(int32_t value) {
+  
+  _impl_.nlink_ = value;
+}
+inline void GetAttrResponse::set_nlink(int32_t value) {
+  _internal_set_nlink(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.nlink)
+}
+
+// int64 size = 4;
+inline void GetAttrResponse::clear_size() {
+  _impl_.size_ = int64_t{0};
+}
+inline int64_t GetAttrResponse::_internal_size() const {
+  return _impl_.size_;
+}
+inline int64_t GetAttrResponse::size() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.size)
+  return _internal_size();
+}
+inline void GetAttrResponse::_internal_set_size(int64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void GetAttrResponse::set_size(int64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.size)
+}
+
+// int64 atime = 5;
+inline void GetAttrResponse::clear_atime() {
+  _impl_.atime_ = int64_t{0};
+}
+inline int64_t GetAttrResponse::_internal_atime() const {
+  return _impl_.atime_;
+}
+inline int64_t GetAttrResponse::atime() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.atime)
+  return _internal_atime();
+}
+inline void GetAttrResponse::_internal_set_atime(int64_t value) {
+  
+  _impl_.atime_ = value;
+}
+inline void GetAttrResponse::set_atime(int64_t value) {
+  _internal_set_atime(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.atime)
+}
+
+// int64 mtime = 6;
+inline void GetAttrResponse::clear_mtime() {
+  _impl_.mtime_ = int64_t{0};
+}
+inline int64_t GetAttrResponse::_internal_mtime() const {
+  return _impl_.mtime_;
+}
+inline int64_t GetAttrResponse::mtime() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.mtime)
+  return _internal_mtime();
+}
+inline void GetAttrResponse::_internal_set_mtime(int64_t value) {
+  
+  _impl_.mtime_ = value;
+}
+inline void GetAttrResponse::set_mtime(int64_t value) {
+  _internal_set_mtime(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.mtime)
+}
+
+// int64 ctime = 7;
+inline void GetAttrResponse::clear_ctime() {
+  _impl_.ctime_ = int64_t{0};
+}
+inline int64_t GetAttrResponse::_internal_ctime() const {
+  return _impl_.ctime_;
+}
+inline int64_t GetAttrResponse::ctime() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.ctime)
+  return _internal_ctime();
+}
+inline void GetAttrResponse::_internal_set_ctime(int64_t value) {
+  
+  _impl_.ctime_ = value;
+}
+inline void GetAttrResponse::set_ctime(int64_t value) {
+  _internal_set_ctime(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.ctime)
+}
+
+// bool own = 8;
+inline void GetAttrResponse::clear_own() {
+  _impl_.own_ = false;
+}
+inline bool GetAttrResponse::_internal_own() const {
+  return _impl_.own_;
+}
+inline bool GetAttrResponse::own() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.own)
+  return _internal_own();
+}
+inline void GetAttrResponse::_internal_set_own(bool value) {
+  
+  _impl_.own_ = value;
+}
+inline void GetAttrResponse::set_own(bool value) {
+  _internal_set_own(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.own)
+}
+
+// bool gown = 9;
+inline void GetAttrResponse::clear_gown() {
+  _impl_.gown_ = false;
+}
+inline bool GetAttrResponse::_internal_gown() const {
+  return _impl_.gown_;
+}
+inline bool GetAttrResponse::gown() const {
+  // @@protoc_insertion_point(field_get:GetAttrResponse.gown)
+  return _internal_gown();
+}
+inline void GetAttrResponse::_internal_set_gown(bool value) {
+  
+  _impl_.gown_ = value;
+}
+inline void GetAttrResponse::set_gown(bool value) {
+  _internal_set_gown(value);
+  // @@protoc_insertion_point(field_set:GetAttrResponse.gown)
+}
+
+// -------------------------------------------------------------------
+
+// OpenRequest
+
+// string path = 1;
+inline void OpenRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& OpenRequest::path() const {
+  // @@protoc_insertion_point(field_get:OpenRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:OpenRequest.path)
+}
+inline std::string* OpenRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:OpenRequest.path)
+  return _s;
+}
+inline const std::string& OpenRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void OpenRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenRequest::release_path() {
+  // @@protoc_insertion_point(field_release:OpenRequest.path)
+  return _impl_.path_.Release();
+}
+inline void OpenRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:OpenRequest.path)
+}
+
+// int32 flags = 2;
+inline void OpenRequest::clear_flags() {
+  _impl_.flags_ = 0;
+}
+inline int32_t OpenRequest::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t OpenRequest::flags() const {
+  // @@protoc_insertion_point(field_get:OpenRequest.flags)
+  return _internal_flags();
+}
+inline void OpenRequest::_internal_set_flags(int32_t value) {
+  
+  _impl_.flags_ = value;
+}
+inline void OpenRequest::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:OpenRequest.flags)
+}
+
+// bool passthrough = 3;
+inline void OpenRequest::clear_passthrough() {
+  _impl_.passthrough_ = false;
+}
+inline bool OpenRequest::_internal_passthrough() const {
+  return _impl_.passthrough_;
+}
+inline bool OpenRequest::passthrough() const {
+  // @@protoc_insertion_point(field_get:OpenRequest.passthrough)
+  return _internal_passthrough();
+}
+inline void OpenRequest::_internal_set_passthrough(bool value) {
+  
+  _impl_.passthrough_ = value;
+}
+inline void OpenRequest::set_passthrough(bool value) {
+  _internal_set_passthrough(value);
+  // @@protoc_insertion_point(field_set:OpenRequest.passthrough)
+}
+
+// uint64 token = 4;
+inline void OpenRequest::clear_token() {
+  _impl_.token_ = uint64_t{0u};
+}
+inline uint64_t OpenRequest::_internal_token() const {
+  return _impl_.token_;
+}
+inline uint64_t OpenRequest::token() const {
+  // @@protoc_insertion_point(field_get:OpenRequest.token)
+  return _internal_token();
+}
+inline void OpenRequest::_internal_set_token(uint64_t value) {
+  
+  _impl_.token_ = value;
+}
+inline void OpenRequest::set_token(uint64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:OpenRequest.token)
+}
+
+// -------------------------------------------------------------------
+
+// OpenResponse
+
+// int32 error = 1;
+inline void OpenResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t OpenResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t OpenResponse::error() const {
+  // @@protoc_insertion_point(field_get:OpenResponse.error)
+  return _internal_error();
+}
+inline void OpenResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void OpenResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:OpenResponse.error)
+}
+
+// int32 fd = 2;
+inline void OpenResponse::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t OpenResponse::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t OpenResponse::fd() const {
+  // @@protoc_insertion_point(field_get:OpenResponse.fd)
+  return _internal_fd();
+}
+inline void OpenResponse::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void OpenResponse::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:OpenResponse.fd)
+}
+
+// bool passthrough = 3;
+inline void OpenResponse::clear_passthrough() {
+  _impl_.passthrough_ = false;
+}
+inline bool OpenResponse::_internal_passthrough() const {
+  return _impl_.passthrough_;
+}
+inline bool OpenResponse::passthrough() const {
+  // @@protoc_insertion_point(field_get:OpenResponse.passthrough)
+  return _internal_passthrough();
+}
+inline void OpenResponse::_internal_set_passthrough(bool value) {
+  
+  _impl_.passthrough_ = value;
+}
+inline void OpenResponse::set_passthrough(bool value) {
+  _internal_set_passthrough(value);
+  // @@protoc_insertion_point(field_set:OpenResponse.passthrough)
+}
+
+// -------------------------------------------------------------------
+
+// ReleaseRequest
+
+// int32 fd = 1;
+inline void ReleaseRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t ReleaseRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t ReleaseRequest::fd() const {
+  // @@protoc_insertion_point(field_get:ReleaseRequest.fd)
+  return _internal_fd();
+}
+inline void ReleaseRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void ReleaseRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:ReleaseRequest.fd)
+}
+
+// -------------------------------------------------------------------
+
+// ReleaseResponse
+
+// int32 error = 1;
+inline void ReleaseResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ReleaseResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ReleaseResponse::error() const {
+  // @@protoc_insertion_point(field_get:ReleaseResponse.error)
+  return _internal_error();
+}
+inline void ReleaseResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ReleaseResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ReleaseResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// ReadDirRequest
+
+// int32 directory_descriptor = 1;
+inline void ReadDirRequest::clear_directory_descriptor() {
+  _impl_.directory_descriptor_ = 0;
+}
+inline int32_t ReadDirRequest::_internal_directory_descriptor() const {
+  return _impl_.directory_descriptor_;
+}
+inline int32_t ReadDirRequest::directory_descriptor() const {
+  // @@protoc_insertion_point(field_get:ReadDirRequest.directory_descriptor)
+  return _internal_directory_descriptor();
+}
+inline void ReadDirRequest::_internal_set_directory_descriptor(int32_t value) {
+  
+  _impl_.directory_descriptor_ = value;
+}
+inline void ReadDirRequest::set_directory_descriptor(int32_t value) {
+  _internal_set_directory_descriptor(value);
+  // @@protoc_insertion_point(field_set:ReadDirRequest.directory_descriptor)
+}
+
+// int64 offset = 2;
+inline void ReadDirRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t ReadDirRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t ReadDirRequest::offset() const {
+  // @@protoc_insertion_point(field_get:ReadDirRequest.offset)
+  return _internal_offset();
+}
+inline void ReadDirRequest::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void ReadDirRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:ReadDirRequest.offset)
+}
+
+// int32 size = 3;
+inline void ReadDirRequest::clear_size() {
+  _impl_.size_ = 0;
+}
+inline int32_t ReadDirRequest::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t ReadDirRequest::size() const {
+  // @@protoc_insertion_point(field_get:ReadDirRequest.size)
+  return _internal_size();
+}
+inline void ReadDirRequest::_internal_set_size(int32_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void ReadDirRequest::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:ReadDirRequest.size)
+}
+
+// -------------------------------------------------------------------
+
+// DirEntry
+
+// string name = 1;
+inline void DirEntry::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& DirEntry::name() const {
+  // @@protoc_insertion_point(field_get:DirEntry.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirEntry::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:DirEntry.name)
+}
+inline std::string* DirEntry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:DirEntry.name)
+  return _s;
+}
+inline const std::string& DirEntry::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void DirEntry::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirEntry::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirEntry::release_name() {
+  // @@protoc_insertion_point(field_release:DirEntry.name)
+  return _impl_.name_.Release();
+}
+inline void DirEntry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:DirEntry.name)
+}
+
+// int64 offset = 2;
+inline void DirEntry::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t DirEntry::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t DirEntry::offset() const {
+  // @@protoc_insertion_point(field_get:DirEntry.offset)
+  return _internal_offset();
+}
+inline void DirEntry::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void DirEntry::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:DirEntry.offset)
+}
+
+// int32 type = 3;
+inline void DirEntry::clear_type() {
+  _impl_.type_ = 0;
+}
+inline int32_t DirEntry::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t DirEntry::type() const {
+  // @@protoc_insertion_point(field_get:DirEntry.type)
+  return _internal_type();
+}
+inline void DirEntry::_internal_set_type(int32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void DirEntry::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:DirEntry.type)
+}
+
+// -------------------------------------------------------------------
+
+// ReadDirResponse
+
+// int32 error = 1;
+inline void ReadDirResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ReadDirResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ReadDirResponse::error() const {
+  // @@protoc_insertion_point(field_get:ReadDirResponse.error)
+  return _internal_error();
+}
+inline void ReadDirResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ReadDirResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ReadDirResponse.error)
+}
+
+// repeated .DirEntry entries = 2;
+inline int ReadDirResponse::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int ReadDirResponse::entries_size() const {
+  return _internal_entries_size();
+}
+inline void ReadDirResponse::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::DirEntry* ReadDirResponse::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:ReadDirResponse.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DirEntry >*
+ReadDirResponse::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:ReadDirResponse.entries)
+  return &_impl_.entries_;
+}
+inline const ::DirEntry& ReadDirResponse::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::DirEntry& ReadDirResponse::entries(int index) const {
+  // @@protoc_insertion_point(field_get:ReadDirResponse.entries)
+  return _internal_entries(index);
+}
+inline ::DirEntry* ReadDirResponse::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::DirEntry* ReadDirResponse::add_entries() {
+  ::DirEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:ReadDirResponse.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DirEntry >&
+ReadDirResponse::entries() const {
+  // @@protoc_insertion_point(field_list:ReadDirResponse.entries)
+  return _impl_.entries_;
+}
+
+// bool eof = 3;
+inline void ReadDirResponse::clear_eof() {
+  _impl_.eof_ = false;
+}
+inline bool ReadDirResponse::_internal_eof() const {
+  return _impl_.eof_;
+}
+inline bool ReadDirResponse::eof() const {
+  // @@protoc_insertion_point(field_get:ReadDirResponse.eof)
+  return _internal_eof();
+}
+inline void ReadDirResponse::_internal_set_eof(bool value) {
+  
+  _impl_.eof_ = value;
+}
+inline void ReadDirResponse::set_eof(bool value) {
+  _internal_set_eof(value);
+  // @@protoc_insertion_point(field_set:ReadDirResponse.eof)
+}
+
+// -------------------------------------------------------------------
+
+// ReadRequest
+
+// int32 fd = 1;
+inline void ReadRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t ReadRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t ReadRequest::fd() const {
+  // @@protoc_insertion_point(field_get:ReadRequest.fd)
+  return _internal_fd();
+}
+inline void ReadRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void ReadRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:ReadRequest.fd)
+}
+
+// int64 offset = 2;
+inline void ReadRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t ReadRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t ReadRequest::offset() const {
+  // @@protoc_insertion_point(field_get:ReadRequest.offset)
+  return _internal_offset();
+}
+inline void ReadRequest::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void ReadRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:ReadRequest.offset)
+}
+
+// int32 size = 3;
+inline void ReadRequest::clear_size() {
+  _impl_.size_ = 0;
+}
+inline int32_t ReadRequest::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t ReadRequest::size() const {
+  // @@protoc_insertion_point(field_get:ReadRequest.size)
+  return _internal_size();
+}
+inline void ReadRequest::_internal_set_size(int32_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void ReadRequest::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:ReadRequest.size)
+}
+
+// -------------------------------------------------------------------
+
+// ReadResponse
+
+// int32 error = 1;
+inline void ReadResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ReadResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ReadResponse::error() const {
+  // @@protoc_insertion_point(field_get:ReadResponse.error)
+  return _internal_error();
+}
+inline void ReadResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ReadResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ReadResponse.error)
+}
+
+// bytes data = 2;
+inline void ReadResponse::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ReadResponse::data() const {
+  // @@protoc_insertion_point(field_get:ReadResponse.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadResponse::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ReadResponse.data)
+}
+inline std::string* ReadResponse::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:ReadResponse.data)
+  return _s;
+}
+inline const std::string& ReadResponse::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ReadResponse::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadResponse::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadResponse::release_data() {
+  // @@protoc_insertion_point(field_release:ReadResponse.data)
+  return _impl_.data_.Release();
+}
+inline void ReadResponse::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ReadResponse.data)
+}
+
+// -------------------------------------------------------------------
+
+// WriteRequest
+
+// int32 fd = 1;
+inline void WriteRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t WriteRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t WriteRequest::fd() const {
+  // @@protoc_insertion_point(field_get:WriteRequest.fd)
+  return _internal_fd();
+}
+inline void WriteRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void WriteRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:WriteRequest.fd)
+}
+
+// int64 offset = 2;
+inline void WriteRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t WriteRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t WriteRequest::offset() const {
+  // @@protoc_insertion_point(field_get:WriteRequest.offset)
+  return _internal_offset();
+}
+inline void WriteRequest::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void WriteRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:WriteRequest.offset)
+}
+
+// bytes data = 3;
+inline void WriteRequest::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& WriteRequest::data() const {
+  // @@protoc_insertion_point(field_get:WriteRequest.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:WriteRequest.data)
+}
+inline std::string* WriteRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:WriteRequest.data)
+  return _s;
+}
+inline const std::string& WriteRequest::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void WriteRequest::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteRequest::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteRequest::release_data() {
+  // @@protoc_insertion_point(field_release:WriteRequest.data)
+  return _impl_.data_.Release();
+}
+inline void WriteRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:WriteRequest.data)
+}
+
+// -------------------------------------------------------------------
+
+// WriteResponse
+
+// int32 error = 1;
+inline void WriteResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t WriteResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t WriteResponse::error() const {
+  // @@protoc_insertion_point(field_get:WriteResponse.error)
+  return _internal_error();
+}
+inline void WriteResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void WriteResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:WriteResponse.error)
+}
+
+// int32 size = 2;
+inline void WriteResponse::clear_size() {
+  _impl_.size_ = 0;
+}
+inline int32_t WriteResponse::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t WriteResponse::size() const {
+  // @@protoc_insertion_point(field_get:WriteResponse.size)
+  return _internal_size();
+}
+inline void WriteResponse::_internal_set_size(int32_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void WriteResponse::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:WriteResponse.size)
+}
+
+// -------------------------------------------------------------------
+
+// CreateRequest
+
+// string path = 1;
+inline void CreateRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& CreateRequest::path() const {
+  // @@protoc_insertion_point(field_get:CreateRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CreateRequest.path)
+}
+inline std::string* CreateRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:CreateRequest.path)
+  return _s;
+}
+inline const std::string& CreateRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void CreateRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateRequest::release_path() {
+  // @@protoc_insertion_point(field_release:CreateRequest.path)
+  return _impl_.path_.Release();
+}
+inline void CreateRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CreateRequest.path)
+}
+
+// int32 mode = 2;
+inline void CreateRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t CreateRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t CreateRequest::mode() const {
+  // @@protoc_insertion_point(field_get:CreateRequest.mode)
+  return _internal_mode();
+}
+inline void CreateRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void CreateRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:CreateRequest.mode)
+}
+
+// -------------------------------------------------------------------
+
+// CreateResponse
+
+// int32 error = 1;
+inline void CreateResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t CreateResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t CreateResponse::error() const {
+  // @@protoc_insertion_point(field_get:CreateResponse.error)
+  return _internal_error();
+}
+inline void CreateResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void CreateResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:CreateResponse.error)
+}
+
+// int32 fd = 2;
+inline void CreateResponse::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t CreateResponse::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t CreateResponse::fd() const {
+  // @@protoc_insertion_point(field_get:CreateResponse.fd)
+  return _internal_fd();
+}
+inline void CreateResponse::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void CreateResponse::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:CreateResponse.fd)
+}
+
+// -------------------------------------------------------------------
+
+// MkdirRequest
+
+// string path = 1;
+inline void MkdirRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& MkdirRequest::path() const {
+  // @@protoc_insertion_point(field_get:MkdirRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MkdirRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MkdirRequest.path)
+}
+inline std::string* MkdirRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:MkdirRequest.path)
+  return _s;
+}
+inline const std::string& MkdirRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void MkdirRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MkdirRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MkdirRequest::release_path() {
+  // @@protoc_insertion_point(field_release:MkdirRequest.path)
+  return _impl_.path_.Release();
+}
+inline void MkdirRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MkdirRequest.path)
+}
+
+// int32 mode = 2;
+inline void MkdirRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t MkdirRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t MkdirRequest::mode() const {
+  // @@protoc_insertion_point(field_get:MkdirRequest.mode)
+  return _internal_mode();
+}
+inline void MkdirRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void MkdirRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:MkdirRequest.mode)
+}
+
+// -------------------------------------------------------------------
+
+// MkdirResponse
+
+// int32 error = 1;
+inline void MkdirResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t MkdirResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t MkdirResponse::error() const {
+  // @@protoc_insertion_point(field_get:MkdirResponse.error)
+  return _internal_error();
+}
+inline void MkdirResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void MkdirResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:MkdirResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// UnlinkRequest
+
+// string path = 1;
+inline void UnlinkRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& UnlinkRequest::path() const {
+  // @@protoc_insertion_point(field_get:UnlinkRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnlinkRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:UnlinkRequest.path)
+}
+inline std::string* UnlinkRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:UnlinkRequest.path)
+  return _s;
+}
+inline const std::string& UnlinkRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void UnlinkRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnlinkRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnlinkRequest::release_path() {
+  // @@protoc_insertion_point(field_release:UnlinkRequest.path)
+  return _impl_.path_.Release();
+}
+inline void UnlinkRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:UnlinkRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// UnlinkResponse
+
+// int32 error = 1;
+inline void UnlinkResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t UnlinkResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t UnlinkResponse::error() const {
+  // @@protoc_insertion_point(field_get:UnlinkResponse.error)
+  return _internal_error();
+}
+inline void UnlinkResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void UnlinkResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:UnlinkResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// RmdirRequest
+
+// string path = 1;
+inline void RmdirRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& RmdirRequest::path() const {
+  // @@protoc_insertion_point(field_get:RmdirRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RmdirRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RmdirRequest.path)
+}
+inline std::string* RmdirRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:RmdirRequest.path)
+  return _s;
+}
+inline const std::string& RmdirRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void RmdirRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RmdirRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RmdirRequest::release_path() {
+  // @@protoc_insertion_point(field_release:RmdirRequest.path)
+  return _impl_.path_.Release();
+}
+inline void RmdirRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RmdirRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// RmdirResponse
+
+// int32 error = 1;
+inline void RmdirResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t RmdirResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t RmdirResponse::error() const {
+  // @@protoc_insertion_point(field_get:RmdirResponse.error)
+  return _internal_error();
+}
+inline void RmdirResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void RmdirResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:RmdirResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// RenameRequest
+
+// string old_path = 1;
+inline void RenameRequest::clear_old_path() {
+  _impl_.old_path_.ClearToEmpty();
+}
+inline const std::string& RenameRequest::old_path() const {
+  // @@protoc_insertion_point(field_get:RenameRequest.old_path)
+  return _internal_old_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RenameRequest::set_old_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.old_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RenameRequest.old_path)
+}
+inline std::string* RenameRequest::mutable_old_path() {
+  std::string* _s = _internal_mutable_old_path();
+  // @@protoc_insertion_point(field_mutable:RenameRequest.old_path)
+  return _s;
+}
+inline const std::string& RenameRequest::_internal_old_path() const {
+  return _impl_.old_path_.Get();
+}
+inline void RenameRequest::_internal_set_old_path(const std::string& value) {
+  
+  _impl_.old_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RenameRequest::_internal_mutable_old_path() {
+  
+  return _impl_.old_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RenameRequest::release_old_path() {
+  // @@protoc_insertion_point(field_release:RenameRequest.old_path)
+  return _impl_.old_path_.Release();
+}
+inline void RenameRequest::set_allocated_old_path(std::string* old_path) {
+  if (old_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.old_path_.SetAllocated(old_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.old_path_.IsDefault()) {
+    _impl_.old_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RenameRequest.old_path)
+}
+
+// string new_path = 2;
+inline void RenameRequest::clear_new_path() {
+  _impl_.new_path_.ClearToEmpty();
+}
+inline const std::string& RenameRequest::new_path() const {
+  // @@protoc_insertion_point(field_get:RenameRequest.new_path)
+  return _internal_new_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RenameRequest::set_new_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.new_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RenameRequest.new_path)
+}
+inline std::string* RenameRequest::mutable_new_path() {
+  std::string* _s = _internal_mutable_new_path();
+  // @@protoc_insertion_point(field_mutable:RenameRequest.new_path)
+  return _s;
+}
+inline const std::string& RenameRequest::_internal_new_path() const {
+  return _impl_.new_path_.Get();
+}
+inline void RenameRequest::_internal_set_new_path(const std::string& value) {
+  
+  _impl_.new_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RenameRequest::_internal_mutable_new_path() {
+  
+  return _impl_.new_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RenameRequest::release_new_path() {
+  // @@protoc_insertion_point(field_release:RenameRequest.new_path)
+  return _impl_.new_path_.Release();
+}
+inline void RenameRequest::set_allocated_new_path(std::string* new_path) {
+  if (new_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.new_path_.SetAllocated(new_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.new_path_.IsDefault()) {
+    _impl_.new_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RenameRequest.new_path)
+}
+
+// int32 flags = 3;
+inline void RenameRequest::clear_flags() {
+  _impl_.flags_ = 0;
+}
+inline int32_t RenameRequest::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t RenameRequest::flags() const {
+  // @@protoc_insertion_point(field_get:RenameRequest.flags)
+  return _internal_flags();
+}
+inline void RenameRequest::_internal_set_flags(int32_t value) {
+  
+  _impl_.flags_ = value;
+}
+inline void RenameRequest::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:RenameRequest.flags)
+}
+
+// -------------------------------------------------------------------
+
+// RenameResponse
+
+// int32 error = 1;
+inline void RenameResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t RenameResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t RenameResponse::error() const {
+  // @@protoc_insertion_point(field_get:RenameResponse.error)
+  return _internal_error();
+}
+inline void RenameResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void RenameResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:RenameResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// ChmodRequest
+
+// string path = 1;
+inline void ChmodRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& ChmodRequest::path() const {
+  // @@protoc_insertion_point(field_get:ChmodRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChmodRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChmodRequest.path)
+}
+inline std::string* ChmodRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:ChmodRequest.path)
+  return _s;
+}
+inline const std::string& ChmodRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void ChmodRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChmodRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChmodRequest::release_path() {
+  // @@protoc_insertion_point(field_release:ChmodRequest.path)
+  return _impl_.path_.Release();
+}
+inline void ChmodRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChmodRequest.path)
+}
+
+// int32 mode = 2;
+inline void ChmodRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t ChmodRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t ChmodRequest::mode() const {
+  // @@protoc_insertion_point(field_get:ChmodRequest.mode)
+  return _internal_mode();
+}
+inline void ChmodRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void ChmodRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:ChmodRequest.mode)
+}
+
+// -------------------------------------------------------------------
+
+// ChmodResponse
+
+// int32 error = 1;
+inline void ChmodResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ChmodResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ChmodResponse::error() const {
+  // @@protoc_insertion_point(field_get:ChmodResponse.error)
+  return _internal_error();
+}
+inline void ChmodResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ChmodResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ChmodResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// TruncateRequest
+
+// string path = 1;
+inline void TruncateRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& TruncateRequest::path() const {
+  // @@protoc_insertion_point(field_get:TruncateRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TruncateRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TruncateRequest.path)
+}
+inline std::string* TruncateRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:TruncateRequest.path)
+  return _s;
+}
+inline const std::string& TruncateRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void TruncateRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TruncateRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TruncateRequest::release_path() {
+  // @@protoc_insertion_point(field_release:TruncateRequest.path)
+  return _impl_.path_.Release();
+}
+inline void TruncateRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TruncateRequest.path)
+}
+
+// int64 size = 2;
+inline void TruncateRequest::clear_size() {
+  _impl_.size_ = int64_t{0};
+}
+inline int64_t TruncateRequest::_internal_size() const {
+  return _impl_.size_;
+}
+inline int64_t TruncateRequest::size() const {
+  // @@protoc_insertion_point(field_get:TruncateRequest.size)
+  return _internal_size();
+}
+inline void TruncateRequest::_internal_set_size(int64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void TruncateRequest::set_size(int64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:TruncateRequest.size)
+}
+
+// -------------------------------------------------------------------
+
+// TruncateResponse
+
+// int32 error = 1;
+inline void TruncateResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t TruncateResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t TruncateResponse::error() const {
+  // @@protoc_insertion_point(field_get:TruncateResponse.error)
+  return _internal_error();
+}
+inline void TruncateResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void TruncateResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:TruncateResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// MknodRequest
+
+// string path = 1;
+inline void MknodRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& MknodRequest::path() const {
+  // @@protoc_insertion_point(field_get:MknodRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MknodRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MknodRequest.path)
+}
+inline std::string* MknodRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:MknodRequest.path)
+  return _s;
+}
+inline const std::string& MknodRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void MknodRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MknodRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MknodRequest::release_path() {
+  // @@protoc_insertion_point(field_release:MknodRequest.path)
+  return _impl_.path_.Release();
+}
+inline void MknodRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MknodRequest.path)
+}
+
+// int32 mode = 2;
+inline void MknodRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t MknodRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t MknodRequest::mode() const {
+  // @@protoc_insertion_point(field_get:MknodRequest.mode)
+  return _internal_mode();
+}
+inline void MknodRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void MknodRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:MknodRequest.mode)
+}
+
+// int32 dev = 3;
+inline void MknodRequest::clear_dev() {
+  _impl_.dev_ = 0;
+}
+inline int32_t MknodRequest::_internal_dev() const {
+  return _impl_.dev_;
+}
+inline int32_t MknodRequest::dev() const {
+  // @@protoc_insertion_point(field_get:MknodRequest.dev)
+  return _internal_dev();
+}
+inline void MknodRequest::_internal_set_dev(int32_t value) {
+  
+  _impl_.dev_ = value;
+}
+inline void MknodRequest::set_dev(int32_t value) {
+  _internal_set_dev(value);
+  // @@protoc_insertion_point(field_set:MknodRequest.dev)
+}
+
+// -------------------------------------------------------------------
+
+// MknodResponse
+
+// int32 error = 1;
+inline void MknodResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t MknodResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t MknodResponse::error() const {
+  // @@protoc_insertion_point(field_get:MknodResponse.error)
+  return _internal_error();
+}
+inline void MknodResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void MknodResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:MknodResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// LinkRequest
+
+// string old_path = 1;
+inline void LinkRequest::clear_old_path() {
+  _impl_.old_path_.ClearToEmpty();
+}
+inline const std::string& LinkRequest::old_path() const {
+  // @@protoc_insertion_point(field_get:LinkRequest.old_path)
+  return _internal_old_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LinkRequest::set_old_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.old_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:LinkRequest.old_path)
+}
+inline std::string* LinkRequest::mutable_old_path() {
+  std::string* _s = _internal_mutable_old_path();
+  // @@protoc_insertion_point(field_mutable:LinkRequest.old_path)
+  return _s;
+}
+inline const std::string& LinkRequest::_internal_old_path() const {
+  return _impl_.old_path_.Get();
+}
+inline void LinkRequest::_internal_set_old_path(const std::string& value) {
+  
+  _impl_.old_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LinkRequest::_internal_mutable_old_path() {
+  
+  return _impl_.old_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LinkRequest::release_old_path() {
+  // @@protoc_insertion_point(field_release:LinkRequest.old_path)
+  return _impl_.old_path_.Release();
+}
+inline void LinkRequest::set_allocated_old_path(std::string* old_path) {
+  if (old_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.old_path_.SetAllocated(old_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.old_path_.IsDefault()) {
+    _impl_.old_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:LinkRequest.old_path)
+}
+
+// string new_path = 2;
+inline void LinkRequest::clear_new_path() {
+  _impl_.new_path_.ClearToEmpty();
+}
+inline const std::string& LinkRequest::new_path() const {
+  // @@protoc_insertion_point(field_get:LinkRequest.new_path)
+  return _internal_new_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LinkRequest::set_new_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.new_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:LinkRequest.new_path)
+}
+inline std::string* LinkRequest::mutable_new_path() {
+  std::string* _s = _internal_mutable_new_path();
+  // @@protoc_insertion_point(field_mutable:LinkRequest.new_path)
+  return _s;
+}
+inline const std::string& LinkRequest::_internal_new_path() const {
+  return _impl_.new_path_.Get();
+}
+inline void LinkRequest::_internal_set_new_path(const std::string& value) {
+  
+  _impl_.new_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LinkRequest::_internal_mutable_new_path() {
+  
+  return _impl_.new_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LinkRequest::release_new_path() {
+  // @@protoc_insertion_point(field_release:LinkRequest.new_path)
+  return _impl_.new_path_.Release();
+}
+inline void LinkRequest::set_allocated_new_path(std::string* new_path) {
+  if (new_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.new_path_.SetAllocated(new_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.new_path_.IsDefault()) {
+    _impl_.new_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:LinkRequest.new_path)
+}
+
+// -------------------------------------------------------------------
+
+// LinkResponse
+
+// int32 error = 1;
+inline void LinkResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t LinkResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t LinkResponse::error() const {
+  // @@protoc_insertion_point(field_get:LinkResponse.error)
+  return _internal_error();
+}
+inline void LinkResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void LinkResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:LinkResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// SymlinkRequest
+
+// string old_path = 1;
+inline void SymlinkRequest::clear_old_path() {
+  _impl_.old_path_.ClearToEmpty();
+}
+inline const std::string& SymlinkRequest::old_path() const {
+  // @@protoc_insertion_point(field_get:SymlinkRequest.old_path)
+  return _internal_old_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SymlinkRequest::set_old_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.old_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SymlinkRequest.old_path)
+}
+inline std::string* SymlinkRequest::mutable_old_path() {
+  std::string* _s = _internal_mutable_old_path();
+  // @@protoc_insertion_point(field_mutable:SymlinkRequest.old_path)
+  return _s;
+}
+inline const std::string& SymlinkRequest::_internal_old_path() const {
+  return _impl_.old_path_.Get();
+}
+inline void SymlinkRequest::_internal_set_old_path(const std::string& value) {
+  
+  _impl_.old_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SymlinkRequest::_internal_mutable_old_path() {
+  
+  return _impl_.old_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SymlinkRequest::release_old_path() {
+  // @@protoc_insertion_point(field_release:SymlinkRequest.old_path)
+  return _impl_.old_path_.Release();
+}
+inline void SymlinkRequest::set_allocated_old_path(std::string* old_path) {
+  if (old_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.old_path_.SetAllocated(old_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.old_path_.IsDefault()) {
+    _impl_.old_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SymlinkRequest.old_path)
+}
+
+// string new_path = 2;
+inline void SymlinkRequest::clear_new_path() {
+  _impl_.new_path_.ClearToEmpty();
+}
+inline const std::string& SymlinkRequest::new_path() const {
+  // @@protoc_insertion_point(field_get:SymlinkRequest.new_path)
+  return _internal_new_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SymlinkRequest::set_new_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.new_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SymlinkRequest.new_path)
+}
+inline std::string* SymlinkRequest::mutable_new_path() {
+  std::string* _s = _internal_mutable_new_path();
+  // @@protoc_insertion_point(field_mutable:SymlinkRequest.new_path)
+  return _s;
+}
+inline const std::string& SymlinkRequest::_internal_new_path() const {
+  return _impl_.new_path_.Get();
+}
+inline void SymlinkRequest::_internal_set_new_path(const std::string& value) {
+  
+  _impl_.new_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SymlinkRequest::_internal_mutable_new_path() {
+  
+  return _impl_.new_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SymlinkRequest::release_new_path() {
+  // @@protoc_insertion_point(field_release:SymlinkRequest.new_path)
+  return _impl_.new_path_.Release();
+}
+inline void SymlinkRequest::set_allocated_new_path(std::string* new_path) {
+  if (new_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.new_path_.SetAllocated(new_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.new_path_.IsDefault()) {
+    _impl_.new_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SymlinkRequest.new_path)
+}
+
+// -------------------------------------------------------------------
+
+// SymlinkResponse
+
+// int32 error = 1;
+inline void SymlinkResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t SymlinkResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t SymlinkResponse::error() const {
+  // @@protoc_insertion_point(field_get:SymlinkResponse.error)
+  return _internal_error();
+}
+inline void SymlinkResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void SymlinkResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:SymlinkResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// ReadLinkRequest
+
+// string path = 1;
+inline void ReadLinkRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& ReadLinkRequest::path() const {
+  // @@protoc_insertion_point(field_get:ReadLinkRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadLinkRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ReadLinkRequest.path)
+}
+inline std::string* ReadLinkRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:ReadLinkRequest.path)
+  return _s;
+}
+inline const std::string& ReadLinkRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void ReadLinkRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadLinkRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadLinkRequest::release_path() {
+  // @@protoc_insertion_point(field_release:ReadLinkRequest.path)
+  return _impl_.path_.Release();
+}
+inline void ReadLinkRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ReadLinkRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// ReadLinkResponse
+
+// int32 error = 1;
+inline void ReadLinkResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ReadLinkResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ReadLinkResponse::error() const {
+  // @@protoc_insertion_point(field_get:ReadLinkResponse.error)
+  return _internal_error();
+}
+inline void ReadLinkResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ReadLinkResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ReadLinkResponse.error)
+}
+
+// string path = 2;
+inline void ReadLinkResponse::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& ReadLinkResponse::path() const {
+  // @@protoc_insertion_point(field_get:ReadLinkResponse.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadLinkResponse::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ReadLinkResponse.path)
+}
+inline std::string* ReadLinkResponse::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:ReadLinkResponse.path)
+  return _s;
+}
+inline const std::string& ReadLinkResponse::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void ReadLinkResponse::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadLinkResponse::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadLinkResponse::release_path() {
+  // @@protoc_insertion_point(field_release:ReadLinkResponse.path)
+  return _impl_.path_.Release();
+}
+inline void ReadLinkResponse::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ReadLinkResponse.path)
+}
+
+// -------------------------------------------------------------------
+
+// StatfsRequest
+
+// string path = 1;
+inline void StatfsRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& StatfsRequest::path() const {
+  // @@protoc_insertion_point(field_get:StatfsRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatfsRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:StatfsRequest.path)
+}
+inline std::string* StatfsRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:StatfsRequest.path)
+  return _s;
+}
+inline const std::string& StatfsRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void StatfsRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StatfsRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatfsRequest::release_path() {
+  // @@protoc_insertion_point(field_release:StatfsRequest.path)
+  return _impl_.path_.Release();
+}
+inline void StatfsRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:StatfsRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// StatfsResponse
+
+// int32 error = 1;
+inline void StatfsResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t StatfsResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t StatfsResponse::error() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.error)
+  return _internal_error();
+}
+inline void StatfsResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void StatfsResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.error)
+}
+
+// int64 frsize = 2;
+inline void StatfsResponse::clear_frsize() {
+  _impl_.frsize_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_frsize() const {
+  return _impl_.frsize_;
+}
+inline int64_t StatfsResponse::frsize() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.frsize)
+  return _internal_frsize();
+}
+inline void StatfsResponse::_internal_set_frsize(int64_t value) {
+  
+  _impl_.frsize_ = value;
+}
+inline void StatfsResponse::set_frsize(int64_t value) {
+  _internal_set_frsize(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.frsize)
+}
+
+// int64 blocks = 3;
+inline void StatfsResponse::clear_blocks() {
+  _impl_.blocks_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_blocks() const {
+  return _impl_.blocks_;
+}
+inline int64_t StatfsResponse::blocks() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.blocks)
+  return _internal_blocks();
+}
+inline void StatfsResponse::_internal_set_blocks(int64_t value) {
+  
+  _impl_.blocks_ = value;
+}
+inline void StatfsResponse::set_blocks(int64_t value) {
+  _internal_set_blocks(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.blocks)
+}
+
+// int64 bfree = 4;
+inline void StatfsResponse::clear_bfree() {
+  _impl_.bfree_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_bfree() const {
+  return _impl_.bfree_;
+}
+inline int64_t StatfsResponse::bfree() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.bfree)
+  return _internal_bfree();
+}
+inline void StatfsResponse::_internal_set_bfree(int64_t value) {
+  
+  _impl_.bfree_ = value;
+}
+inline void StatfsResponse::set_bfree(int64_t value) {
+  _internal_set_bfree(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.bfree)
+}
+
+// int64 bavail = 5;
+inline void StatfsResponse::clear_bavail() {
+  _impl_.bavail_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_bavail() const {
+  return _impl_.bavail_;
+}
+inline int64_t StatfsResponse::bavail() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.bavail)
+  return _internal_bavail();
+}
+inline void StatfsResponse::_internal_set_bavail(int64_t value) {
+  
+  _impl_.bavail_ = value;
+}
+inline void StatfsResponse::set_bavail(int64_t value) {
+  _internal_set_bavail(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.bavail)
+}
+
+// int64 bsize = 6;
+inline void StatfsResponse::clear_bsize() {
+  _impl_.bsize_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_bsize() const {
+  return _impl_.bsize_;
+}
+inline int64_t StatfsResponse::bsize() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.bsize)
+  return _internal_bsize();
+}
+inline void StatfsResponse::_internal_set_bsize(int64_t value) {
+  
+  _impl_.bsize_ = value;
+}
+inline void StatfsResponse::set_bsize(int64_t value) {
+  _internal_set_bsize(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.bsize)
+}
+
+// int64 files = 7;
+inline void StatfsResponse::clear_files() {
+  _impl_.files_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_files() const {
+  return _impl_.files_;
+}
+inline int64_t StatfsResponse::files() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.files)
+  return _internal_files();
+}
+inline void StatfsResponse::_internal_set_files(int64_t value) {
+  
+  _impl_.files_ = value;
+}
+inline void StatfsResponse::set_files(int64_t value) {
+  _internal_set_files(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.files)
+}
+
+// int64 ffree = 8;
+inline void StatfsResponse::clear_ffree() {
+  _impl_.ffree_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_ffree() const {
+  return _impl_.ffree_;
+}
+inline int64_t StatfsResponse::ffree() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.ffree)
+  return _internal_ffree();
+}
+inline void StatfsResponse::_internal_set_ffree(int64_t value) {
+  
+  _impl_.ffree_ = value;
+}
+inline void StatfsResponse::set_ffree(int64_t value) {
+  _internal_set_ffree(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.ffree)
+}
+
+// int64 namemax = 9;
+inline void StatfsResponse::clear_namemax() {
+  _impl_.namemax_ = int64_t{0};
+}
+inline int64_t StatfsResponse::_internal_namemax() const {
+  return _impl_.namemax_;
+}
+inline int64_t StatfsResponse::namemax() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.namemax)
+  return _internal_namemax();
+}
+inline void StatfsResponse::_internal_set_namemax(int64_t value) {
+  
+  _impl_.namemax_ = value;
+}
+inline void StatfsResponse::set_namemax(int64_t value) {
+  _internal_set_namemax(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.namemax)
+}
+
+// int32 type = 10;
+inline void StatfsResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline int32_t StatfsResponse::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t StatfsResponse::type() const {
+  // @@protoc_insertion_point(field_get:StatfsResponse.type)
+  return _internal_type();
+}
+inline void StatfsResponse::_internal_set_type(int32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void StatfsResponse::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:StatfsResponse.type)
+}
+
+// -------------------------------------------------------------------
+
+// FsyncRequest
+
+// int32 fd = 1;
+inline void FsyncRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t FsyncRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t FsyncRequest::fd() const {
+  // @@protoc_insertion_point(field_get:FsyncRequest.fd)
+  return _internal_fd();
+}
+inline void FsyncRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void FsyncRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:FsyncRequest.fd)
+}
+
+// bool datasync = 2;
+inline void FsyncRequest::clear_datasync() {
+  _impl_.datasync_ = false;
+}
+inline bool FsyncRequest::_internal_datasync() const {
+  return _impl_.datasync_;
+}
+inline bool FsyncRequest::datasync() const {
+  // @@protoc_insertion_point(field_get:FsyncRequest.datasync)
+  return _internal_datasync();
+}
+inline void FsyncRequest::_internal_set_datasync(bool value) {
+  
+  _impl_.datasync_ = value;
+}
+inline void FsyncRequest::set_datasync(bool value) {
+  _internal_set_datasync(value);
+  // @@protoc_insertion_point(field_set:FsyncRequest.datasync)
+}
+
+// -------------------------------------------------------------------
+
+// FsyncResponse
+
+// int32 error = 1;
+inline void FsyncResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t FsyncResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t FsyncResponse::error() const {
+  // @@protoc_insertion_point(field_get:FsyncResponse.error)
+  return _internal_error();
+}
+inline void FsyncResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void FsyncResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:FsyncResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// SetxattrRequest
+
+// string path = 1;
+inline void SetxattrRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& SetxattrRequest::path() const {
+  // @@protoc_insertion_point(field_get:SetxattrRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetxattrRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SetxattrRequest.path)
+}
+inline std::string* SetxattrRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:SetxattrRequest.path)
+  return _s;
+}
+inline const std::string& SetxattrRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void SetxattrRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetxattrRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetxattrRequest::release_path() {
+  // @@protoc_insertion_point(field_release:SetxattrRequest.path)
+  return _impl_.path_.Release();
+}
+inline void SetxattrRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SetxattrRequest.path)
+}
+
+// string name = 2;
+inline void SetxattrRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SetxattrRequest::name() const {
+  // @@protoc_insertion_point(field_get:SetxattrRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetxattrRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SetxattrRequest.name)
+}
+inline std::string* SetxattrRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:SetxattrRequest.name)
+  return _s;
+}
+inline const std::string& SetxattrRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SetxattrRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetxattrRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetxattrRequest::release_name() {
+  // @@protoc_insertion_point(field_release:SetxattrRequest.name)
+  return _impl_.name_.Release();
+}
+inline void SetxattrRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SetxattrRequest.name)
+}
+
+// bytes value = 3;
+inline void SetxattrRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& SetxattrRequest::value() const {
+  // @@protoc_insertion_point(field_get:SetxattrRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetxattrRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SetxattrRequest.value)
+}
+inline std::string* SetxattrRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:SetxattrRequest.value)
+  return _s;
+}
+inline const std::string& SetxattrRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void SetxattrRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetxattrRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetxattrRequest::release_value() {
+  // @@protoc_insertion_point(field_release:SetxattrRequest.value)
+  return _impl_.value_.Release();
+}
+inline void SetxattrRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SetxattrRequest.value)
+}
+
+// int32 flags = 4;
+inline void SetxattrRequest::clear_flags() {
+  _impl_.flags_ = 0;
+}
+inline int32_t SetxattrRequest::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t SetxattrRequest::flags() const {
+  // @@protoc_insertion_point(field_get:SetxattrRequest.flags)
+  return _internal_flags();
+}
+inline void SetxattrRequest::_internal_set_flags(int32_t value) {
+  
+  _impl_.flags_ = value;
+}
+inline void SetxattrRequest::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:SetxattrRequest.flags)
+}
+
+// -------------------------------------------------------------------
+
+// SetxattrResponse
+
+// int32 error = 1;
+inline void SetxattrResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t SetxattrResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t SetxattrResponse::error() const {
+  // @@protoc_insertion_point(field_get:SetxattrResponse.error)
+  return _internal_error();
+}
+inline void SetxattrResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void SetxattrResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:SetxattrResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// GetxattrRequest
+
+// string path = 1;
+inline void GetxattrRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& GetxattrRequest::path() const {
+  // @@protoc_insertion_point(field_get:GetxattrRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetxattrRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetxattrRequest.path)
+}
+inline std::string* GetxattrRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:GetxattrRequest.path)
+  return _s;
+}
+inline const std::string& GetxattrRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void GetxattrRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetxattrRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetxattrRequest::release_path() {
+  // @@protoc_insertion_point(field_release:GetxattrRequest.path)
+  return _impl_.path_.Release();
+}
+inline void GetxattrRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetxattrRequest.path)
+}
+
+// string name = 2;
+inline void GetxattrRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& GetxattrRequest::name() const {
+  // @@protoc_insertion_point(field_get:GetxattrRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetxattrRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetxattrRequest.name)
+}
+inline std::string* GetxattrRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:GetxattrRequest.name)
+  return _s;
+}
+inline const std::string& GetxattrRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void GetxattrRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetxattrRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetxattrRequest::release_name() {
+  // @@protoc_insertion_point(field_release:GetxattrRequest.name)
+  return _impl_.name_.Release();
+}
+inline void GetxattrRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetxattrRequest.name)
+}
+
+// -------------------------------------------------------------------
+
+// GetxattrResponse
+
+// int32 error = 1;
+inline void GetxattrResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t GetxattrResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t GetxattrResponse::error() const {
+  // @@protoc_insertion_point(field_get:GetxattrResponse.error)
+  return _internal_error();
+}
+inline void GetxattrResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void GetxattrResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:GetxattrResponse.error)
+}
+
+// bytes value = 2;
+inline void GetxattrResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetxattrResponse::value() const {
+  // @@protoc_insertion_point(field_get:GetxattrResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetxattrResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetxattrResponse.value)
+}
+inline std::string* GetxattrResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:GetxattrResponse.value)
+  return _s;
+}
+inline const std::string& GetxattrResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetxattrResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetxattrResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetxattrResponse::release_value() {
+  // @@protoc_insertion_point(field_release:GetxattrResponse.value)
+  return _impl_.value_.Release();
+}
+inline void GetxattrResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetxattrResponse.value)
+}
+
+// -------------------------------------------------------------------
+
+// ListxattrRequest
+
+// string path = 1;
+inline void ListxattrRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& ListxattrRequest::path() const {
+  // @@protoc_insertion_point(field_get:ListxattrRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListxattrRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ListxattrRequest.path)
+}
+inline std::string* ListxattrRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:ListxattrRequest.path)
+  return _s;
+}
+inline const std::string& ListxattrRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void ListxattrRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListxattrRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListxattrRequest::release_path() {
+  // @@protoc_insertion_point(field_release:ListxattrRequest.path)
+  return _impl_.path_.Release();
+}
+inline void ListxattrRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ListxattrRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// ListxattrResponse
+
+// int32 error = 1;
+inline void ListxattrResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ListxattrResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ListxattrResponse::error() const {
+  // @@protoc_insertion_point(field_get:ListxattrResponse.error)
+  return _internal_error();
+}
+inline void ListxattrResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ListxattrResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ListxattrResponse.error)
+}
+
+// repeated string names = 2;
+inline int ListxattrResponse::_internal_names_size() const {
+  return _impl_.names_.size();
+}
+inline int ListxattrResponse::names_size() const {
+  return _internal_names_size();
+}
+inline void ListxattrResponse::clear_names() {
+  _impl_.names_.Clear();
+}
+inline std::string* ListxattrResponse::add_names() {
+  std::string* _s = _internal_add_names();
+  // @@protoc_insertion_point(field_add_mutable:ListxattrResponse.names)
+  return _s;
+}
+inline const std::string& ListxattrResponse::_internal_names(int index) const {
+  return _impl_.names_.Get(index);
+}
+inline const std::string& ListxattrResponse::names(int index) const {
+  // @@protoc_insertion_point(field_get:ListxattrResponse.names)
+  return _internal_names(index);
+}
+inline std::string* ListxattrResponse::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:ListxattrResponse.names)
+  return _impl_.names_.Mutable(index);
+}
+inline void ListxattrResponse::set_names(int index, const std::string& value) {
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ListxattrResponse.names)
+}
+inline void ListxattrResponse::set_names(int index, std::string&& value) {
+  _impl_.names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ListxattrResponse.names)
+}
+inline void ListxattrResponse::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ListxattrResponse.names)
+}
+inline void ListxattrResponse::set_names(int index, const char* value, size_t size) {
+  _impl_.names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ListxattrResponse.names)
+}
+inline std::string* ListxattrResponse::_internal_add_names() {
+  return _impl_.names_.Add();
+}
+inline void ListxattrResponse::add_names(const std::string& value) {
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ListxattrResponse.names)
+}
+inline void ListxattrResponse::add_names(std::string&& value) {
+  _impl_.names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ListxattrResponse.names)
+}
+inline void ListxattrResponse::add_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ListxattrResponse.names)
+}
+inline void ListxattrResponse::add_names(const char* value, size_t size) {
+  _impl_.names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ListxattrResponse.names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ListxattrResponse::names() const {
+  // @@protoc_insertion_point(field_list:ListxattrResponse.names)
+  return _impl_.names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ListxattrResponse::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:ListxattrResponse.names)
+  return &_impl_.names_;
+}
+
+// -------------------------------------------------------------------
+
+// RemovexattrRequest
+
+// string path = 1;
+inline void RemovexattrRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& RemovexattrRequest::path() const {
+  // @@protoc_insertion_point(field_get:RemovexattrRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemovexattrRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RemovexattrRequest.path)
+}
+inline std::string* RemovexattrRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:RemovexattrRequest.path)
+  return _s;
+}
+inline const std::string& RemovexattrRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void RemovexattrRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RemovexattrRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RemovexattrRequest::release_path() {
+  // @@protoc_insertion_point(field_release:RemovexattrRequest.path)
+  return _impl_.path_.Release();
+}
+inline void RemovexattrRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RemovexattrRequest.path)
+}
+
+// string name = 2;
+inline void RemovexattrRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RemovexattrRequest::name() const {
+  // @@protoc_insertion_point(field_get:RemovexattrRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemovexattrRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RemovexattrRequest.name)
+}
+inline std::string* RemovexattrRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:RemovexattrRequest.name)
+  return _s;
+}
+inline const std::string& RemovexattrRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RemovexattrRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RemovexattrRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RemovexattrRequest::release_name() {
+  // @@protoc_insertion_point(field_release:RemovexattrRequest.name)
+  return _impl_.name_.Release();
+}
+inline void RemovexattrRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RemovexattrRequest.name)
+}
+
+// -------------------------------------------------------------------
+
+// RemovexattrResponse
+
+// int32 error = 1;
+inline void RemovexattrResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t RemovexattrResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t RemovexattrResponse::error() const {
+  // @@protoc_insertion_point(field_get:RemovexattrResponse.error)
+  return _internal_error();
+}
+inline void RemovexattrResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void RemovexattrResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:RemovexattrResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// OpendirRequest
+
+// string path = 1;
+inline void OpendirRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& OpendirRequest::path() const {
+  // @@protoc_insertion_point(field_get:OpendirRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpendirRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:OpendirRequest.path)
+}
+inline std::string* OpendirRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:OpendirRequest.path)
+  return _s;
+}
+inline const std::string& OpendirRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void OpendirRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpendirRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpendirRequest::release_path() {
+  // @@protoc_insertion_point(field_release:OpendirRequest.path)
+  return _impl_.path_.Release();
+}
+inline void OpendirRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:OpendirRequest.path)
+}
+
+// uint64 token = 2;
+inline void OpendirRequest::clear_token() {
+  _impl_.token_ = uint64_t{0u};
+}
+inline uint64_t OpendirRequest::_internal_token() const {
+  return _impl_.token_;
+}
+inline uint64_t OpendirRequest::token() const {
+  // @@protoc_insertion_point(field_get:OpendirRequest.token)
+  return _internal_token();
+}
+inline void OpendirRequest::_internal_set_token(uint64_t value) {
+  
+  _impl_.token_ = value;
+}
+inline void OpendirRequest::set_token(uint64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:OpendirRequest.token)
+}
+
+// -------------------------------------------------------------------
+
+// OpendirResponse
+
+// int32 error = 1;
+inline void OpendirResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t OpendirResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t OpendirResponse::error() const {
+  // @@protoc_insertion_point(field_get:OpendirResponse.error)
+  return _internal_error();
+}
+inline void OpendirResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void OpendirResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:OpendirResponse.error)
+}
+
+// int32 directory_descriptor = 2;
+inline void OpendirResponse::clear_directory_descriptor() {
+  _impl_.directory_descriptor_ = 0;
+}
+inline int32_t OpendirResponse::_internal_directory_descriptor() const {
+  return _impl_.directory_descriptor_;
+}
+inline int32_t OpendirResponse::directory_descriptor() const {
+  // @@protoc_insertion_point(field_get:OpendirResponse.directory_descriptor)
+  return _internal_directory_descriptor();
+}
+inline void OpendirResponse::_internal_set_directory_descriptor(int32_t value) {
+  
+  _impl_.directory_descriptor_ = value;
+}
+inline void OpendirResponse::set_directory_descriptor(int32_t value) {
+  _internal_set_directory_descriptor(value);
+  // @@protoc_insertion_point(field_set:OpendirResponse.directory_descriptor)
+}
+
+// -------------------------------------------------------------------
+
+// ReleasedirRequest
+
+// int32 directory_descriptor = 1;
+inline void ReleasedirRequest::clear_directory_descriptor() {
+  _impl_.directory_descriptor_ = 0;
+}
+inline int32_t ReleasedirRequest::_internal_directory_descriptor() const {
+  return _impl_.directory_descriptor_;
+}
+inline int32_t ReleasedirRequest::directory_descriptor() const {
+  // @@protoc_insertion_point(field_get:ReleasedirRequest.directory_descriptor)
+  return _internal_directory_descriptor();
+}
+inline void ReleasedirRequest::_internal_set_directory_descriptor(int32_t value) {
+  
+  _impl_.directory_descriptor_ = value;
+}
+inline void ReleasedirRequest::set_directory_descriptor(int32_t value) {
+  _internal_set_directory_descriptor(value);
+  // @@protoc_insertion_point(field_set:ReleasedirRequest.directory_descriptor)
+}
+
+// -------------------------------------------------------------------
+
+// ReleasedirResponse
+
+// int32 error = 1;
+inline void ReleasedirResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ReleasedirResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ReleasedirResponse::error() const {
+  // @@protoc_insertion_point(field_get:ReleasedirResponse.error)
+  return _internal_error();
+}
+inline void ReleasedirResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ReleasedirResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ReleasedirResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// FsyncdirRequest
+
+// int32 directory_descriptor = 1;
+inline void FsyncdirRequest::clear_directory_descriptor() {
+  _impl_.directory_descriptor_ = 0;
+}
+inline int32_t FsyncdirRequest::_internal_directory_descriptor() const {
+  return _impl_.directory_descriptor_;
+}
+inline int32_t FsyncdirRequest::directory_descriptor() const {
+  // @@protoc_insertion_point(field_get:FsyncdirRequest.directory_descriptor)
+  return _internal_directory_descriptor();
+}
+inline void FsyncdirRequest::_internal_set_directory_descriptor(int32_t value) {
+  
+  _impl_.directory_descriptor_ = value;
+}
+inline void FsyncdirRequest::set_directory_descriptor(int32_t value) {
+  _internal_set_directory_descriptor(value);
+  // @@protoc_insertion_point(field_set:FsyncdirRequest.directory_descriptor)
+}
+
+// -------------------------------------------------------------------
+
+// FsyncdirResponse
+
+// int32 error = 1;
+inline void FsyncdirResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t FsyncdirResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t FsyncdirResponse::error() const {
+  // @@protoc_insertion_point(field_get:FsyncdirResponse.error)
+  return _internal_error();
+}
+inline void FsyncdirResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void FsyncdirResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:FsyncdirResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// UtimensRequest
+
+// string path = 1;
+inline void UtimensRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& UtimensRequest::path() const {
+  // @@protoc_insertion_point(field_get:UtimensRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UtimensRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:UtimensRequest.path)
+}
+inline std::string* UtimensRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:UtimensRequest.path)
+  return _s;
+}
+inline const std::string& UtimensRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void UtimensRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UtimensRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UtimensRequest::release_path() {
+  // @@protoc_insertion_point(field_release:UtimensRequest.path)
+  return _impl_.path_.Release();
+}
+inline void UtimensRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:UtimensRequest.path)
+}
+
+// int64 atime = 2;
+inline void UtimensRequest::clear_atime() {
+  _impl_.atime_ = int64_t{0};
+}
+inline int64_t UtimensRequest::_internal_atime() const {
+  return _impl_.atime_;
+}
+inline int64_t UtimensRequest::atime() const {
+  // @@protoc_insertion_point(field_get:UtimensRequest.atime)
+  return _internal_atime();
+}
+inline void UtimensRequest::_internal_set_atime(int64_t value) {
+  
+  _impl_.atime_ = value;
+}
+inline void UtimensRequest::set_atime(int64_t value) {
+  _internal_set_atime(value);
+  // @@protoc_insertion_point(field_set:UtimensRequest.atime)
+}
+
+// int64 mtime = 3;
+inline void UtimensRequest::clear_mtime() {
+  _impl_.mtime_ = int64_t{0};
+}
+inline int64_t UtimensRequest::_internal_mtime() const {
+  return _impl_.mtime_;
+}
+inline int64_t UtimensRequest::mtime() const {
+  // @@protoc_insertion_point(field_get:UtimensRequest.mtime)
+  return _internal_mtime();
+}
+inline void UtimensRequest::_internal_set_mtime(int64_t value) {
+  
+  _impl_.mtime_ = value;
+}
+inline void UtimensRequest::set_mtime(int64_t value) {
+  _internal_set_mtime(value);
+  // @@protoc_insertion_point(field_set:UtimensRequest.mtime)
+}
+
+// -------------------------------------------------------------------
+
+// UtimensResponse
+
+// int32 error = 1;
+inline void UtimensResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t UtimensResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t UtimensResponse::error() const {
+  // @@protoc_insertion_point(field_get:UtimensResponse.error)
+  return _internal_error();
+}
+inline void UtimensResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void UtimensResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:UtimensResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// AccessRequest
+
+// string path = 1;
+inline void AccessRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& AccessRequest::path() const {
+  // @@protoc_insertion_point(field_get:AccessRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AccessRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:AccessRequest.path)
+}
+inline std::string* AccessRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:AccessRequest.path)
+  return _s;
+}
+inline const std::string& AccessRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void AccessRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AccessRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AccessRequest::release_path() {
+  // @@protoc_insertion_point(field_release:AccessRequest.path)
+  return _impl_.path_.Release();
+}
+inline void AccessRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:AccessRequest.path)
+}
+
+// int32 mode = 2;
+inline void AccessRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t AccessRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t AccessRequest::mode() const {
+  // @@protoc_insertion_point(field_get:AccessRequest.mode)
+  return _internal_mode();
+}
+inline void AccessRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void AccessRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:AccessRequest.mode)
+}
+
+// -------------------------------------------------------------------
+
+// AccessResponse
+
+// int32 error = 1;
+inline void AccessResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t AccessResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t AccessResponse::error() const {
+  // @@protoc_insertion_point(field_get:AccessResponse.error)
+  return _internal_error();
+}
+inline void AccessResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void AccessResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:AccessResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// Lock
+
+// int32 l_type = 3;
+inline void Lock::clear_l_type() {
+  _impl_.l_type_ = 0;
+}
+inline int32_t Lock::_internal_l_type() const {
+  return _impl_.l_type_;
+}
+inline int32_t Lock::l_type() const {
+  // @@protoc_insertion_point(field_get:Lock.l_type)
+  return _internal_l_type();
+}
+inline void Lock::_internal_set_l_type(int32_t value) {
+  
+  _impl_.l_type_ = value;
+}
+inline void Lock::set_l_type(int32_t value) {
+  _internal_set_l_type(value);
+  // @@protoc_insertion_point(field_set:Lock.l_type)
+}
+
+// int32 l_whence = 4;
+inline void Lock::clear_l_whence() {
+  _impl_.l_whence_ = 0;
+}
+inline int32_t Lock::_internal_l_whence() const {
+  return _impl_.l_whence_;
+}
+inline int32_t Lock::l_whence() const {
+  // @@protoc_insertion_point(field_get:Lock.l_whence)
+  return _internal_l_whence();
+}
+inline void Lock::_internal_set_l_whence(int32_t value) {
+  
+  _impl_.l_whence_ = value;
+}
+inline void Lock::set_l_whence(int32_t value) {
+  _internal_set_l_whence(value);
+  // @@protoc_insertion_point(field_set:Lock.l_whence)
+}
+
+// int64 l_start = 5;
+inline void Lock::clear_l_start() {
+  _impl_.l_start_ = int64_t{0};
+}
+inline int64_t Lock::_internal_l_start() const {
+  return _impl_.l_start_;
+}
+inline int64_t Lock::l_start() const {
+  // @@protoc_insertion_point(field_get:Lock.l_start)
+  return _internal_l_start();
+}
+inline void Lock::_internal_set_l_start(int64_t value) {
+  
+  _impl_.l_start_ = value;
+}
+inline void Lock::set_l_start(int64_t value) {
+  _internal_set_l_start(value);
+  // @@protoc_insertion_point(field_set:Lock.l_start)
+}
+
+// int64 l_len = 6;
+inline void Lock::clear_l_len() {
+  _impl_.l_len_ = int64_t{0};
+}
+inline int64_t Lock::_internal_l_len() const {
+  return _impl_.l_len_;
+}
+inline int64_t Lock::l_len() const {
+  // @@protoc_insertion_point(field_get:Lock.l_len)
+  return _internal_l_len();
+}
+inline void Lock::_internal_set_l_len(int64_t value) {
+  
+  _impl_.l_len_ = value;
+}
+inline void Lock::set_l_len(int64_t value) {
+  _internal_set_l_len(value);
+  // @@protoc_insertion_point(field_set:Lock.l_len)
+}
+
+// -------------------------------------------------------------------
+
+// LockRequest
+
+// int32 fd = 1;
+inline void LockRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t LockRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t LockRequest::fd() const {
+  // @@protoc_insertion_point(field_get:LockRequest.fd)
+  return _internal_fd();
+}
+inline void LockRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void LockRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:LockRequest.fd)
+}
+
+// int32 cmd = 2;
+inline void LockRequest::clear_cmd() {
+  _impl_.cmd_ = 0;
+}
+inline int32_t LockRequest::_internal_cmd() const {
+  return _impl_.cmd_;
+}
+inline int32_t LockRequest::cmd() const {
+  // @@protoc_insertion_point(field_get:LockRequest.cmd)
+  return _internal_cmd();
+}
+inline void LockRequest::_internal_set_cmd(int32_t value) {
+  
+  _impl_.cmd_ = value;
+}
+inline void LockRequest::set_cmd(int32_t value) {
+  _internal_set_cmd(value);
+  // @@protoc_insertion_point(field_set:LockRequest.cmd)
+}
+
+// .Lock lock = 3;
+inline bool LockRequest::_internal_has_lock() const {
+  return this != internal_default_instance() && _impl_.lock_ != nullptr;
+}
+inline bool LockRequest::has_lock() const {
+  return _internal_has_lock();
+}
+inline void LockRequest::clear_lock() {
+  if (GetArenaForAllocation() == nullptr && _impl_.lock_ != nullptr) {
+    delete _impl_.lock_;
+  }
+  _impl_.lock_ = nullptr;
+}
+inline const ::Lock& LockRequest::_internal_lock() const {
+  const ::Lock* p = _impl_.lock_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lock&>(
+      ::_Lock_default_instance_);
+}
+inline const ::Lock& LockRequest::lock() const {
+  // @@protoc_insertion_point(field_get:LockRequest.lock)
+  return _internal_lock();
+}
+inline void LockRequest::unsafe_arena_set_allocated_lock(
+    ::Lock* lock) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lock_);
+  }
+  _impl_.lock_ = lock;
+  if (lock) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:LockRequest.lock)
+}
+inline ::Lock* LockRequest::release_lock() {
+  
+  ::Lock* temp = _impl_.lock_;
+  _impl_.lock_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lock* LockRequest::unsafe_arena_release_lock() {
+  // @@protoc_insertion_point(field_release:LockRequest.lock)
+  
+  ::Lock* temp = _impl_.lock_;
+  _impl_.lock_ = nullptr;
+  return temp;
+}
+inline ::Lock* LockRequest::_internal_mutable_lock() {
+  
+  if (_impl_.lock_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lock>(GetArenaForAllocation());
+    _impl_.lock_ = p;
+  }
+  return _impl_.lock_;
+}
+inline ::Lock* LockRequest::mutable_lock() {
+  ::Lock* _msg = _internal_mutable_lock();
+  // @@protoc_insertion_point(field_mutable:LockRequest.lock)
+  return _msg;
+}
+inline void LockRequest::set_allocated_lock(::Lock* lock) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lock_;
+  }
+  if (lock) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lock);
+    if (message_arena != submessage_arena) {
+      lock = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lock, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.lock_ = lock;
+  // @@protoc_insertion_point(field_set_allocated:LockRequest.lock)
+}
+
+// -------------------------------------------------------------------
+
+// LockResponse
+
+// int32 error = 1;
+inline void LockResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t LockResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t LockResponse::error() const {
+  // @@protoc_insertion_point(field_get:LockResponse.error)
+  return _internal_error();
+}
+inline void LockResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void LockResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:LockResponse.error)
+}
+
+// optional .Lock lock = 2;
+inline bool LockResponse::_internal_has_lock() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.lock_ != nullptr);
+  return value;
+}
+inline bool LockResponse::has_lock() const {
+  return _internal_has_lock();
+}
+inline void LockResponse::clear_lock() {
+  if (_impl_.lock_ != nullptr) _impl_.lock_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Lock& LockResponse::_internal_lock() const {
+  const ::Lock* p = _impl_.lock_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lock&>(
+      ::_Lock_default_instance_);
+}
+inline const ::Lock& LockResponse::lock() const {
+  // @@protoc_insertion_point(field_get:LockResponse.lock)
+  return _internal_lock();
+}
+inline void LockResponse::unsafe_arena_set_allocated_lock(
+    ::Lock* lock) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lock_);
+  }
+  _impl_.lock_ = lock;
+  if (lock) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:LockResponse.lock)
+}
+inline ::Lock* LockResponse::release_lock() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Lock* temp = _impl_.lock_;
+  _impl_.lock_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lock* LockResponse::unsafe_arena_release_lock() {
+  // @@protoc_insertion_point(field_release:LockResponse.lock)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Lock* temp = _impl_.lock_;
+  _impl_.lock_ = nullptr;
+  return temp;
+}
+inline ::Lock* LockResponse::_internal_mutable_lock() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.lock_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lock>(GetArenaForAllocation());
+    _impl_.lock_ = p;
+  }
+  return _impl_.lock_;
+}
+inline ::Lock* LockResponse::mutable_lock() {
+  ::Lock* _msg = _internal_mutable_lock();
+  // @@protoc_insertion_point(field_mutable:LockResponse.lock)
+  return _msg;
+}
+inline void LockResponse::set_allocated_lock(::Lock* lock) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lock_;
+  }
+  if (lock) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lock);
+    if (message_arena != submessage_arena) {
+      lock = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lock, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.lock_ = lock;
+  // @@protoc_insertion_point(field_set_allocated:LockResponse.lock)
+}
+
+// -------------------------------------------------------------------
+
+// FlockRequest
+
+// int32 fd = 1;
+inline void FlockRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t FlockRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t FlockRequest::fd() const {
+  // @@protoc_insertion_point(field_get:FlockRequest.fd)
+  return _internal_fd();
+}
+inline void FlockRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void FlockRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:FlockRequest.fd)
+}
+
+// int32 op = 2;
+inline void FlockRequest::clear_op() {
+  _impl_.op_ = 0;
+}
+inline int32_t FlockRequest::_internal_op() const {
+  return _impl_.op_;
+}
+inline int32_t FlockRequest::op() const {
+  // @@protoc_insertion_point(field_get:FlockRequest.op)
+  return _internal_op();
+}
+inline void FlockRequest::_internal_set_op(int32_t value) {
+  
+  _impl_.op_ = value;
+}
+inline void FlockRequest::set_op(int32_t value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:FlockRequest.op)
+}
+
+// -------------------------------------------------------------------
+
+// FlockResponse
+
+// int32 error = 1;
+inline void FlockResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t FlockResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t FlockResponse::error() const {
+  // @@protoc_insertion_point(field_get:FlockResponse.error)
+  return _internal_error();
+}
+inline void FlockResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void FlockResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:FlockResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// FallocateRequest
+
+// int32 fd = 1;
+inline void FallocateRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t FallocateRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t FallocateRequest::fd() const {
+  // @@protoc_insertion_point(field_get:FallocateRequest.fd)
+  return _internal_fd();
+}
+inline void FallocateRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void FallocateRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:FallocateRequest.fd)
+}
+
+// int32 mode = 2;
+inline void FallocateRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t FallocateRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t FallocateRequest::mode() const {
+  // @@protoc_insertion_point(field_get:FallocateRequest.mode)
+  return _internal_mode();
+}
+inline void FallocateRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void FallocateRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:FallocateRequest.mode)
+}
+
+// int64 offset = 3;
+inline void FallocateRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t FallocateRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t FallocateRequest::offset() const {
+  // @@protoc_insertion_point(field_get:FallocateRequest.offset)
+  return _internal_offset();
+}
+inline void FallocateRequest::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void FallocateRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:FallocateRequest.offset)
+}
+
+// int64 len = 4;
+inline void FallocateRequest::clear_len() {
+  _impl_.len_ = int64_t{0};
+}
+inline int64_t FallocateRequest::_internal_len() const {
+  return _impl_.len_;
+}
+inline int64_t FallocateRequest::len() const {
+  // @@protoc_insertion_point(field_get:FallocateRequest.len)
+  return _internal_len();
+}
+inline void FallocateRequest::_internal_set_len(int64_t value) {
+  
+  _impl_.len_ = value;
+}
+inline void FallocateRequest::set_len(int64_t value) {
+  _internal_set_len(value);
+  // @@protoc_insertion_point(field_set:FallocateRequest.len)
+}
+
+// -------------------------------------------------------------------
+
+// FallocateResponse
+
+// int32 error = 1;
+inline void FallocateResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t FallocateResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t FallocateResponse::error() const {
+  // @@protoc_insertion_point(field_get:FallocateResponse.error)
+  return _internal_error();
+}
+inline void FallocateResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void FallocateResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:FallocateResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// LseekRequest
+
+// int32 fd = 1;
+inline void LseekRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t LseekRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t LseekRequest::fd() const {
+  // @@protoc_insertion_point(field_get:LseekRequest.fd)
+  return _internal_fd();
+}
+inline void LseekRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void LseekRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:LseekRequest.fd)
+}
+
+// int64 offset = 2;
+inline void LseekRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t LseekRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t LseekRequest::offset() const {
+  // @@protoc_insertion_point(field_get:LseekRequest.offset)
+  return _internal_offset();
+}
+inline void LseekRequest::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void LseekRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:LseekRequest.offset)
+}
+
+// int32 whence = 3;
+inline void LseekRequest::clear_whence() {
+  _impl_.whence_ = 0;
+}
+inline int32_t LseekRequest::_internal_whence() const {
+  return _impl_.whence_;
+}
+inline int32_t LseekRequest::whence() const {
+  // @@protoc_insertion_point(field_get:LseekRequest.whence)
+  return _internal_whence();
+}
+inline void LseekRequest::_internal_set_whence(int32_t value) {
+  
+  _impl_.whence_ = value;
+}
+inline void LseekRequest::set_whence(int32_t value) {
+  _internal_set_whence(value);
+  // @@protoc_insertion_point(field_set:LseekRequest.whence)
+}
+
+// -------------------------------------------------------------------
+
+// LseekResponse
+
+// int32 error = 1;
+inline void LseekResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t LseekResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t LseekResponse::error() const {
+  // @@protoc_insertion_point(field_get:LseekResponse.error)
+  return _internal_error();
+}
+inline void LseekResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void LseekResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:LseekResponse.error)
+}
+
+// int64 offset = 2;
+inline void LseekResponse::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t LseekResponse::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t LseekResponse::offset() const {
+  // @@protoc_insertion_point(field_get:LseekResponse.offset)
+  return _internal_offset();
+}
+inline void LseekResponse::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void LseekResponse::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:LseekResponse.offset)
+}
+
+// -------------------------------------------------------------------
+
+// LspRequest
+
+// string payload = 1;
+inline void LspRequest::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+}
+inline const std::string& LspRequest::payload() const {
+  // @@protoc_insertion_point(field_get:LspRequest.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LspRequest::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:LspRequest.payload)
+}
+inline std::string* LspRequest::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:LspRequest.payload)
+  return _s;
+}
+inline const std::string& LspRequest::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void LspRequest::_internal_set_payload(const std::string& value) {
+  
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LspRequest::_internal_mutable_payload() {
+  
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LspRequest::release_payload() {
+  // @@protoc_insertion_point(field_release:LspRequest.payload)
+  return _impl_.payload_.Release();
+}
+inline void LspRequest::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:LspRequest.payload)
+}
+
+// string language = 2;
+inline void LspRequest::clear_language() {
+  _impl_.language_.ClearToEmpty();
+}
+inline const std::string& LspRequest::language() const {
+  // @@protoc_insertion_point(field_get:LspRequest.language)
+  return _internal_language();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LspRequest::set_language(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.language_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:LspRequest.language)
+}
+inline std::string* LspRequest::mutable_language() {
+  std::string* _s = _internal_mutable_language();
+  // @@protoc_insertion_point(field_mutable:LspRequest.language)
+  return _s;
+}
+inline const std::string& LspRequest::_internal_language() const {
+  return _impl_.language_.Get();
+}
+inline void LspRequest::_internal_set_language(const std::string& value) {
+  
+  _impl_.language_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LspRequest::_internal_mutable_language() {
+  
+  return _impl_.language_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LspRequest::release_language() {
+  // @@protoc_insertion_point(field_release:LspRequest.language)
+  return _impl_.language_.Release();
+}
+inline void LspRequest::set_allocated_language(std::string* language) {
+  if (language != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.language_.SetAllocated(language, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_.IsDefault()) {
+    _impl_.language_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:LspRequest.language)
+}
+
+// -------------------------------------------------------------------
+
+// LspResponse
+
+// string payload = 1;
+inline void LspResponse::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+}
+inline const std::string& LspResponse::payload() const {
+  // @@protoc_insertion_point(field_get:LspResponse.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LspResponse::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:LspResponse.payload)
+}
+inline std::string* LspResponse::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:LspResponse.payload)
+  return _s;
+}
+inline const std::string& LspResponse::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void LspResponse::_internal_set_payload(const std::string& value) {
+  
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LspResponse::_internal_mutable_payload() {
+  
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LspResponse::release_payload() {
+  // @@protoc_insertion_point(field_release:LspResponse.payload)
+  return _impl_.payload_.Release();
+}
+inline void LspResponse::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:LspResponse.payload)
+}
+
+// string language = 2;
+inline void LspResponse::clear_language() {
+  _impl_.language_.ClearToEmpty();
+}
+inline const std::string& LspResponse::language() const {
+  // @@protoc_insertion_point(field_get:LspResponse.language)
+  return _internal_language();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LspResponse::set_language(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.language_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:LspResponse.language)
+}
+inline std::string* LspResponse::mutable_language() {
+  std::string* _s = _internal_mutable_language();
+  // @@protoc_insertion_point(field_mutable:LspResponse.language)
+  return _s;
+}
+inline const std::string& LspResponse::_internal_language() const {
+  return _impl_.language_.Get();
+}
+inline void LspResponse::_internal_set_language(const std::string& value) {
+  
+  _impl_.language_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LspResponse::_internal_mutable_language() {
+  
+  return _impl_.language_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LspResponse::release_language() {
+  // @@protoc_insertion_point(field_release:LspResponse.language)
+  return _impl_.language_.Release();
+}
+inline void LspResponse::set_allocated_language(std::string* language) {
+  if (language != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.language_.SetAllocated(language, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_.IsDefault()) {
+    _impl_.language_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:LspResponse.language)
+}
+
+// -------------------------------------------------------------------
+
+// CopyFileRangeRequest
+
+// int32 fd_in = 1;
+inline void CopyFileRangeRequest::clear_fd_in() {
+  _impl_.fd_in_ = 0;
+}
+inline int32_t CopyFileRangeRequest::_internal_fd_in() const {
+  return _impl_.fd_in_;
+}
+inline int32_t CopyFileRangeRequest::fd_in() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeRequest.fd_in)
+  return _internal_fd_in();
+}
+inline void CopyFileRangeRequest::_internal_set_fd_in(int32_t value) {
+  
+  _impl_.fd_in_ = value;
+}
+inline void CopyFileRangeRequest::set_fd_in(int32_t value) {
+  _internal_set_fd_in(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeRequest.fd_in)
+}
+
+// int64 offset_in = 2;
+inline void CopyFileRangeRequest::clear_offset_in() {
+  _impl_.offset_in_ = int64_t{0};
+}
+inline int64_t CopyFileRangeRequest::_internal_offset_in() const {
+  return _impl_.offset_in_;
+}
+inline int64_t CopyFileRangeRequest::offset_in() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeRequest.offset_in)
+  return _internal_offset_in();
+}
+inline void CopyFileRangeRequest::_internal_set_offset_in(int64_t value) {
+  
+  _impl_.offset_in_ = value;
+}
+inline void CopyFileRangeRequest::set_offset_in(int64_t value) {
+  _internal_set_offset_in(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeRequest.offset_in)
+}
+
+// int32 fd_out = 3;
+inline void CopyFileRangeRequest::clear_fd_out() {
+  _impl_.fd_out_ = 0;
+}
+inline int32_t CopyFileRangeRequest::_internal_fd_out() const {
+  return _impl_.fd_out_;
+}
+inline int32_t CopyFileRangeRequest::fd_out() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeRequest.fd_out)
+  return _internal_fd_out();
+}
+inline void CopyFileRangeRequest::_internal_set_fd_out(int32_t value) {
+  
+  _impl_.fd_out_ = value;
+}
+inline void CopyFileRangeRequest::set_fd_out(int32_t value) {
+  _internal_set_fd_out(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeRequest.fd_out)
+}
+
+// int64 offset_out = 4;
+inline void CopyFileRangeRequest::clear_offset_out() {
+  _impl_.offset_out_ = int64_t{0};
+}
+inline int64_t CopyFileRangeRequest::_internal_offset_out() const {
+  return _impl_.offset_out_;
+}
+inline int64_t CopyFileRangeRequest::offset_out() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeRequest.offset_out)
+  return _internal_offset_out();
+}
+inline void CopyFileRangeRequest::_internal_set_offset_out(int64_t value) {
+  
+  _impl_.offset_out_ = value;
+}
+inline void CopyFileRangeRequest::set_offset_out(int64_t value) {
+  _internal_set_offset_out(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeRequest.offset_out)
+}
+
+// int64 size = 5;
+inline void CopyFileRangeRequest::clear_size() {
+  _impl_.size_ = int64_t{0};
+}
+inline int64_t CopyFileRangeRequest::_internal_size() const {
+  return _impl_.size_;
+}
+inline int64_t CopyFileRangeRequest::size() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeRequest.size)
+  return _internal_size();
+}
+inline void CopyFileRangeRequest::_internal_set_size(int64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void CopyFileRangeRequest::set_size(int64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeRequest.size)
+}
+
+// int32 flags = 6;
+inline void CopyFileRangeRequest::clear_flags() {
+  _impl_.flags_ = 0;
+}
+inline int32_t CopyFileRangeRequest::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t CopyFileRangeRequest::flags() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeRequest.flags)
+  return _internal_flags();
+}
+inline void CopyFileRangeRequest::_internal_set_flags(int32_t value) {
+  
+  _impl_.flags_ = value;
+}
+inline void CopyFileRangeRequest::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeRequest.flags)
+}
+
+// -------------------------------------------------------------------
+
+// CopyFileRangeResponse
+
+// int32 error = 1;
+inline void CopyFileRangeResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t CopyFileRangeResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t CopyFileRangeResponse::error() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeResponse.error)
+  return _internal_error();
+}
+inline void CopyFileRangeResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void CopyFileRangeResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeResponse.error)
+}
+
+// int64 size = 2;
+inline void CopyFileRangeResponse::clear_size() {
+  _impl_.size_ = int64_t{0};
+}
+inline int64_t CopyFileRangeResponse::_internal_size() const {
+  return _impl_.size_;
+}
+inline int64_t CopyFileRangeResponse::size() const {
+  // @@protoc_insertion_point(field_get:CopyFileRangeResponse.size)
+  return _internal_size();
+}
+inline void CopyFileRangeResponse::_internal_set_size(int64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void CopyFileRangeResponse::set_size(int64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:CopyFileRangeResponse.size)
+}
+
+// -------------------------------------------------------------------
+
+// SearchRequest
+
+// string pattern = 1;
+inline void SearchRequest::clear_pattern() {
+  _impl_.pattern_.ClearToEmpty();
+}
+inline const std::string& SearchRequest::pattern() const {
+  // @@protoc_insertion_point(field_get:SearchRequest.pattern)
+  return _internal_pattern();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchRequest::set_pattern(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pattern_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SearchRequest.pattern)
+}
+inline std::string* SearchRequest::mutable_pattern() {
+  std::string* _s = _internal_mutable_pattern();
+  // @@protoc_insertion_point(field_mutable:SearchRequest.pattern)
+  return _s;
+}
+inline const std::string& SearchRequest::_internal_pattern() const {
+  return _impl_.pattern_.Get();
+}
+inline void SearchRequest::_internal_set_pattern(const std::string& value) {
+  
+  _impl_.pattern_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchRequest::_internal_mutable_pattern() {
+  
+  return _impl_.pattern_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchRequest::release_pattern() {
+  // @@protoc_insertion_point(field_release:SearchRequest.pattern)
+  return _impl_.pattern_.Release();
+}
+inline void SearchRequest::set_allocated_pattern(std::string* pattern) {
+  if (pattern != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pattern_.SetAllocated(pattern, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pattern_.IsDefault()) {
+    _impl_.pattern_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SearchRequest.pattern)
+}
+
+// string path = 2;
+inline void SearchRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& SearchRequest::path() const {
+  // @@protoc_insertion_point(field_get:SearchRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SearchRequest.path)
+}
+inline std::string* SearchRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:SearchRequest.path)
+  return _s;
+}
+inline const std::string& SearchRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void SearchRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchRequest::release_path() {
+  // @@protoc_insertion_point(field_release:SearchRequest.path)
+  return _impl_.path_.Release();
+}
+inline void SearchRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SearchRequest.path)
+}
+
+// repeated string globs = 3;
+inline int SearchRequest::_internal_globs_size() const {
+  return _impl_.globs_.size();
+}
+inline int SearchRequest::globs_size() const {
+  return _internal_globs_size();
+}
+inline void SearchRequest::clear_globs() {
+  _impl_.globs_.Clear();
+}
+inline std::string* SearchRequest::add_globs() {
+  std::string* _s = _internal_add_globs();
+  // @@protoc_insertion_point(field_add_mutable:SearchRequest.globs)
+  return _s;
+}
+inline const std::string& SearchRequest::_internal_globs(int index) const {
+  return _impl_.globs_.Get(index);
+}
+inline const std::string& SearchRequest::globs(int index) const {
+  // @@protoc_insertion_point(field_get:SearchRequest.globs)
+  return _internal_globs(index);
+}
+inline std::string* SearchRequest::mutable_globs(int index) {
+  // @@protoc_insertion_point(field_mutable:SearchRequest.globs)
+  return _impl_.globs_.Mutable(index);
+}
+inline void SearchRequest::set_globs(int index, const std::string& value) {
+  _impl_.globs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SearchRequest.globs)
+}
+inline void SearchRequest::set_globs(int index, std::string&& value) {
+  _impl_.globs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SearchRequest.globs)
+}
+inline void SearchRequest::set_globs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.globs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SearchRequest.globs)
+}
+inline void SearchRequest::set_globs(int index, const char* value, size_t size) {
+  _impl_.globs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SearchRequest.globs)
+}
+inline std::string* SearchRequest::_internal_add_globs() {
+  return _impl_.globs_.Add();
+}
+inline void SearchRequest::add_globs(const std::string& value) {
+  _impl_.globs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SearchRequest.globs)
+}
+inline void SearchRequest::add_globs(std::string&& value) {
+  _impl_.globs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SearchRequest.globs)
+}
+inline void SearchRequest::add_globs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.globs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SearchRequest.globs)
+}
+inline void SearchRequest::add_globs(const char* value, size_t size) {
+  _impl_.globs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SearchRequest.globs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SearchRequest::globs() const {
+  // @@protoc_insertion_point(field_list:SearchRequest.globs)
+  return _impl_.globs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SearchRequest::mutable_globs() {
+  // @@protoc_insertion_point(field_mutable_list:SearchRequest.globs)
+  return &_impl_.globs_;
+}
+
+// bool regex = 4;
+inline void SearchRequest::clear_regex() {
+  _impl_.regex_ = false;
+}
+inline bool SearchRequest::_internal_regex() const {
+  return _impl_.regex_;
+}
+inline bool SearchRequest::regex() const {
+  // @@protoc_insertion_point(field_get:SearchRequest.regex)
+  return _internal_regex();
+}
+inline void SearchRequest::_internal_set_regex(bool value) {
+  
+  _impl_.regex_ = value;
+}
+inline void SearchRequest::set_regex(bool value) {
+  _internal_set_regex(value);
+  // @@protoc_insertion_point(field_set:SearchRequest.regex)
+}
+
+// bool ignore_case = 5;
+inline void SearchRequest::clear_ignore_case() {
+  _impl_.ignore_case_ = false;
+}
+inline bool SearchRequest::_internal_ignore_case() const {
+  return _impl_.ignore_case_;
+}
+inline bool SearchRequest::ignore_case() const {
+  // @@protoc_insertion_point(field_get:SearchRequest.ignore_case)
+  return _internal_ignore_case();
+}
+inline void SearchRequest::_internal_set_ignore_case(bool value) {
+  
+  _impl_.ignore_case_ = value;
+}
+inline void SearchRequest::set_ignore_case(bool value) {
+  _internal_set_ignore_case(value);
+  // @@protoc_insertion_point(field_set:SearchRequest.ignore_case)
+}
+
+// bool hidden = 6;
+inline void SearchRequest::clear_hidden() {
+  _impl_.hidden_ = false;
+}
+inline bool SearchRequest::_internal_hidden() const {
+  return _impl_.hidden_;
+}
+inline bool SearchRequest::hidden() const {
+  // @@protoc_insertion_point(field_get:SearchRequest.hidden)
+  return _internal_hidden();
+}
+inline void SearchRequest::_internal_set_hidden(bool value) {
+  
+  _impl_.hidden_ = value;
+}
+inline void SearchRequest::set_hidden(bool value) {
+  _internal_set_hidden(value);
+  // @@protoc_insertion_point(field_set:SearchRequest.hidden)
+}
+
+// int32 max_results = 7;
+inline void SearchRequest::clear_max_results() {
+  _impl_.max_results_ = 0;
+}
+inline int32_t SearchRequest::_internal_max_results() const {
+  return _impl_.max_results_;
+}
+inline int32_t SearchRequest::max_results() const {
+  // @@protoc_insertion_point(field_get:SearchRequest.max_results)
+  return _internal_max_results();
+}
+inline void SearchRequest::_internal_set_max_results(int32_t value) {
+  
+  _impl_.max_results_ = value;
+}
+inline void SearchRequest::set_max_results(int32_t value) {
+  _internal_set_max_results(value);
+  // @@protoc_insertion_point(field_set:SearchRequest.max_results)
+}
+
+// -------------------------------------------------------------------
+
+// SearchMatch
+
+// string path = 1;
+inline void SearchMatch::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& SearchMatch::path() const {
+  // @@protoc_insertion_point(field_get:SearchMatch.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchMatch::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SearchMatch.path)
+}
+inline std::string* SearchMatch::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:SearchMatch.path)
+  return _s;
+}
+inline const std::string& SearchMatch::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void SearchMatch::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchMatch::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchMatch::release_path() {
+  // @@protoc_insertion_point(field_release:SearchMatch.path)
+  return _impl_.path_.Release();
+}
+inline void SearchMatch::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SearchMatch.path)
+}
+
+// int32 line = 2;
+inline void SearchMatch::clear_line() {
+  _impl_.line_ = 0;
+}
+inline int32_t SearchMatch::_internal_line() const {
+  return _impl_.line_;
+}
+inline int32_t SearchMatch::line() const {
+  // @@protoc_insertion_point(field_get:SearchMatch.line)
+  return _internal_line();
+}
+inline void SearchMatch::_internal_set_line(int32_t value) {
+  
+  _impl_.line_ = value;
+}
+inline void SearchMatch::set_line(int32_t value) {
+  _internal_set_line(value);
+  // @@protoc_insertion_point(field_set:SearchMatch.line)
+}
+
+// int32 column = 3;
+inline void SearchMatch::clear_column() {
+  _impl_.column_ = 0;
+}
+inline int32_t SearchMatch::_internal_column() const {
+  return _impl_.column_;
+}
+inline int32_t SearchMatch::column() const {
+  // @@protoc_insertion_point(field_get:SearchMatch.column)
+  return _internal_column();
+}
+inline void SearchMatch::_internal_set_column(int32_t value) {
+  
+  _impl_.column_ = value;
+}
+inline void SearchMatch::set_column(int32_t value) {
+  _internal_set_column(value);
+  // @@protoc_insertion_point(field_set:SearchMatch.column)
+}
+
+// string text = 4;
+inline void SearchMatch::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& SearchMatch::text() const {
+  // @@protoc_insertion_point(field_get:SearchMatch.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchMatch::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SearchMatch.text)
+}
+inline std::string* SearchMatch::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:SearchMatch.text)
+  return _s;
+}
+inline const std::string& SearchMatch::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void SearchMatch::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchMatch::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchMatch::release_text() {
+  // @@protoc_insertion_point(field_release:SearchMatch.text)
+  return _impl_.text_.Release();
+}
+inline void SearchMatch::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SearchMatch.text)
+}
+
+// -------------------------------------------------------------------
+
+// SearchResponse
+
+// int32 error = 1;
+inline void SearchResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t SearchResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t SearchResponse::error() const {
+  // @@protoc_insertion_point(field_get:SearchResponse.error)
+  return _internal_error();
+}
+inline void SearchResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void SearchResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:SearchResponse.error)
+}
+
+// repeated .SearchMatch matches = 2;
+inline int SearchResponse::_internal_matches_size() const {
+  return _impl_.matches_.size();
+}
+inline int SearchResponse::matches_size() const {
+  return _internal_matches_size();
+}
+inline void SearchResponse::clear_matches() {
+  _impl_.matches_.Clear();
+}
+inline ::SearchMatch* SearchResponse::mutable_matches(int index) {
+  // @@protoc_insertion_point(field_mutable:SearchResponse.matches)
+  return _impl_.matches_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SearchMatch >*
+SearchResponse::mutable_matches() {
+  // @@protoc_insertion_point(field_mutable_list:SearchResponse.matches)
+  return &_impl_.matches_;
+}
+inline const ::SearchMatch& SearchResponse::_internal_matches(int index) const {
+  return _impl_.matches_.Get(index);
+}
+inline const ::SearchMatch& SearchResponse::matches(int index) const {
+  // @@protoc_insertion_point(field_get:SearchResponse.matches)
+  return _internal_matches(index);
+}
+inline ::SearchMatch* SearchResponse::_internal_add_matches() {
+  return _impl_.matches_.Add();
+}
+inline ::SearchMatch* SearchResponse::add_matches() {
+  ::SearchMatch* _add = _internal_add_matches();
+  // @@protoc_insertion_point(field_add:SearchResponse.matches)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SearchMatch >&
+SearchResponse::matches() const {
+  // @@protoc_insertion_point(field_list:SearchResponse.matches)
+  return _impl_.matches_;
+}
+
+// bool done = 3;
+inline void SearchResponse::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool SearchResponse::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool SearchResponse::done() const {
+  // @@protoc_insertion_point(field_get:SearchResponse.done)
+  return _internal_done();
+}
+inline void SearchResponse::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void SearchResponse::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:SearchResponse.done)
+}
+
+// -------------------------------------------------------------------
+
+// SearchCancelRequest
+
+// int32 search_id = 1;
+inline void SearchCancelRequest::clear_search_id() {
+  _impl_.search_id_ = 0;
+}
+inline int32_t SearchCancelRequest::_internal_search_id() const {
+  return _impl_.search_id_;
+}
+inline int32_t SearchCancelRequest::search_id() const {
+  // @@protoc_insertion_point(field_get:SearchCancelRequest.search_id)
+  return _internal_search_id();
+}
+inline void SearchCancelRequest::_internal_set_search_id(int32_t value) {
+  
+  _impl_.search_id_ = value;
+}
+inline void SearchCancelRequest::set_search_id(int32_t value) {
+  _internal_set_search_id(value);
+  // @@protoc_insertion_point(field_set:SearchCancelRequest.search_id)
+}
+
+// -------------------------------------------------------------------
+
+// SearchCancelResponse
+
+// int32 error = 1;
+inline void SearchCancelResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t SearchCancelResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t SearchCancelResponse::error() const {
+  // @@protoc_insertion_point(field_get:SearchCancelResponse.error)
+  return _internal_error();
+}
+inline void SearchCancelResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void SearchCancelResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:SearchCancelResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// BatchStatRequest
+
+// repeated string paths = 1;
+inline int BatchStatRequest::_internal_paths_size() const {
+  return _impl_.paths_.size();
+}
+inline int BatchStatRequest::paths_size() const {
+  return _internal_paths_size();
+}
+inline void BatchStatRequest::clear_paths() {
+  _impl_.paths_.Clear();
+}
+inline std::string* BatchStatRequest::add_paths() {
+  std::string* _s = _internal_add_paths();
+  // @@protoc_insertion_point(field_add_mutable:BatchStatRequest.paths)
+  return _s;
+}
+inline const std::string& BatchStatRequest::_internal_paths(int index) const {
+  return _impl_.paths_.Get(index);
+}
+inline const std::string& BatchStatRequest::paths(int index) const {
+  // @@protoc_insertion_point(field_get:BatchStatRequest.paths)
+  return _internal_paths(index);
+}
+inline std::string* BatchStatRequest::mutable_paths(int index) {
+  // @@protoc_insertion_point(field_mutable:BatchStatRequest.paths)
+  return _impl_.paths_.Mutable(index);
+}
+inline void BatchStatRequest::set_paths(int index, const std::string& value) {
+  _impl_.paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:BatchStatRequest.paths)
+}
+inline void BatchStatRequest::set_paths(int index, std::string&& value) {
+  _impl_.paths_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:BatchStatRequest.paths)
+}
+inline void BatchStatRequest::set_paths(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:BatchStatRequest.paths)
+}
+inline void BatchStatRequest::set_paths(int index, const char* value, size_t size) {
+  _impl_.paths_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:BatchStatRequest.paths)
+}
+inline std::string* BatchStatRequest::_internal_add_paths() {
+  return _impl_.paths_.Add();
+}
+inline void BatchStatRequest::add_paths(const std::string& value) {
+  _impl_.paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:BatchStatRequest.paths)
+}
+inline void BatchStatRequest::add_paths(std::string&& value) {
+  _impl_.paths_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:BatchStatRequest.paths)
+}
+inline void BatchStatRequest::add_paths(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:BatchStatRequest.paths)
+}
+inline void BatchStatRequest::add_paths(const char* value, size_t size) {
+  _impl_.paths_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:BatchStatRequest.paths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchStatRequest::paths() const {
+  // @@protoc_insertion_point(field_list:BatchStatRequest.paths)
+  return _impl_.paths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchStatRequest::mutable_paths() {
+  // @@protoc_insertion_point(field_mutable_list:BatchStatRequest.paths)
+  return &_impl_.paths_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchStatResponse
+
+// int32 error = 1;
+inline void BatchStatResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t BatchStatResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t BatchStatResponse::error() const {
+  // @@protoc_insertion_point(field_get:BatchStatResponse.error)
+  return _internal_error();
+}
+inline void BatchStatResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void BatchStatResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:BatchStatResponse.error)
+}
+
+// repeated .GetAttrResponse results = 2;
+inline int BatchStatResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int BatchStatResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void BatchStatResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::GetAttrResponse* BatchStatResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:BatchStatResponse.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GetAttrResponse >*
+BatchStatResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:BatchStatResponse.results)
+  return &_impl_.results_;
+}
+inline const ::GetAttrResponse& BatchStatResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::GetAttrResponse& BatchStatResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:BatchStatResponse.results)
+  return _internal_results(index);
+}
+inline ::GetAttrResponse* BatchStatResponse::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::GetAttrResponse* BatchStatResponse::add_results() {
+  ::GetAttrResponse* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:BatchStatResponse.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GetAttrResponse >&
+BatchStatResponse::results() const {
+  // @@protoc_insertion_point(field_list:BatchStatResponse.results)
+  return _impl_.results_;
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TeaConfigFile
+
+// map<string, string> language_configs = 1;
+inline int TeaConfigFile::_internal_language_configs_size() const {
+  return _impl_.language_configs_.size();
+}
+inline int TeaConfigFile::language_configs_size() const {
+  return _internal_language_configs_size();
+}
+inline void TeaConfigFile::clear_language_configs() {
+  _impl_.language_configs_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TeaConfigFile::_internal_language_configs() const {
+  return _impl_.language_configs_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TeaConfigFile::language_configs() const {
+  // @@protoc_insertion_point(field_map:TeaConfigFile.language_configs)
+  return _internal_language_configs();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TeaConfigFile::_internal_mutable_language_configs() {
+  return _impl_.language_configs_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TeaConfigFile::mutable_language_configs() {
+  // @@protoc_insertion_point(field_mutable_map:TeaConfigFile.language_configs)
+  return _internal_mutable_language_configs();
+}
+
+// repeated string prespawn = 2;
+inline int TeaConfigFile::_internal_prespawn_size() const {
+  return _impl_.prespawn_.size();
+}
+inline int TeaConfigFile::prespawn_size() const {
+  return _internal_prespawn_size();
+}
+inline void TeaConfigFile::clear_prespawn() {
+  _impl_.prespawn_.Clear();
+}
+inline std::string* TeaConfigFile::add_prespawn() {
+  std::string* _s = _internal_add_prespawn();
+  // @@protoc_insertion_point(field_add_mutable:TeaConfigFile.prespawn)
+  return _s;
+}
+inline const std::string& TeaConfigFile::_internal_prespawn(int index) const {
+  return _impl_.prespawn_.Get(index);
+}
+inline const std::string& TeaConfigFile::prespawn(int index) const {
+  // @@protoc_insertion_point(field_get:TeaConfigFile.prespawn)
+  return _internal_prespawn(index);
+}
+inline std::string* TeaConfigFile::mutable_prespawn(int index) {
+  // @@protoc_insertion_point(field_mutable:TeaConfigFile.prespawn)
+  return _impl_.prespawn_.Mutable(index);
+}
+inline void TeaConfigFile::set_prespawn(int index, const std::string& value) {
+  _impl_.prespawn_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:TeaConfigFile.prespawn)
+}
+inline void TeaConfigFile::set_prespawn(int index, std::string&& value) {
+  _impl_.prespawn_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:TeaConfigFile.prespawn)
+}
+inline void TeaConfigFile::set_prespawn(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.prespawn_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:TeaConfigFile.prespawn)
+}
+inline void TeaConfigFile::set_prespawn(int index, const char* value, size_t size) {
+  _impl_.prespawn_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:TeaConfigFile.prespawn)
+}
+inline std::string* TeaConfigFile::_internal_add_prespawn() {
+  return _impl_.prespawn_.Add();
+}
+inline void TeaConfigFile::add_prespawn(const std::string& value) {
+  _impl_.prespawn_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:TeaConfigFile.prespawn)
+}
+inline void TeaConfigFile::add_prespawn(std::string&& value) {
+  _impl_.prespawn_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:TeaConfigFile.prespawn)
+}
+inline void TeaConfigFile::add_prespawn(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.prespawn_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:TeaConfigFile.prespawn)
+}
+inline void TeaConfigFile::add_prespawn(const char* value, size_t size) {
+  _impl_.prespawn_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:TeaConfigFile.prespawn)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TeaConfigFile::prespawn() const {
+  // @@protoc_insertion_point(field_list:TeaConfigFile.prespawn)
+  return _impl_.prespawn_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TeaConfigFile::mutable_prespawn() {
+  // @@protoc_insertion_point(field_mutable_list:TeaConfigFile.prespawn)
+  return &_impl_.prespawn_;
+}
+
+// int32 idle_timeout = 3;
+inline void TeaConfigFile::clear_idle_timeout() {
+  _impl_.idle_timeout_ = 0;
+}
+inline int32_t TeaConfigFile::_internal_idle_timeout() const {
+  return _impl_.idle_timeout_;
+}
+inline int32_t TeaConfigFile::idle_timeout() const {
+  // @@protoc_insertion_point(field_get:TeaConfigFile.idle_timeout)
+  return _internal_idle_timeout();
+}
+inline void TeaConfigFile::_internal_set_idle_timeout(int32_t value) {
+  
+  _impl_.idle_timeout_ = value;
+}
+inline void TeaConfigFile::set_idle_timeout(int32_t value) {
+  _internal_set_idle_timeout(value);
+  // @@protoc_insertion_point(field_set:TeaConfigFile.idle_timeout)
+}
+
+// int32 memory_limit = 4;
+inline void TeaConfigFile::clear_memory_limit() {
+  _impl_.memory_limit_ = 0;
+}
+inline int32_t TeaConfigFile::_internal_memory_limit() const {
+  return _impl_.memory_limit_;
+}
+inline int32_t TeaConfigFile::memory_limit() const {
+  // @@protoc_insertion_point(field_get:TeaConfigFile.memory_limit)
+  return _internal_memory_limit();
+}
+inline void TeaConfigFile::_internal_set_memory_limit(int32_t value) {
+  
+  _impl_.memory_limit_ = value;
+}
+inline void TeaConfigFile::set_memory_limit(int32_t value) {
+  _internal_set_memory_limit(value);
+  // @@protoc_insertion_point(field_set:TeaConfigFile.memory_limit)
+}
+
+// -------------------------------------------------------------------
+
+// SaveRequest
+
+// string path = 1;
+inline void SaveRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& SaveRequest::path() const {
+  // @@protoc_insertion_point(field_get:SaveRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SaveRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SaveRequest.path)
+}
+inline std::string* SaveRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:SaveRequest.path)
+  return _s;
+}
+inline const std::string& SaveRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void SaveRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SaveRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SaveRequest::release_path() {
+  // @@protoc_insertion_point(field_release:SaveRequest.path)
+  return _impl_.path_.Release();
+}
+inline void SaveRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SaveRequest.path)
+}
+
+// bytes data = 2;
+inline void SaveRequest::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& SaveRequest::data() const {
+  // @@protoc_insertion_point(field_get:SaveRequest.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SaveRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SaveRequest.data)
+}
+inline std::string* SaveRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:SaveRequest.data)
+  return _s;
+}
+inline const std::string& SaveRequest::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void SaveRequest::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SaveRequest::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SaveRequest::release_data() {
+  // @@protoc_insertion_point(field_release:SaveRequest.data)
+  return _impl_.data_.Release();
+}
+inline void SaveRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SaveRequest.data)
+}
+
+// int32 mode = 3;
+inline void SaveRequest::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline int32_t SaveRequest::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline int32_t SaveRequest::mode() const {
+  // @@protoc_insertion_point(field_get:SaveRequest.mode)
+  return _internal_mode();
+}
+inline void SaveRequest::_internal_set_mode(int32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void SaveRequest::set_mode(int32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:SaveRequest.mode)
+}
+
+// bool sync = 4;
+inline void SaveRequest::clear_sync() {
+  _impl_.sync_ = false;
+}
+inline bool SaveRequest::_internal_sync() const {
+  return _impl_.sync_;
+}
+inline bool SaveRequest::sync() const {
+  // @@protoc_insertion_point(field_get:SaveRequest.sync)
+  return _internal_sync();
+}
+inline void SaveRequest::_internal_set_sync(bool value) {
+  
+  _impl_.sync_ = value;
+}
+inline void SaveRequest::set_sync(bool value) {
+  _internal_set_sync(value);
+  // @@protoc_insertion_point(field_set:SaveRequest.sync)
+}
+
+// string from = 5;
+inline void SaveRequest::clear_from() {
+  _impl_.from_.ClearToEmpty();
+}
+inline const std::string& SaveRequest::from() const {
+  // @@protoc_insertion_point(field_get:SaveRequest.from)
+  return _internal_from();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SaveRequest::set_from(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.from_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SaveRequest.from)
+}
+inline std::string* SaveRequest::mutable_from() {
+  std::string* _s = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:SaveRequest.from)
+  return _s;
+}
+inline const std::string& SaveRequest::_internal_from() const {
+  return _impl_.from_.Get();
+}
+inline void SaveRequest::_internal_set_from(const std::string& value) {
+  
+  _impl_.from_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SaveRequest::_internal_mutable_from() {
+  
+  return _impl_.from_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SaveRequest::release_from() {
+  // @@protoc_insertion_point(field_release:SaveRequest.from)
+  return _impl_.from_.Release();
+}
+inline void SaveRequest::set_allocated_from(std::string* from) {
+  if (from != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.from_.SetAllocated(from, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_.IsDefault()) {
+    _impl_.from_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SaveRequest.from)
+}
+
+// -------------------------------------------------------------------
+
+// SaveResponse
+
+// int32 error = 1;
+inline void SaveResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t SaveResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t SaveResponse::error() const {
+  // @@protoc_insertion_point(field_get:SaveResponse.error)
+  return _internal_error();
+}
+inline void SaveResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void SaveResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:SaveResponse.error)
+}
+
+// .GetAttrResponse attr = 2;
+inline bool SaveResponse::_internal_has_attr() const {
+  return this != internal_default_instance() && _impl_.attr_ != nullptr;
+}
+inline bool SaveResponse::has_attr() const {
+  return _internal_has_attr();
+}
+inline void SaveResponse::clear_attr() {
+  if (GetArenaForAllocation() == nullptr && _impl_.attr_ != nullptr) {
+    delete _impl_.attr_;
+  }
+  _impl_.attr_ = nullptr;
+}
+inline const ::GetAttrResponse& SaveResponse::_internal_attr() const {
+  const ::GetAttrResponse* p = _impl_.attr_;
+  return p != nullptr ? *p : reinterpret_cast<const ::GetAttrResponse&>(
+      ::_GetAttrResponse_default_instance_);
+}
+inline const ::GetAttrResponse& SaveResponse::attr() const {
+  // @@protoc_insertion_point(field_get:SaveResponse.attr)
+  return _internal_attr();
+}
+inline void SaveResponse::unsafe_arena_set_allocated_attr(
+    ::GetAttrResponse* attr) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.attr_);
+  }
+  _impl_.attr_ = attr;
+  if (attr) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SaveResponse.attr)
+}
+inline ::GetAttrResponse* SaveResponse::release_attr() {
+  
+  ::GetAttrResponse* temp = _impl_.attr_;
+  _impl_.attr_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::GetAttrResponse* SaveResponse::unsafe_arena_release_attr() {
+  // @@protoc_insertion_point(field_release:SaveResponse.attr)
+  
+  ::GetAttrResponse* temp = _impl_.attr_;
+  _impl_.attr_ = nullptr;
+  return temp;
+}
+inline ::GetAttrResponse* SaveResponse::_internal_mutable_attr() {
+  
+  if (_impl_.attr_ == nullptr) {
+    auto* p = CreateMaybeMessage<::GetAttrResponse>(GetArenaForAllocation());
+    _impl_.attr_ = p;
+  }
+  return _impl_.attr_;
+}
+inline ::GetAttrResponse* SaveResponse::mutable_attr() {
+  ::GetAttrResponse* _msg = _internal_mutable_attr();
+  // @@protoc_insertion_point(field_mutable:SaveResponse.attr)
+  return _msg;
+}
+inline void SaveResponse::set_allocated_attr(::GetAttrResponse* attr) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.attr_;
+  }
+  if (attr) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(attr);
+    if (message_arena != submessage_arena) {
+      attr = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attr, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.attr_ = attr;
+  // @@protoc_insertion_point(field_set_allocated:SaveResponse.attr)
+}
+
+// -------------------------------------------------------------------
+
+// ExecRequest
+
+// repeated string argv = 1;
+inline int ExecRequest::_internal_argv_size() const {
+  return _impl_.argv_.size();
+}
+inline int ExecRequest::argv_size() const {
+  return _internal_argv_size();
+}
+inline void ExecRequest::clear_argv() {
+  _impl_.argv_.Clear();
+}
+inline std::string* ExecRequest::add_argv() {
+  std::string* _s = _internal_add_argv();
+  // @@protoc_insertion_point(field_add_mutable:ExecRequest.argv)
+  return _s;
+}
+inline const std::string& ExecRequest::_internal_argv(int index) const {
+  return _impl_.argv_.Get(index);
+}
+inline const std::string& ExecRequest::argv(int index) const {
+  // @@protoc_insertion_point(field_get:ExecRequest.argv)
+  return _internal_argv(index);
+}
+inline std::string* ExecRequest::mutable_argv(int index) {
+  // @@protoc_insertion_point(field_mutable:ExecRequest.argv)
+  return _impl_.argv_.Mutable(index);
+}
+inline void ExecRequest::set_argv(int index, const std::string& value) {
+  _impl_.argv_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ExecRequest.argv)
+}
+inline void ExecRequest::set_argv(int index, std::string&& value) {
+  _impl_.argv_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ExecRequest.argv)
+}
+inline void ExecRequest::set_argv(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.argv_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ExecRequest.argv)
+}
+inline void ExecRequest::set_argv(int index, const char* value, size_t size) {
+  _impl_.argv_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ExecRequest.argv)
+}
+inline std::string* ExecRequest::_internal_add_argv() {
+  return _impl_.argv_.Add();
+}
+inline void ExecRequest::add_argv(const std::string& value) {
+  _impl_.argv_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ExecRequest.argv)
+}
+inline void ExecRequest::add_argv(std::string&& value) {
+  _impl_.argv_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ExecRequest.argv)
+}
+inline void ExecRequest::add_argv(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.argv_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ExecRequest.argv)
+}
+inline void ExecRequest::add_argv(const char* value, size_t size) {
+  _impl_.argv_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ExecRequest.argv)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ExecRequest::argv() const {
+  // @@protoc_insertion_point(field_list:ExecRequest.argv)
+  return _impl_.argv_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ExecRequest::mutable_argv() {
+  // @@protoc_insertion_point(field_mutable_list:ExecRequest.argv)
+  return &_impl_.argv_;
+}
+
+// string path = 2;
+inline void ExecRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& ExecRequest::path() const {
+  // @@protoc_insertion_point(field_get:ExecRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExecRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ExecRequest.path)
+}
+inline std::string* ExecRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:ExecRequest.path)
+  return _s;
+}
+inline const std::string& ExecRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void ExecRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExecRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExecRequest::release_path() {
+  // @@protoc_insertion_point(field_release:ExecRequest.path)
+  return _impl_.path_.Release();
+}
+inline void ExecRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ExecRequest.path)
+}
+
+// repeated string env = 3;
+inline int ExecRequest::_internal_env_size() const {
+  return _impl_.env_.size();
+}
+inline int ExecRequest::env_size() const {
+  return _internal_env_size();
+}
+inline void ExecRequest::clear_env() {
+  _impl_.env_.Clear();
+}
+inline std::string* ExecRequest::add_env() {
+  std::string* _s = _internal_add_env();
+  // @@protoc_insertion_point(field_add_mutable:ExecRequest.env)
+  return _s;
+}
+inline const std::string& ExecRequest::_internal_env(int index) const {
+  return _impl_.env_.Get(index);
+}
+inline const std::string& ExecRequest::env(int index) const {
+  // @@protoc_insertion_point(field_get:ExecRequest.env)
+  return _internal_env(index);
+}
+inline std::string* ExecRequest::mutable_env(int index) {
+  // @@protoc_insertion_point(field_mutable:ExecRequest.env)
+  return _impl_.env_.Mutable(index);
+}
+inline void ExecRequest::set_env(int index, const std::string& value) {
+  _impl_.env_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ExecRequest.env)
+}
+inline void ExecRequest::set_env(int index, std::string&& value) {
+  _impl_.env_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ExecRequest.env)
+}
+inline void ExecRequest::set_env(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.env_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ExecRequest.env)
+}
+inline void ExecRequest::set_env(int index, const char* value, size_t size) {
+  _impl_.env_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ExecRequest.env)
+}
+inline std::string* ExecRequest::_internal_add_env() {
+  return _impl_.env_.Add();
+}
+inline void ExecRequest::add_env(const std::string& value) {
+  _impl_.env_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ExecRequest.env)
+}
+inline void ExecRequest::add_env(std::string&& value) {
+  _impl_.env_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ExecRequest.env)
+}
+inline void ExecRequest::add_env(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.env_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ExecRequest.env)
+}
+inline void ExecRequest::add_env(const char* value, size_t size) {
+  _impl_.env_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ExecRequest.env)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ExecRequest::env() const {
+  // @@protoc_insertion_point(field_list:ExecRequest.env)
+  return _impl_.env_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ExecRequest::mutable_env() {
+  // @@protoc_insertion_point(field_mutable_list:ExecRequest.env)
+  return &_impl_.env_;
+}
+
+// -------------------------------------------------------------------
+
+// ExecResponse
+
+// int32 error = 1;
+inline void ExecResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ExecResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ExecResponse::error() const {
+  // @@protoc_insertion_point(field_get:ExecResponse.error)
+  return _internal_error();
+}
+inline void ExecResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ExecResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ExecResponse.error)
+}
+
+// bytes output = 2;
+inline void ExecResponse::clear_output() {
+  _impl_.output_.ClearToEmpty();
+}
+inline const std::string& ExecResponse::output() const {
+  // @@protoc_insertion_point(field_get:ExecResponse.output)
+  return _internal_output();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExecResponse::set_output(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.output_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ExecResponse.output)
+}
+inline std::string* ExecResponse::mutable_output() {
+  std::string* _s = _internal_mutable_output();
+  // @@protoc_insertion_point(field_mutable:ExecResponse.output)
+  return _s;
+}
+inline const std::string& ExecResponse::_internal_output() const {
+  return _impl_.output_.Get();
+}
+inline void ExecResponse::_internal_set_output(const std::string& value) {
+  
+  _impl_.output_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExecResponse::_internal_mutable_output() {
+  
+  return _impl_.output_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExecResponse::release_output() {
+  // @@protoc_insertion_point(field_release:ExecResponse.output)
+  return _impl_.output_.Release();
+}
+inline void ExecResponse::set_allocated_output(std::string* output) {
+  if (output != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.output_.SetAllocated(output, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.output_.IsDefault()) {
+    _impl_.output_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ExecResponse.output)
+}
+
+// bytes error_output = 3;
+inline void ExecResponse::clear_error_output() {
+  _impl_.error_output_.ClearToEmpty();
+}
+inline const std::string& ExecResponse::error_output() const {
+  // @@protoc_insertion_point(field_get:ExecResponse.error_output)
+  return _internal_error_output();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExecResponse::set_error_output(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_output_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ExecResponse.error_output)
+}
+inline std::string* ExecResponse::mutable_error_output() {
+  std::string* _s = _internal_mutable_error_output();
+  // @@protoc_insertion_point(field_mutable:ExecResponse.error_output)
+  return _s;
+}
+inline const std::string& ExecResponse::_internal_error_output() const {
+  return _impl_.error_output_.Get();
+}
+inline void ExecResponse::_internal_set_error_output(const std::string& value) {
+  
+  _impl_.error_output_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExecResponse::_internal_mutable_error_output() {
+  
+  return _impl_.error_output_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExecResponse::release_error_output() {
+  // @@protoc_insertion_point(field_release:ExecResponse.error_output)
+  return _impl_.error_output_.Release();
+}
+inline void ExecResponse::set_allocated_error_output(std::string* error_output) {
+  if (error_output != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_output_.SetAllocated(error_output, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_output_.IsDefault()) {
+    _impl_.error_output_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ExecResponse.error_output)
+}
+
+// bool done = 4;
+inline void ExecResponse::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool ExecResponse::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool ExecResponse::done() const {
+  // @@protoc_insertion_point(field_get:ExecResponse.done)
+  return _internal_done();
+}
+inline void ExecResponse::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void ExecResponse::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:ExecResponse.done)
+}
+
+// int32 exit_code = 5;
+inline void ExecResponse::clear_exit_code() {
+  _impl_.exit_code_ = 0;
+}
+inline int32_t ExecResponse::_internal_exit_code() const {
+  return _impl_.exit_code_;
+}
+inline int32_t ExecResponse::exit_code() const {
+  // @@protoc_insertion_point(field_get:ExecResponse.exit_code)
+  return _internal_exit_code();
+}
+inline void ExecResponse::_internal_set_exit_code(int32_t value) {
+  
+  _impl_.exit_code_ = value;
+}
+inline void ExecResponse::set_exit_code(int32_t value) {
+  _internal_set_exit_code(value);
+  // @@protoc_insertion_point(field_set:ExecResponse.exit_code)
+}
+
+// int32 signal = 6;
+inline void ExecResponse::clear_signal() {
+  _impl_.signal_ = 0;
+}
+inline int32_t ExecResponse::_internal_signal() const {
+  return _impl_.signal_;
+}
+inline int32_t ExecResponse::signal() const {
+  // @@protoc_insertion_point(field_get:ExecResponse.signal)
+  return _internal_signal();
+}
+inline void ExecResponse::_internal_set_signal(int32_t value) {
+  
+  _impl_.signal_ = value;
+}
+inline void ExecResponse::set_signal(int32_t value) {
+  _internal_set_signal(value);
+  // @@protoc_insertion_point(field_set:ExecResponse.signal)
+}
+
+// -------------------------------------------------------------------
+
+// ExecCancelRequest
+
+// int32 exec_id = 1;
+inline void ExecCancelRequest::clear_exec_id() {
+  _impl_.exec_id_ = 0;
+}
+inline int32_t ExecCancelRequest::_internal_exec_id() const {
+  return _impl_.exec_id_;
+}
+inline int32_t ExecCancelRequest::exec_id() const {
+  // @@protoc_insertion_point(field_get:ExecCancelRequest.exec_id)
+  return _internal_exec_id();
+}
+inline void ExecCancelRequest::_internal_set_exec_id(int32_t value) {
+  
+  _impl_.exec_id_ = value;
+}
+inline void ExecCancelRequest::set_exec_id(int32_t value) {
+  _internal_set_exec_id(value);
+  // @@protoc_insertion_point(field_set:ExecCancelRequest.exec_id)
+}
+
+// -------------------------------------------------------------------
+
+// ExecCancelResponse
+
+// int32 error = 1;
+inline void ExecCancelResponse::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ExecCancelResponse::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ExecCancelResponse::error() const {
+  // @@protoc_insertion_point(field_get:ExecCancelResponse.error)
+  return _internal_error();
+}
+inline void ExecCancelResponse::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ExecCancelResponse::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:ExecCancelResponse.error)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Type>() {
+  return ::Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
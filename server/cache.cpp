@@ -0,0 +1,127 @@
+#include "cache.h"
+
+#include "../common/log.h"
+#include <climits>
+#include <fcntl.h>
+#include <string>
+#include <sys/file.h>
+#include <unistd.h>
+
+// flags which do not change how an already opened descriptor behaves
+static const int ignored_flags = O_LARGEFILE | O_CLOEXEC | O_NOCTTY | O_NOATIME;
+
+FileCache::FileCache(size_t limit) : capacity(limit) {}
+
+FileCache::~FileCache() {
+    for (auto &e : lru) {
+        close(e.fd);
+    }
+}
+
+bool FileCache::cacheable(int flags) { return (flags & ~ignored_flags) == O_RDONLY; }
+
+int FileCache::acquire(const struct stat &st, int flags) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const file_key key = {.dev = st.st_dev, .ino = st.st_ino, .flags = flags};
+    auto it = idle.find(key);
+    if (it == idle.end()) {
+        return -1;
+    }
+    auto e = it->second;
+    idle.erase(it);
+
+    // the file must not have been changed or unlinked behind our back since it was released
+    struct stat cached;
+    int err = fstat(e->fd, &cached);
+    if (err < 0 || cached.st_nlink == 0 || e->size != st.st_size || e->mtime.tv_sec != st.st_mtim.tv_sec || e->mtime.tv_nsec != st.st_mtim.tv_nsec) {
+        close(e->fd);
+        lru.erase(e);
+        return -1;
+    }
+    int fd = e->fd;
+    active[fd] = key;
+    lru.erase(e);
+    log(DEBUG, "Open file cache hit: %d", fd);
+    return fd;
+}
+
+void FileCache::track(int fd, const struct stat &st, int flags) {
+    if (!cacheable(flags)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    active[fd] = file_key{.dev = st.st_dev, .ino = st.st_ino, .flags = flags};
+}
+
+bool FileCache::release(int fd) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = active.find(fd);
+    if (it == active.end()) {
+        return false;
+    }
+    file_key key = it->second;
+    active.erase(it);
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_nlink == 0) {
+        return false;
+    }
+    // the entry is stale when the descriptor was closed elsewhere and its number reused
+    const int status = fcntl(fd, F_GETFL);
+    if (st.st_dev != key.dev || st.st_ino != key.ino || status < 0 || (status & O_ACCMODE) != O_RDONLY) {
+        log(DEBUG, "Open file cache entry of %d is stale", fd);
+        return false;
+    }
+    // a lock taken through this descriptor must not outlive the client's handle
+    flock(fd, LOCK_UN);
+
+    lru.push_front(entry{.fd = fd, .key = key, .mtime = st.st_mtim, .size = st.st_size});
+    idle.emplace(key, lru.begin());
+    while (lru.size() > capacity) {
+        auto last = std::prev(lru.end());
+        close(last->fd);
+        evict(last);
+    }
+    return true;
+}
+
+void FileCache::evict(std::list<entry>::iterator it) {
+    auto [begin, end] = idle.equal_range(it->key);
+    for (auto i = begin; i != end; i++) {
+        if (i->second == it) {
+            idle.erase(i);
+            break;
+        }
+    }
+    lru.erase(it);
+}
+
+void FileCache::invalidate(dev_t dev, ino_t ino) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = idle.lower_bound(file_key{.dev = dev, .ino = ino, .flags = INT_MIN});
+    while (it != idle.end() && it->first.dev == dev && it->first.ino == ino) {
+        close(it->second->fd);
+        lru.erase(it->second);
+        it = idle.erase(it);
+    }
+}
+
+void FileCache::invalidate(int fd) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idle.empty()) {
+            return;
+        }
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+        invalidate(st.st_dev, st.st_ino);
+    }
+}
+
+void FileCache::invalidate(const std::string &path) {
+    struct stat st;
+    if (lstat(path.c_str(), &st) == 0) {
+        invalidate(st.st_dev, st.st_ino);
+    }
+}
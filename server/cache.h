@@ -0,0 +1,53 @@
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+
+struct file_key {
+    dev_t dev;
+    ino_t ino;
+    int flags;
+
+    auto operator<=>(const file_key &) const = default;
+};
+
+// Keeps recently released read-only descriptors open so that repeated
+// OPEN/RELEASE pairs on the same file can reuse them.
+class FileCache {
+  public:
+    explicit FileCache(size_t limit);
+    ~FileCache();
+
+    static bool cacheable(int flags);
+
+    // Returns a cached descriptor for the file described by st or -1 on miss.
+    int acquire(const struct stat &st, int flags);
+    // Remember that fd was opened with the given flags so it can be cached on release.
+    void track(int fd, const struct stat &st, int flags);
+    // Returns true if the cache took ownership of fd, the caller must close it otherwise.
+    // A descriptor which is not the tracked file any more is not cached.
+    bool release(int fd);
+    void invalidate(dev_t dev, ino_t ino);
+    void invalidate(int fd);
+    void invalidate(const std::string &path);
+
+  private:
+    struct entry {
+        int fd;
+        file_key key;
+        struct timespec mtime;
+        off_t size;
+    };
+
+    void evict(std::list<entry>::iterator it);
+
+    size_t capacity;
+    std::mutex mutex;
+    std::list<entry> lru;
+    std::multimap<file_key, std::list<entry>::iterator> idle;
+    std::map<int, file_key> active;
+};
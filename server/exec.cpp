@@ -0,0 +1,324 @@
+#include "exec.h"
+
+#include "../common/io.h"
+#include "../common/log.h"
+#include "export.h"
+#include "metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <linux/close_range.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+extern char **environ;
+
+// the output is sent once a chunk grows over this size, or when the command is quiet for a moment
+static const size_t chunk_size = 1 << 16;
+static const int flush_delay_ms = 20;
+static const auto poll_interval = std::chrono::milliseconds(100);
+// a cancelled command is killed when it does not exit within this time after SIGTERM
+static const auto kill_grace = std::chrono::seconds(2);
+static const int max_execs = 8;
+static const rlim_t cpu_limit = 30 * 60;
+static const rlim_t file_size_limit = 4ull << 30;
+
+static std::set<std::string> allowed_commands;
+// the variables a client may set, anything which changes how programs are loaded or
+// found (LD_*, PATH, BASH_ENV, ENV) is not among them
+static const std::set<std::string, std::less<>> allowed_variables = {
+    "CC", "CXX", "CFLAGS", "CXXFLAGS", "CPPFLAGS", "LDFLAGS", "MAKEFLAGS", "LANG", "LC_ALL", "TERM", "NO_COLOR", "VERBOSE",
+    "CMAKE_BUILD_PARALLEL_LEVEL", "CTEST_OUTPUT_ON_FAILURE", "CTEST_PARALLEL_LEVEL",
+};
+
+struct execution {
+    int sock;
+    gnutls_session_t ssl;
+    // the output is sent on it, the commands of a session are found by it
+    std::shared_ptr<Connection> connection;
+    int id;
+    pid_t pid = -1;
+    std::atomic<bool> cancelled = false;
+    // only used by the thread of the command
+    bool terminated = false;
+    std::chrono::steady_clock::time_point terminated_at;
+
+    execution(int socket, gnutls_session_t session, int request_id)
+        : sock(socket), ssl(session), connection(hold_connection(socket, session)), id(request_id) {}
+};
+
+// keyed by the session and not the socket, the descriptor of a closed connection may be reused
+static std::map<std::pair<const Connection *, int>, std::shared_ptr<execution>> execs;
+static std::mutex execs_mutex;
+
+static void send_chunk(execution &e, ExecResponse &res) {
+    if (e.connection == nullptr || e.connection->send_chunk(e.id, Type::EXEC_RESPONSE, &res, e.cancelled) < 0) {
+        log(DEBUG, e.sock, "(%d) Failed to send command output", e.id);
+        e.cancelled = true;
+    }
+    res.Clear();
+}
+
+// The command runs in its own process group, which is signalled as a whole.
+static void stop_if_cancelled(execution &e) {
+    if (!e.cancelled) {
+        return;
+    }
+    if (!e.terminated) {
+        kill(-e.pid, SIGTERM);
+        e.terminated = true;
+        e.terminated_at = std::chrono::steady_clock::now();
+    } else if (std::chrono::steady_clock::now() - e.terminated_at > kill_grace) {
+        kill(-e.pid, SIGKILL);
+    }
+}
+
+// Only async-signal-safe calls between fork and exec, the server is multi-threaded.
+static void exec_child(char *const argv[], char *const envp[], const char *dir, int out, int err, int status) {
+    setpgid(0, 0);
+    const rlimit cpu = {cpu_limit, cpu_limit + 5};
+    const rlimit file_size = {file_size_limit, file_size_limit};
+    const rlimit core = {0, 0};
+    setrlimit(RLIMIT_CPU, &cpu);
+    setrlimit(RLIMIT_FSIZE, &file_size);
+    setrlimit(RLIMIT_CORE, &core);
+    // the builds should not slow down the requests of the editors
+    setpriority(PRIO_PROCESS, 0, 10);
+    signal(SIGPIPE, SIG_DFL);
+    int null = open("/dev/null", O_RDONLY);
+    if (chdir(dir) == 0 && null >= 0 && dup2(null, STDIN_FILENO) >= 0 && dup2(out, STDOUT_FILENO) >= 0 && dup2(err, STDERR_FILENO) >= 0) {
+        syscall(SYS_close_range, 3, ~0U, CLOSE_RANGE_CLOEXEC);
+        execvpe(argv[0], argv, envp);
+    }
+    int error = errno;
+    while (write(status, &error, sizeof(error)) < 0 && errno == EINTR) {
+    }
+    _exit(127);
+}
+
+static bool allowed_variable(const std::string &var) {
+    const auto end = var.find('=');
+    return end != std::string::npos && allowed_variables.contains(std::string_view(var).substr(0, end));
+}
+
+// Returns 0 when the command was started, the errno of the failure otherwise.
+static int spawn(execution &e, const ExecRequest &req, const std::string &dir, int *out, int *err) {
+    std::vector<std::string> env;
+    for (char **var = environ; *var != nullptr; var++) {
+        env.push_back(*var);
+    }
+    for (const auto &var : req.env()) {
+        const auto name = var.substr(0, var.find('=') + 1);
+        std::erase_if(env, [&name](const std::string &existing) { return existing.starts_with(name); });
+        env.push_back(var);
+    }
+    std::vector<char *> argv;
+    for (const auto &arg : req.argv()) {
+        argv.push_back(const_cast<char *>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+    std::vector<char *> envp;
+    for (auto &var : env) {
+        envp.push_back(var.data());
+    }
+    envp.push_back(nullptr);
+
+    int out_pipe[2], err_pipe[2], status_pipe[2];
+    if (pipe2(out_pipe, O_CLOEXEC) < 0) {
+        return errno;
+    }
+    if (pipe2(err_pipe, O_CLOEXEC) < 0) {
+        int error = errno;
+        close(out_pipe[0]);
+        close(out_pipe[1]);
+        return error;
+    }
+    // closed by a successful exec, carries the errno of a failed one
+    if (pipe2(status_pipe, O_CLOEXEC) < 0) {
+        int error = errno;
+        for (int fd : {out_pipe[0], out_pipe[1], err_pipe[0], err_pipe[1]}) {
+            close(fd);
+        }
+        return error;
+    }
+    e.pid = fork();
+    if (e.pid == 0) {
+        exec_child(argv.data(), envp.data(), dir.c_str(), out_pipe[1], err_pipe[1], status_pipe[1]);
+    }
+    int error = e.pid < 0 ? errno : 0;
+    for (int fd : {out_pipe[1], err_pipe[1], status_pipe[1]}) {
+        close(fd);
+    }
+    if (e.pid > 0) {
+        while (read(status_pipe[0], &error, sizeof(error)) < 0 && errno == EINTR) {
+        }
+        if (error != 0) {
+            waitpid(e.pid, nullptr, 0);
+        }
+    }
+    close(status_pipe[0]);
+    if (error != 0) {
+        close(out_pipe[0]);
+        close(err_pipe[0]);
+        return error;
+    }
+    *out = out_pipe[0];
+    *err = err_pipe[0];
+    return 0;
+}
+
+static void run(const std::shared_ptr<execution> &e, int out, int err) {
+    const auto start = std::chrono::steady_clock::now();
+    pollfd fds[2] = {{out, POLLIN, 0}, {err, POLLIN, 0}};
+    int remaining = 2;
+    std::vector<char> buffer(chunk_size);
+    ExecResponse pending;
+    while (remaining > 0) {
+        stop_if_cancelled(*e);
+        const bool buffered = !pending.output().empty() || !pending.error_output().empty();
+        int ready = poll(fds, 2, buffered ? flush_delay_ms : poll_interval.count());
+        if (ready < 0 && errno != EINTR) {
+            log(ERROR, e->sock, "(%d) Failed to poll the command output: %s", e->id, strerror(errno));
+            e->cancelled = true;
+            break;
+        }
+        if (ready <= 0) {
+            if (buffered) {
+                send_chunk(*e, pending);
+            }
+            continue;
+        }
+        for (auto &fd : fds) {
+            if (fd.fd < 0 || fd.revents == 0) {
+                continue;
+            }
+            ssize_t n = read(fd.fd, buffer.data(), buffer.size());
+            if (n > 0) {
+                (fd.fd == out ? pending.mutable_output() : pending.mutable_error_output())->append(buffer.data(), n);
+            } else if (n == 0 || errno != EINTR) {
+                close(fd.fd);
+                fd.fd = -1;
+                remaining--;
+            }
+        }
+        if (pending.output().size() + pending.error_output().size() >= chunk_size) {
+            send_chunk(*e, pending);
+        }
+    }
+    for (const auto &fd : fds) {
+        if (fd.fd >= 0) {
+            close(fd.fd);
+        }
+    }
+
+    // the command may keep running after closing its output
+    int status = 0;
+    while (waitpid(e->pid, &status, WNOHANG) == 0) {
+        stop_if_cancelled(*e);
+        std::this_thread::sleep_for(poll_interval);
+    }
+    histogram("exec_ms").record(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    log(DEBUG, e->sock, "(%d) Command finished with status %d", e->id, status);
+
+    pending.set_done(true);
+    pending.set_error(e->cancelled ? ECANCELED : 0);
+    if (WIFEXITED(status)) {
+        pending.set_exit_code(WEXITSTATUS(status));
+    } else if (WIFSIGNALED(status)) {
+        pending.set_signal(WTERMSIG(status));
+    }
+    send_chunk(*e, pending);
+
+    std::lock_guard<std::mutex> lock(execs_mutex);
+    execs.erase({e->connection.get(), e->id});
+}
+
+int handle_exec_request(int sock, gnutls_session_t ssl, int id, ExecRequest *req) {
+    Export &ex = *find_export(sock);
+    ExecResponse res;
+    std::string dir = std::filesystem::weakly_canonical(ex.path + "/" + req->path());
+    std::error_code ec;
+    if (req->argv_size() == 0) {
+        res.set_error(EINVAL);
+    } else if (allowed_commands.count(req->argv(0)) == 0) {
+        log(INFO, sock, "(%d) Command %s is not allowed", id, req->argv(0).c_str());
+        res.set_error(EPERM);
+    } else if (auto var = std::find_if_not(req->env().begin(), req->env().end(), allowed_variable); var != req->env().end()) {
+        log(INFO, sock, "(%d) Variable %s may not be set", id, var->substr(0, var->find('=')).c_str());
+        res.set_error(EPERM);
+    } else if (!ex.contains(dir)) {
+        res.set_error(EACCES);
+    } else if (!std::filesystem::is_directory(dir, ec)) {
+        res.set_error(ENOTDIR);
+    }
+
+    auto e = std::make_shared<execution>(sock, ssl, id);
+    if (res.error() == 0) {
+        std::lock_guard<std::mutex> lock(execs_mutex);
+        const Connection *session = e->connection.get();
+        int running = std::count_if(execs.begin(), execs.end(), [session](const auto &exec) { return exec.first.first == session; });
+        if (running >= max_execs) {
+            res.set_error(EAGAIN);
+        } else if (!execs.emplace(std::make_pair(session, id), e).second) {
+            res.set_error(EBUSY);
+        }
+    }
+    int out, err;
+    if (res.error() == 0) {
+        int error = spawn(*e, *req, dir, &out, &err);
+        if (error != 0) {
+            log(DEBUG, sock, "(%d) Failed to execute %s: %s", id, req->argv(0).c_str(), strerror(error));
+            res.set_error(error);
+            std::lock_guard<std::mutex> lock(execs_mutex);
+            execs.erase({e->connection.get(), id});
+        }
+    }
+    if (res.error() != 0) {
+        res.set_done(true);
+        return send_message(sock, ssl, id, Type::EXEC_RESPONSE, &res) < 0 ? -1 : 0;
+    }
+    counter("exec").fetch_add(1, std::memory_order_relaxed);
+    log(INFO, sock, "(%d) Executing %s in %s", id, req->argv(0).c_str(), dir.c_str());
+
+    // the commands run for long, they get their own threads instead of the pool
+    std::thread([e, out, err] { run(e, out, err); }).detach();
+    return 0;
+}
+
+int handle_exec_cancel_request(int sock, gnutls_session_t ssl, int id, ExecCancelRequest *req) {
+    ExecCancelResponse res;
+    {
+        std::lock_guard<std::mutex> lock(execs_mutex);
+        auto it = execs.find({hold_connection(sock, ssl).get(), req->exec_id()});
+        if (it == execs.end()) {
+            res.set_error(ESRCH);
+        } else {
+            it->second->cancelled = true;
+        }
+    }
+    return send_message(sock, ssl, id, Type::EXEC_CANCEL_RESPONSE, &res) < 0 ? -1 : 0;
+}
+
+void cancel_execs(const Connection *connection) {
+    std::lock_guard<std::mutex> lock(execs_mutex);
+    for (auto &[key, e] : execs) {
+        if (key.first == connection) {
+            e->cancelled = true;
+        }
+    }
+}
+
+void initialize_exec(std::set<std::string> allowed) { allowed_commands = std::move(allowed); }
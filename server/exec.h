@@ -0,0 +1,14 @@
+#pragma once
+#include "../proto/messages.pb.h"
+#include <gnutls/gnutls.h>
+#include <set>
+#include <string>
+
+class Connection;
+
+int handle_exec_request(int sock, gnutls_session_t ssl, int id, ExecRequest *request);
+int handle_exec_cancel_request(int sock, gnutls_session_t ssl, int id, ExecCancelRequest *request);
+// Kills the commands of a closing connection.
+void cancel_execs(const Connection *connection);
+// Only the commands named in allowed may be executed, by the name given there.
+void initialize_exec(std::set<std::string> allowed);
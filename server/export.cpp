@@ -0,0 +1,115 @@
+#include "export.h"
+
+#include "../common/log.h"
+#include <filesystem>
+#include <shared_mutex>
+
+static std::map<std::string, std::unique_ptr<Export>> exports;
+// the exports are added before the server starts listening, only the selections change
+static std::map<int, Export *> selected;
+static std::shared_mutex selected_mutex;
+
+Export::Export(std::string export_name, std::string export_path) : name(std::move(export_name)), path(export_path), lsp(export_path) {}
+
+bool Export::contains(const std::string &canonical) const {
+    if (!canonical.starts_with(path)) {
+        return false;
+    }
+    // the root directory is the only canonical path ending with a slash
+    return canonical.size() == path.size() || path.back() == '/' || canonical[path.size()] == '/';
+}
+
+void Export::add_handle(int fd, const std::string &written, uint64_t token) {
+    std::lock_guard<std::mutex> lock(handles_mutex);
+    handle &h = handles[fd];
+    h.references++;
+    if (!written.empty()) {
+        h.written = written;
+    }
+    if (token != 0) {
+        h.tokens.push_back(token);
+        tokens[token] = fd;
+    }
+}
+
+int Export::find_token(uint64_t token) {
+    std::lock_guard<std::mutex> lock(handles_mutex);
+    auto it = tokens.find(token);
+    return it != tokens.end() ? it->second : -1;
+}
+
+bool Export::remove_handle(int fd) {
+    std::lock_guard<std::mutex> lock(handles_mutex);
+    auto it = handles.find(fd);
+    if (it == handles.end()) {
+        return false;
+    }
+    if (--it->second.references == 0) {
+        for (uint64_t token : it->second.tokens) {
+            tokens.erase(token);
+        }
+        handles.erase(it);
+    }
+    return true;
+}
+
+bool Export::owns_handle(int fd) {
+    std::lock_guard<std::mutex> lock(handles_mutex);
+    return handles.find(fd) != handles.end();
+}
+
+std::string Export::written_path(int fd) {
+    std::lock_guard<std::mutex> lock(handles_mutex);
+    auto it = handles.find(fd);
+    return it != handles.end() ? it->second.written : "";
+}
+
+bool add_export(const std::string &name, const std::string &path) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(path, ec)) {
+        log(ERROR, "Directory %s does not exist", path.c_str());
+        return false;
+    }
+    auto canonical = std::filesystem::weakly_canonical(path).string();
+    if (!exports.emplace(name, std::make_unique<Export>(name, canonical)).second) {
+        log(ERROR, "Export %s is given twice", name.c_str());
+        return false;
+    }
+    log(INFO, "Exporting %s as '%s'", canonical.c_str(), name.c_str());
+    return true;
+}
+
+std::vector<Export *> all_exports() {
+    std::vector<Export *> all;
+    for (auto &[name, ex] : exports) {
+        all.push_back(ex.get());
+    }
+    return all;
+}
+
+bool select_export(int sock, const std::string &name) {
+    auto it = exports.find(name);
+    if (it == exports.end()) {
+        return false;
+    }
+    std::unique_lock<std::shared_mutex> lock(selected_mutex);
+    selected[sock] = it->second.get();
+    return true;
+}
+
+void forget_export(int sock) {
+    std::unique_lock<std::shared_mutex> lock(selected_mutex);
+    selected.erase(sock);
+}
+
+Export *find_export(int sock) {
+    {
+        std::shared_lock<std::shared_mutex> lock(selected_mutex);
+        auto it = selected.find(sock);
+        if (it != selected.end()) {
+            return it->second;
+        }
+    }
+    auto it = exports.find("");
+    return it != exports.end() ? it->second.get() : nullptr;
+}
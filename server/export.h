@@ -0,0 +1,64 @@
+#pragma once
+#include "index.h"
+#include "lsp.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// A project directory served under a name. A client selects the export with its init
+// request, the handles opened and the language servers started by the clients of one
+// export are not visible to the clients of the others. The thread pools, the file cache
+// and the fsync scheduler are shared by all exports.
+class Export {
+  public:
+    Export(std::string name, std::string path);
+
+    const std::string name;
+    // canonical, the paths of the requests are relative to it
+    const std::string path;
+    // null unless the server was started with --index
+    std::unique_ptr<MetadataIndex> index;
+    LspPool lsp;
+
+    // Checks that a canonical path is the export or inside it (prevents directory traversal),
+    // a sibling sharing the prefix of the name is not.
+    bool contains(const std::string &canonical) const;
+
+    // Registers a descriptor handed to a client. written is the path of a descriptor opened
+    // for writing, used to refresh the metadata index after the writes, empty otherwise.
+    // token is the token of the open request, 0 when it has none.
+    void add_handle(int fd, const std::string &written, uint64_t token);
+    // The descriptor handed out for the token of an open request, -1 when there is none.
+    int find_token(uint64_t token);
+    // Forgets one reference to the descriptor, false when the export did not hand it out.
+    bool remove_handle(int fd);
+    // False when the descriptor was not handed to the clients of the export.
+    bool owns_handle(int fd);
+    // The path written through the descriptor, empty when it was not opened for writing.
+    std::string written_path(int fd);
+
+  private:
+    struct handle {
+        // the file cache hands out the same descriptor more than once
+        int references = 0;
+        std::string written;
+        std::vector<uint64_t> tokens;
+    };
+
+    std::mutex handles_mutex;
+    std::map<int, handle> handles;
+    std::map<uint64_t, int> tokens;
+};
+
+// The export with the empty name is used by the clients which do not select one.
+bool add_export(const std::string &name, const std::string &path);
+std::vector<Export *> all_exports();
+// Selects the export of the connection, false when there is no export with the name.
+bool select_export(int sock, const std::string &name);
+// Forgets the export of a closed connection, its socket number is reused.
+void forget_export(int sock);
+// The export selected by the connection or the default one, null when there is neither.
+Export *find_export(int sock);
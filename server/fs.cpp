@@ -2,7 +2,16 @@
 
 #include "../common/log.h"
 #include "../proto/messages.pb.h"
+#include "cache.h"
+#include "exec.h"
+#include "export.h"
+#include "index.h"
 #include "lsp.h"
+#include "pool.h"
+#include "search.h"
+#include "sync.h"
+#include "tcp.h"
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <cstdlib>
@@ -11,6 +20,9 @@
 #include <filesystem>
 #include <linux/limits.h>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <string>
 #include <sys/file.h>
 #include <sys/stat.h>
@@ -25,47 +37,134 @@ struct client_info {
 };
 
 std::list<client_info> clients_info;
-std::string base_path = "";
-std::map<int, DIR *> dirs;
+std::mutex clients_info_mutex;
+// tells the reconnecting clients whether their handles are still open
+static const uint64_t instance = (uint64_t(std::random_device()()) << 32) | std::random_device()();
+// fd is -1 for directories listed from the metadata index, entries holds the listing then
+struct dir_handle {
+    Export *owner;
+    int fd;
+    std::string path;
+    std::vector<index_entry> entries;
+    // the token of the opendir request, 0 when it had none
+    uint64_t token = 0;
+    // the requests are handled in parallel, getdents reads from the offset of fd and
+    // the listing of the index is taken again at offset 0
+    std::mutex mutex;
+};
+
+std::map<int, std::shared_ptr<dir_handle>> dirs;
+// the directory descriptors by the tokens of their opendir requests
+std::map<uint64_t, int> dir_tokens;
+std::mutex dirs_mutex;
 long int dir_iter = 0;
+const int read_dir_default_size = 1 << 16;
+const int read_dir_max_size = 1 << 20;
+static FileCache file_cache(256);
 
-static int init_request(int sock, gnutls_session_t ssl, int id, InitRequest *req) {
-    clients_info.push_back(client_info{.fd = sock, .name = req->name()});
-    (void)req;
-    InitResponse res;
-    res.set_error(0);
-    int err = send_message(sock, ssl, id, Type::INIT_RESPONSE, &res);
-    if (err < 0) {
-        return -1;
+static void index_refresh(Export &ex, const std::string &path) {
+    if (ex.index != nullptr) {
+        ex.index->refresh(path);
     }
-    return 0;
 }
 
-static int get_attr_request(int sock, gnutls_session_t ssl, int id, GetAttrRequest *req) {
-    GetAttrResponse res;
+// Registers a descriptor opened for a client of the export.
+static void track_handle(Export &ex, int fd, int flags, const std::string &path, uint64_t token) {
+    ex.add_handle(fd, ex.index != nullptr && (flags & O_ACCMODE) != O_RDONLY ? path : "", token);
+}
+
+static void index_refresh_fd(Export &ex, int fd) {
+    if (ex.index == nullptr) {
+        return;
+    }
+    std::string path = ex.written_path(fd);
+    if (!path.empty()) {
+        ex.index->refresh(path);
+    }
+}
+
+// The descriptor of the request when it was opened by a client of the export, -1 otherwise
+// so that the syscall fails with EBADF.
+static int handle_of(Export &ex, int fd) { return ex.owns_handle(fd) ? fd : -1; }
+
+static std::shared_ptr<dir_handle> find_dir(Export &ex, int directory_descriptor) {
+    std::lock_guard<std::mutex> lock(dirs_mutex);
+    auto dir = dirs.find(directory_descriptor);
+    return dir == dirs.end() || dir->second->owner != &ex ? nullptr : dir->second;
+}
+
+static void fill_attr(GetAttrResponse &res, const struct stat &st) {
+    res.set_error(0);
+    res.set_mode(st.st_mode);
+    res.set_size(st.st_size);
+    res.set_nlink(st.st_nlink);
+    res.set_atime(st.st_atime);
+    res.set_mtime(st.st_mtime);
+    res.set_ctime(st.st_ctime);
+    res.set_own(getuid() == st.st_uid);
+    res.set_gown(getgid() == st.st_gid);
+}
+
+static void fill_attr(GetAttrResponse &res, const struct statx &stx) {
+    res.set_error(0);
+    res.set_mode(stx.stx_mode);
+    res.set_size(stx.stx_size);
+    res.set_nlink(stx.stx_nlink);
+    res.set_atime(stx.stx_atime.tv_sec);
+    res.set_mtime(stx.stx_mtime.tv_sec);
+    res.set_ctime(stx.stx_ctime.tv_sec);
+    res.set_own(getuid() == stx.stx_uid);
+    res.set_gown(getgid() == stx.stx_gid);
+}
+
+static const unsigned int attr_mask = STATX_TYPE | STATX_MODE | STATX_NLINK | STATX_UID | STATX_GID | STATX_ATIME | STATX_MTIME | STATX_CTIME | STATX_SIZE;
+
+static void stat_path(Export &ex, const std::string &req_path, GetAttrResponse &res) {
+    struct stat indexed;
+    int indexed_err = ex.index != nullptr ? ex.index->stat(req_path, &indexed) : -1;
     // check if the path is inside the base path (prevent directory traversal)
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = indexed_err < 0 ? std::filesystem::weakly_canonical(ex.path + req_path).string() : ex.path;
+    if (indexed_err > 0) {
+        res.set_error(indexed_err);
+    } else if (indexed_err == 0) {
+        fill_attr(res, indexed);
+    } else if (!ex.contains(path)) {
         res.set_error(EPERM);
     } else {
-        struct stat st;
+        struct statx stx;
         // weekly_cannonical don't work with symlinks
-        std::string raw_path = base_path + req->path();
-        int err = lstat(raw_path.c_str(), &st);
+        std::string raw_path = ex.path + req_path;
+        int err = statx(AT_FDCWD, raw_path.c_str(), AT_SYMLINK_NOFOLLOW, attr_mask, &stx);
         if (err < 0) {
             res.set_error(errno);
         } else {
-            res.set_error(0);
-            res.set_mode(st.st_mode);
-            res.set_size(st.st_size);
-            res.set_nlink(st.st_nlink);
-            res.set_atime(st.st_atime);
-            res.set_mtime(st.st_mtime);
-            res.set_ctime(st.st_ctime);
-            res.set_own(getuid() == st.st_uid);
-            res.set_gown(getgid() == st.st_gid);
+            fill_attr(res, stx);
         }
     }
+}
+
+static int init_request(int sock, gnutls_session_t ssl, int id, InitRequest *req) {
+    {
+        std::lock_guard<std::mutex> lock(clients_info_mutex);
+        clients_info.push_back(client_info{.fd = sock, .name = req->name()});
+    }
+    InitResponse res;
+    // the clients which do not name an export get the one with the empty name
+    res.set_error(select_export(sock, req->export_name()) ? 0 : ENOENT);
+    res.set_instance(instance);
+    res.set_credits(req->credits() > 0 ? std::min(req->credits(), max_credits) : max_credits);
+    res.set_credit_bytes(req->credit_bytes() > 0 ? std::min(req->credit_bytes(), max_credit_bytes) : max_credit_bytes);
+    int err = send_message(sock, ssl, id, Type::INIT_RESPONSE, &res);
+    if (err < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int get_attr_request(int sock, gnutls_session_t ssl, int id, GetAttrRequest *req) {
+    Export &ex = *find_export(sock);
+    GetAttrResponse res;
+    stat_path(ex, req->path(), res);
     int err = send_message(sock, ssl, id, Type::GET_ATTR_RESPONSE, &res);
     if (err < 0) {
         return -1;
@@ -73,21 +172,61 @@ static int get_attr_request(int sock, gnutls_session_t ssl, int id, GetAttrReque
     return 0;
 }
 
+static int batch_stat_request(int sock, gnutls_session_t ssl, int id, BatchStatRequest *req) {
+    Export &ex = *find_export(sock);
+    BatchStatResponse res;
+    res.set_error(0);
+    for (int i = 0; i < req->paths_size(); i++) {
+        res.add_results();
+    }
+    worker_pool().parallel_for(req->paths_size(), [&ex, req, &res](size_t i) { stat_path(ex, req->paths(i), *res.mutable_results(i)); });
+    int err = send_message(sock, ssl, id, Type::BATCH_STAT_RESPONSE, &res);
+    if (err < 0) {
+        return -1;
+    }
+    return 0;
+}
+
 static int open_request(int sock, gnutls_session_t ssl, int id, OpenRequest *req) {
+    Export &ex = *find_export(sock);
     OpenResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    int descriptor = -1;
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
-        int fd = open(path.c_str(), req->flags());
+        // the open was sent again after a reconnect and the first one was handled, its response was lost
+        int fd = req->token() != 0 ? ex.find_token(req->token()) : -1;
+        if (fd < 0) {
+            struct stat st;
+            bool cacheable = FileCache::cacheable(req->flags()) && stat(path.c_str(), &st) == 0;
+            if (cacheable) {
+                fd = file_cache.acquire(st, req->flags());
+            }
+            if (fd < 0) {
+                fd = open(path.c_str(), req->flags());
+                if (fd > 0 && cacheable && fstat(fd, &st) == 0) {
+                    file_cache.track(fd, st, req->flags());
+                }
+            }
+            if (fd > 0) {
+                track_handle(ex, fd, req->flags(), req->path(), req->token());
+            }
+        }
         if (fd > 0) {
             res.set_fd(fd);
+            // a filesystem on the same host reads and writes the file itself, the handle
+            // stays open here for the metadata requests and the release
+            if (req->passthrough() && can_pass_descriptors(sock, ssl)) {
+                descriptor = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+                res.set_passthrough(descriptor >= 0);
+            }
         } else {
             res.set_error(errno);
         }
     }
 
-    int err = send_message(sock, ssl, id, Type::OPEN_RESPONSE, &res);
+    int err = send_message(sock, ssl, id, Type::OPEN_RESPONSE, &res, descriptor);
     if (err < 0) {
         return -1;
     }
@@ -95,37 +234,103 @@ static int open_request(int sock, gnutls_session_t ssl, int id, OpenRequest *req
 }
 
 static int release_request(int sock, gnutls_session_t ssl, int id, ReleaseRequest *req) {
-    (void)req;
+    Export &ex = *find_export(sock);
     ReleaseResponse res;
-    int err = close(req->fd());
-    if (err < 0) {
+    // the writes of a passthrough handle did not go through the server
+    index_refresh_fd(ex, req->fd());
+    if (!ex.remove_handle(req->fd())) {
+        res.set_error(EBADF);
+    } else if (!file_cache.release(req->fd()) && close(req->fd()) < 0) {
         res.set_error(errno);
     } else {
         res.set_error(0);
     }
-    err = send_message(sock, ssl, id, Type::RELEASE_RESPONSE, &res);
+    int err = send_message(sock, ssl, id, Type::RELEASE_RESPONSE, &res);
     if (err < 0) {
         return -1;
     }
     return 0;
 }
 
+// Fills at most budget bytes of entries starting at the cookie offset, the cookie of each
+// entry is the position right after it. The glibc dirent64 has the same layout as the
+// kernel's linux_dirent64 returned by getdents64.
+static void read_dir_fd(int fd, off_t offset, int budget, ReadDirResponse &res) {
+    if (lseek(fd, offset, SEEK_SET) < 0) {
+        res.set_error(errno);
+        return;
+    }
+    auto buf = std::make_unique<char[]>(budget);
+    int used = 0;
+    bool full = false;
+    res.set_error(0);
+    while (!full) {
+        long len = syscall(SYS_getdents64, fd, buf.get(), budget - used);
+        if (len < 0) {
+            // EINVAL means that the next entry does not fit into the remaining budget
+            if (errno != EINVAL || res.entries_size() == 0) {
+                res.set_error(errno);
+            }
+            return;
+        }
+        if (len == 0) {
+            res.set_eof(true);
+            return;
+        }
+        for (long pos = 0; pos < len;) {
+            auto *entry = reinterpret_cast<dirent64 *>(buf.get() + pos);
+            int entry_size = strlen(entry->d_name) + 16;
+            if (used + entry_size > budget && res.entries_size() > 0) {
+                full = true;
+                break;
+            }
+            DirEntry *e = res.add_entries();
+            e->set_name(entry->d_name);
+            e->set_offset(entry->d_off);
+            e->set_type(entry->d_type);
+            used += entry_size;
+            pos += entry->d_reclen;
+        }
+    }
+}
+
+// Same as read_dir_fd for a listing taken from the metadata index, the cookie is the position.
+static void read_dir_indexed(const dir_handle &dir, off_t offset, int budget, ReadDirResponse &res) {
+    res.set_error(0);
+    int used = 0;
+    size_t i = offset;
+    for (; i < dir.entries.size(); i++) {
+        int entry_size = dir.entries[i].name.size() + 16;
+        if (used + entry_size > budget && res.entries_size() > 0) {
+            break;
+        }
+        DirEntry *e = res.add_entries();
+        e->set_name(dir.entries[i].name);
+        e->set_offset(i + 1);
+        e->set_type(dir.entries[i].type);
+        used += entry_size;
+    }
+    res.set_eof(i >= dir.entries.size());
+}
+
 static int read_dir_request(int sock, gnutls_session_t ssl, int id, ReadDirRequest *req) {
+    Export &ex = *find_export(sock);
     ReadDirResponse res;
-    DIR *dir = dirs[req->directory_descriptor()];
+    int budget = req->size() > 0 ? std::min(req->size(), read_dir_max_size) : read_dir_default_size;
+    auto dir = find_dir(ex, req->directory_descriptor());
     if (dir == nullptr) {
-        res.set_error(errno);
-    } else {
-        struct dirent *entry;
-        errno = 0;
-        while ((entry = readdir(dir)) != nullptr) {
-            res.add_names(entry->d_name);
-        }
-        if (errno != 0) {
-            res.set_error(errno);
-        } else {
-            res.set_error(0);
+        res.set_error(EBADF);
+    } else if (dir->fd < 0) {
+        std::lock_guard<std::mutex> lock(dir->mutex);
+        std::vector<index_entry> entries;
+        // the listing starts again after a rewinddir, it shows the entries added since
+        if (req->offset() == 0 && dir->owner->index->list(dir->path, entries) == 0) {
+            dir->entries = std::move(entries);
         }
+        read_dir_indexed(*dir, req->offset(), budget, res);
+    } else {
+        std::lock_guard<std::mutex> lock(dir->mutex);
+        read_dir_fd(dir->fd, req->offset(), budget, res);
     }
     int err = send_message(sock, ssl, id, Type::READ_DIR_RESPONSE, &res);
     if (err < 0) {
@@ -135,18 +340,19 @@ static int read_dir_request(int sock, gnutls_session_t ssl, int id, ReadDirReque
 }
 
 static int read_request(int sock, gnutls_session_t ssl, int id, ReadRequest *req) {
+    Export &ex = *find_export(sock);
     ReadResponse res;
-    char *buf = new char[req->size()];
-    int err = lseek(req->fd(), req->offset(), SEEK_SET);
-    if (err >= 0) {
-        err = read(req->fd(), buf, req->size());
-    }
+    // a larger read would not fit in the window of the client
+    const size_t size = std::clamp<int64_t>(req->size(), 0, max_credit_bytes);
+    char *buf = new char[size];
+    int err = pread(handle_of(ex, req->fd()), buf, size, req->offset());
     if (err < 0) {
         res.set_error(errno);
     } else {
         res.set_error(0);
         res.set_data(buf, err);
     }
+    delete[] buf;
     err = send_message(sock, ssl, id, Type::READ_RESPONSE, &res);
     if (err < 0) {
         return -1;
@@ -155,11 +361,11 @@ static int read_request(int sock, gnutls_session_t ssl, int id, ReadRequest *req
 }
 
 static int write_request(int sock, gnutls_session_t ssl, int id, WriteRequest *req) {
+    Export &ex = *find_export(sock);
     WriteResponse res;
-    int err = lseek(req->fd(), req->offset(), SEEK_SET);
-    if (err >= 0) {
-        err = write(req->fd(), req->data().c_str(), req->data().size());
-    }
+    int err = pwrite(handle_of(ex, req->fd()), req->data().c_str(), req->data().size(), req->offset());
+    file_cache.invalidate(req->fd());
+    index_refresh_fd(ex, req->fd());
     if (err < 0) {
         res.set_error(errno);
     } else {
@@ -174,14 +380,18 @@ static int write_request(int sock, gnutls_session_t ssl, int id, WriteRequest *r
 }
 
 static int create_request(int sock, gnutls_session_t ssl, int id, CreateRequest *req) {
+    Export &ex = *find_export(sock);
     CreateResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
+        file_cache.invalidate(path);
         int fd = creat(path.c_str(), req->mode());
         if (fd > 0) {
             res.set_fd(fd);
+            index_refresh(ex, req->path());
+            track_handle(ex, fd, O_WRONLY, req->path(), 0);
         } else {
             res.set_error(errno);
         }
@@ -194,10 +404,80 @@ static int create_request(int sock, gnutls_session_t ssl, int id, CreateRequest
     return 0;
 }
 
+// Writes the content to a temp file in the directory of path and renames it over path,
+// readers see either the old or the new content. Returns 0 or the errno.
+static int save_file(const std::string &path, const SaveRequest &req) {
+    std::string temp;
+    int fd = -1;
+    for (int attempt = 0; fd < 0 && attempt < 16; attempt++) {
+        temp = path + ".tea-" + std::to_string(getpid()) + "-" + std::to_string(random());
+        fd = open(temp.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, req.mode() & 07777);
+        if (fd < 0 && errno != EEXIST) {
+            return errno;
+        }
+    }
+    if (fd < 0) {
+        return EEXIST;
+    }
+    int err = 0;
+    for (size_t written = 0; err == 0 && written < req.data().size();) {
+        ssize_t n = write(fd, req.data().data() + written, req.data().size() - written);
+        if (n < 0 && errno != EINTR) {
+            err = errno;
+        } else if (n > 0) {
+            written += n;
+        }
+    }
+    if (err == 0 && req.sync()) {
+        err = sync_scheduler().sync(fd);
+    }
+    if (close(fd) < 0 && err == 0) {
+        err = errno;
+    }
+    if (err == 0 && rename(temp.c_str(), path.c_str()) < 0) {
+        err = errno;
+    }
+    if (err != 0) {
+        unlink(temp.c_str());
+    }
+    return err;
+}
+
+static int save_request(int sock, gnutls_session_t ssl, int id, SaveRequest *req) {
+    Export &ex = *find_export(sock);
+    SaveResponse res;
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    std::string from = req->from().empty() ? "" : std::filesystem::weakly_canonical(ex.path + req->from()).string();
+    if (!ex.contains(path) || (!from.empty() && !ex.contains(from))) {
+        res.set_error(EACCES);
+    } else if (from.empty()) {
+        file_cache.invalidate(path);
+        res.set_error(save_file(path, *req));
+    } else {
+        file_cache.invalidate(path);
+        file_cache.invalidate(from);
+        res.set_error(save_file(from, *req));
+        if (res.error() == 0 && rename(from.c_str(), path.c_str()) < 0) {
+            res.set_error(errno);
+        }
+        index_refresh(ex, req->from());
+    }
+    if (res.error() == 0) {
+        index_refresh(ex, req->path());
+        stat_path(ex, req->path(), *res.mutable_attr());
+    }
+    int err = send_message(sock, ssl, id, Type::SAVE_RESPONSE, &res);
+    if (err < 0) {
+        return -1;
+    }
+    return 0;
+}
+
 static int mkdir_request(int sock, gnutls_session_t ssl, int id, MkdirRequest *req) {
+    Export &ex = *find_export(sock);
     MkdirResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = mkdir(path.c_str(), req->mode());
@@ -205,6 +485,7 @@ static int mkdir_request(int sock, gnutls_session_t ssl, int id, MkdirRequest *r
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::MKDIR_RESPONSE, &res);
@@ -215,17 +496,20 @@ static int mkdir_request(int sock, gnutls_session_t ssl, int id, MkdirRequest *r
 }
 
 static int unlink_request(int sock, gnutls_session_t ssl, int id, UnlinkRequest *req) {
+    Export &ex = *find_export(sock);
     UnlinkResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
-        std::string raw_path = base_path + req->path();
+        std::string raw_path = ex.path + req->path();
+        file_cache.invalidate(raw_path);
         int err = unlink(raw_path.c_str());
         if (err < 0) {
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::UNLINK_RESPONSE, &res);
@@ -236,9 +520,10 @@ static int unlink_request(int sock, gnutls_session_t ssl, int id, UnlinkRequest
 }
 
 static int rmdir_request(int sock, gnutls_session_t ssl, int id, RmdirRequest *req) {
+    Export &ex = *find_export(sock);
     RmdirResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = rmdir(path.c_str());
@@ -246,6 +531,7 @@ static int rmdir_request(int sock, gnutls_session_t ssl, int id, RmdirRequest *r
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::RMDIR_RESPONSE, &res);
@@ -286,16 +572,19 @@ static int rename_exchange(std::string old_path, std::string new_path) {
 }
 
 static int rename_request(int sock, gnutls_session_t ssl, int id, RenameRequest *req) {
+    Export &ex = *find_export(sock);
     RenameResponse res;
-    std::string new_path = std::filesystem::weakly_canonical(base_path + req->new_path());
-    if (new_path.substr(0, base_path.size()) != base_path) {
+    std::string new_path = std::filesystem::weakly_canonical(ex.path + req->new_path());
+    if (!ex.contains(new_path)) {
         res.set_error(EACCES);
     }
-    std::string old_path = std::filesystem::weakly_canonical(base_path + req->old_path());
-    if (old_path.substr(0, base_path.size()) != base_path) {
+    std::string old_path = std::filesystem::weakly_canonical(ex.path + req->old_path());
+    if (!ex.contains(old_path)) {
         res.set_error(EACCES);
     }
     if (res.error() == 0) {
+        file_cache.invalidate(old_path);
+        file_cache.invalidate(new_path);
         int flags = req->flags();
         int err = EINVAL;
         if (flags == 0) {
@@ -306,6 +595,10 @@ static int rename_request(int sock, gnutls_session_t ssl, int id, RenameRequest
             err = rename_exchange(old_path, new_path);
         }
         res.set_error(err);
+        if (err == 0) {
+            index_refresh(ex, req->old_path());
+            index_refresh(ex, req->new_path());
+        }
     }
     int err = send_message(sock, ssl, id, Type::RENAME_RESPONSE, &res);
     if (err < 0) {
@@ -315,9 +608,10 @@ static int rename_request(int sock, gnutls_session_t ssl, int id, RenameRequest
 }
 
 static int chmod_request(int sock, gnutls_session_t ssl, int id, ChmodRequest *req) {
+    Export &ex = *find_export(sock);
     ChmodResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = chmod(path.c_str(), req->mode());
@@ -325,6 +619,7 @@ static int chmod_request(int sock, gnutls_session_t ssl, int id, ChmodRequest *r
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::CHMOD_RESPONSE, &res);
@@ -335,16 +630,19 @@ static int chmod_request(int sock, gnutls_session_t ssl, int id, ChmodRequest *r
 }
 
 static int truncate_request(int sock, gnutls_session_t ssl, int id, TruncateRequest *req) {
+    Export &ex = *find_export(sock);
     TruncateResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
+        file_cache.invalidate(path);
         int err = truncate(path.c_str(), req->size());
         if (err < 0) {
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::TRUNCATE_RESPONSE, &res);
@@ -355,9 +653,10 @@ static int truncate_request(int sock, gnutls_session_t ssl, int id, TruncateRequ
 }
 
 static int mknod_request(int sock, gnutls_session_t ssl, int id, MknodRequest *req) {
+    Export &ex = *find_export(sock);
     MknodResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = mknod(path.c_str(), req->mode(), req->dev());
@@ -365,6 +664,7 @@ static int mknod_request(int sock, gnutls_session_t ssl, int id, MknodRequest *r
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::MKNOD_RESPONSE, &res);
@@ -375,10 +675,11 @@ static int mknod_request(int sock, gnutls_session_t ssl, int id, MknodRequest *r
 }
 
 static int link_request(int sock, gnutls_session_t ssl, int id, LinkRequest *req) {
+    Export &ex = *find_export(sock);
     LinkResponse res;
-    std::string old_path = std::filesystem::weakly_canonical(base_path + req->old_path());
-    std::string new_path = std::filesystem::weakly_canonical(base_path + req->new_path());
-    if (old_path.substr(0, base_path.size()) != base_path || new_path.substr(0, base_path.size()) != base_path) {
+    std::string old_path = std::filesystem::weakly_canonical(ex.path + req->old_path());
+    std::string new_path = std::filesystem::weakly_canonical(ex.path + req->new_path());
+    if (!ex.contains(old_path) || !ex.contains(new_path)) {
         res.set_error(EACCES);
     } else {
         int err = link(old_path.c_str(), new_path.c_str());
@@ -386,6 +687,8 @@ static int link_request(int sock, gnutls_session_t ssl, int id, LinkRequest *req
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->old_path());
+            index_refresh(ex, req->new_path());
         }
     }
     int err = send_message(sock, ssl, id, Type::LINK_RESPONSE, &res);
@@ -396,10 +699,11 @@ static int link_request(int sock, gnutls_session_t ssl, int id, LinkRequest *req
 }
 
 static int symlink_request(int sock, gnutls_session_t ssl, int id, SymlinkRequest *req) {
+    Export &ex = *find_export(sock);
     SymlinkResponse res;
-    std::string old_path = std::filesystem::weakly_canonical(base_path + req->old_path());
-    std::string new_path = std::filesystem::weakly_canonical(base_path + req->new_path());
-    if (old_path.substr(0, base_path.size()) != base_path || new_path.substr(0, base_path.size()) != base_path) {
+    std::string old_path = std::filesystem::weakly_canonical(ex.path + req->old_path());
+    std::string new_path = std::filesystem::weakly_canonical(ex.path + req->new_path());
+    if (!ex.contains(old_path) || !ex.contains(new_path)) {
         res.set_error(EXDEV);
     } else {
         int err = symlink(old_path.c_str(), new_path.c_str());
@@ -407,6 +711,7 @@ static int symlink_request(int sock, gnutls_session_t ssl, int id, SymlinkReques
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->new_path());
         }
     }
     int err = send_message(sock, ssl, id, Type::SYMLINK_RESPONSE, &res);
@@ -417,18 +722,19 @@ static int symlink_request(int sock, gnutls_session_t ssl, int id, SymlinkReques
 }
 
 static int read_link_request(int sock, gnutls_session_t ssl, int id, ReadLinkRequest *req) {
+    Export &ex = *find_export(sock);
     ReadLinkResponse res;
     char buf[100];
-    std::string path = base_path + req->path().c_str();
+    std::string path = ex.path + req->path().c_str();
     int err = readlink(path.c_str(), buf, 100);
     if (err < 0) {
         res.set_error(errno);
     } else {
         std::string link = buf;
-        if (link.substr(0, base_path.size()) != base_path) {
+        if (!ex.contains(link)) {
             res.set_error(EACCES);
         } else {
-            link = link.substr(base_path.size() + 1, err);
+            link = link.substr(ex.path.size() + 1, err);
             res.set_error(0);
             res.set_path(link);
         }
@@ -441,9 +747,10 @@ static int read_link_request(int sock, gnutls_session_t ssl, int id, ReadLinkReq
 }
 
 static int statfs_request(int sock, gnutls_session_t ssl, int id, StatfsRequest *req) {
+    Export &ex = *find_export(sock);
     StatfsResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         struct statvfs st;
@@ -471,14 +778,11 @@ static int statfs_request(int sock, gnutls_session_t ssl, int id, StatfsRequest
 }
 
 static int fsync_request(int sock, gnutls_session_t ssl, int id, FsyncRequest *req) {
+    Export &ex = *find_export(sock);
     FsyncResponse res;
-    int err = fsync(req->fd());
-    if (err < 0) {
-        res.set_error(errno);
-    } else {
-        res.set_error(0);
-    }
-    err = send_message(sock, ssl, id, Type::FSYNC_RESPONSE, &res);
+    int fd = handle_of(ex, req->fd());
+    res.set_error(fd < 0 ? EBADF : sync_scheduler().sync(fd, req->datasync()));
+    int err = send_message(sock, ssl, id, Type::FSYNC_RESPONSE, &res);
     if (err < 0) {
         return -1;
     }
@@ -486,9 +790,10 @@ static int fsync_request(int sock, gnutls_session_t ssl, int id, FsyncRequest *r
 }
 
 static int setxattr_request(int sock, gnutls_session_t ssl, int id, SetxattrRequest *req) {
+    Export &ex = *find_export(sock);
     SetxattrResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = setxattr(path.c_str(), req->name().c_str(), req->value().c_str(), req->value().size(), req->flags());
@@ -506,9 +811,10 @@ static int setxattr_request(int sock, gnutls_session_t ssl, int id, SetxattrRequ
 }
 
 static int getxattr_request(int sock, gnutls_session_t ssl, int id, GetxattrRequest *req) {
+    Export &ex = *find_export(sock);
     GetxattrResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         char buf[100];
@@ -528,9 +834,10 @@ static int getxattr_request(int sock, gnutls_session_t ssl, int id, GetxattrRequ
 }
 
 static int listxattr_request(int sock, gnutls_session_t ssl, int id, ListxattrRequest *req) {
+    Export &ex = *find_export(sock);
     ListxattrResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         char buf[300];
@@ -559,9 +866,10 @@ static int listxattr_request(int sock, gnutls_session_t ssl, int id, ListxattrRe
 }
 
 static int removexattr_request(int sock, gnutls_session_t ssl, int id, RemovexattrRequest *req) {
+    Export &ex = *find_export(sock);
     RemovexattrResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = removexattr(path.c_str(), req->name().c_str());
@@ -578,19 +886,55 @@ static int removexattr_request(int sock, gnutls_session_t ssl, int id, Removexat
     return 0;
 }
 
+static int add_dir(std::shared_ptr<dir_handle> dir) {
+    std::lock_guard<std::mutex> lock(dirs_mutex);
+    if (dir->token != 0) {
+        dir_tokens[dir->token] = dir_iter;
+    }
+    dirs[dir_iter] = std::move(dir);
+    return dir_iter++;
+}
+
+// The directory descriptor handed out for the token of an opendir request, -1 when there is none.
+static int find_dir_token(Export &ex, uint64_t token) {
+    std::lock_guard<std::mutex> lock(dirs_mutex);
+    auto it = dir_tokens.find(token);
+    if (it == dir_tokens.end()) {
+        return -1;
+    }
+    auto dir = dirs.find(it->second);
+    return dir != dirs.end() && dir->second->owner == &ex ? it->second : -1;
+}
+
 static int opendir_request(int sock, gnutls_session_t ssl, int id, OpendirRequest *req) {
+    Export &ex = *find_export(sock);
     OpendirResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    // sent again after a reconnect, the first one was handled
+    const int opened = req->token() != 0 ? find_dir_token(ex, req->token()) : -1;
+    auto dir = std::make_shared<dir_handle>();
+    dir->owner = &ex;
+    dir->fd = -1;
+    dir->path = req->path();
+    dir->token = req->token();
+    int indexed_err = opened < 0 && ex.index != nullptr ? ex.index->list(req->path(), dir->entries) : -1;
+    std::string path = indexed_err < 0 ? std::filesystem::weakly_canonical(ex.path + req->path()).string() : ex.path;
+    if (opened >= 0) {
+        res.set_error(0);
+        res.set_directory_descriptor(opened);
+    } else if (indexed_err > 0) {
+        res.set_error(indexed_err);
+    } else if (indexed_err == 0) {
+        res.set_error(0);
+        res.set_directory_descriptor(add_dir(std::move(dir)));
+    } else if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
-        DIR *dir = opendir(path.c_str());
-        if (dir == nullptr) {
+        dir->fd = open(path.c_str(), O_RDONLY | O_DIRECTORY);
+        if (dir->fd < 0) {
             res.set_error(errno);
         } else {
             res.set_error(0);
-            dirs[dir_iter] = dir;
-            res.set_directory_descriptor(dir_iter++);
+            res.set_directory_descriptor(add_dir(std::move(dir)));
         }
     }
     int err = send_message(sock, ssl, id, Type::OPENDIR_RESPONSE, &res);
@@ -601,22 +945,26 @@ static int opendir_request(int sock, gnutls_session_t ssl, int id, OpendirReques
 }
 
 static int releasedir_fs(int sock, gnutls_session_t ssl, int id, ReleasedirRequest *req) {
-    (void)req;
+    Export &ex = *find_export(sock);
     ReleasedirResponse res;
-    DIR *dir = dirs[req->directory_descriptor()];
-    int err = 0;
+    std::shared_ptr<dir_handle> dir;
+    {
+        std::lock_guard<std::mutex> lock(dirs_mutex);
+        auto it = dirs.find(req->directory_descriptor());
+        if (it != dirs.end() && it->second->owner == &ex) {
+            dir = std::move(it->second);
+            dirs.erase(it);
+            dir_tokens.erase(dir->token);
+        }
+    }
     if (dir == nullptr) {
         res.set_error(ENOENT);
-    } else {
-        dirs.erase(req->directory_descriptor());
-        err = closedir(dir);
-    }
-    if (err < 0) {
+    } else if (dir->fd >= 0 && close(dir->fd) < 0) {
         res.set_error(errno);
     } else {
         res.set_error(0);
     }
-    err = send_message(sock, ssl, id, Type::RELEASEDIR_RESPONSE, &res);
+    int err = send_message(sock, ssl, id, Type::RELEASEDIR_RESPONSE, &res);
     if (err < 0) {
         return -1;
     }
@@ -624,16 +972,20 @@ static int releasedir_fs(int sock, gnutls_session_t ssl, int id, ReleasedirReque
 }
 
 static int fsyncdir_request(int sock, gnutls_session_t ssl, int id, FsyncdirRequest *req) {
+    Export &ex = *find_export(sock);
     FsyncResponse res;
-    DIR *dir = dirs[req->directory_descriptor()];
-    int fd = dirfd(dir);
-    int err = fsync(fd);
-    if (err < 0) {
-        res.set_error(errno);
+    auto dir = find_dir(ex, req->directory_descriptor());
+    if (dir == nullptr) {
+        res.set_error(EBADF);
     } else {
-        res.set_error(0);
+        // directories listed from the metadata index are not opened
+        int fd = dir->fd >= 0 ? dir->fd : open((ex.path + dir->path).c_str(), O_RDONLY | O_DIRECTORY);
+        res.set_error(fd < 0 ? errno : sync_scheduler().sync(fd));
+        if (fd >= 0 && dir->fd < 0) {
+            close(fd);
+        }
     }
-    err = send_message(sock, ssl, id, Type::FSYNC_RESPONSE, &res);
+    int err = send_message(sock, ssl, id, Type::FSYNC_RESPONSE, &res);
     if (err < 0) {
         return -1;
     }
@@ -641,9 +993,10 @@ static int fsyncdir_request(int sock, gnutls_session_t ssl, int id, FsyncdirRequ
 }
 
 static int utimens_fs(int sock, gnutls_session_t ssl, int id, UtimensRequest *req) {
+    Export &ex = *find_export(sock);
     UtimensResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    std::string path = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         struct timespec times[2];
@@ -656,6 +1009,7 @@ static int utimens_fs(int sock, gnutls_session_t ssl, int id, UtimensRequest *re
             res.set_error(errno);
         } else {
             res.set_error(0);
+            index_refresh(ex, req->path());
         }
     }
     int err = send_message(sock, ssl, id, Type::UTIMENS_RESPONSE, &res);
@@ -666,9 +1020,13 @@ static int utimens_fs(int sock, gnutls_session_t ssl, int id, UtimensRequest *re
 }
 
 static int access_request(int sock, gnutls_session_t ssl, int id, AccessRequest *req) {
+    Export &ex = *find_export(sock);
     AccessResponse res;
-    std::string path = std::filesystem::weakly_canonical(base_path + req->path());
-    if (path.substr(0, base_path.size()) != base_path) {
+    int indexed_err = ex.index != nullptr ? ex.index->access(req->path(), req->mode()) : -1;
+    std::string path = indexed_err < 0 ? std::filesystem::weakly_canonical(ex.path + req->path()).string() : ex.path;
+    if (indexed_err >= 0) {
+        res.set_error(indexed_err);
+    } else if (!ex.contains(path)) {
         res.set_error(EACCES);
     } else {
         int err = access(path.c_str(), req->mode());
@@ -686,6 +1044,7 @@ static int access_request(int sock, gnutls_session_t ssl, int id, AccessRequest
 }
 
 static int lock_request(int sock, gnutls_session_t ssl, int id, LockRequest *req) {
+    Export &ex = *find_export(sock);
     LockResponse res;
     res.set_error(EACCES);
     struct flock lock;
@@ -693,7 +1052,7 @@ static int lock_request(int sock, gnutls_session_t ssl, int id, LockRequest *req
     lock.l_whence = req->lock().l_whence();
     lock.l_start = req->lock().l_start();
     lock.l_len = req->lock().l_len();
-    int err = fcntl(req->fd(), req->cmd(), &lock);
+    int err = fcntl(handle_of(ex, req->fd()), req->cmd(), &lock);
     if (err < 0) {
         res.set_error(errno);
     } else {
@@ -714,8 +1073,9 @@ static int lock_request(int sock, gnutls_session_t ssl, int id, LockRequest *req
 }
 
 static int flock_request(int sock, gnutls_session_t ssl, int id, FlockRequest *req) {
+    Export &ex = *find_export(sock);
     FlockResponse res;
-    int err = flock(req->fd(), req->op());
+    int err = flock(handle_of(ex, req->fd()), req->op());
     if (err < 0) {
         res.set_error(errno);
     } else {
@@ -729,12 +1089,14 @@ static int flock_request(int sock, gnutls_session_t ssl, int id, FlockRequest *r
 }
 
 static int fallocate_request(int sock, gnutls_session_t ssl, int id, FallocateRequest *req) {
+    Export &ex = *find_export(sock);
     FallocateResponse res;
-    int err = fallocate(req->fd(), req->mode(), req->offset(), req->len());
+    int err = fallocate(handle_of(ex, req->fd()), req->mode(), req->offset(), req->len());
     if (err < 0) {
         res.set_error(errno);
     } else {
         res.set_error(0);
+        index_refresh_fd(ex, req->fd());
     }
     err = send_message(sock, ssl, id, Type::FALLOCATE_RESPONSE, &res);
     if (err < 0) {
@@ -744,8 +1106,9 @@ static int fallocate_request(int sock, gnutls_session_t ssl, int id, FallocateRe
 }
 
 static int lseek_request(int sock, gnutls_session_t ssl, int id, LseekRequest *req) {
+    Export &ex = *find_export(sock);
     LseekResponse res;
-    off_t off = lseek(req->fd(), req->offset(), req->whence());
+    off_t off = lseek(handle_of(ex, req->fd()), req->offset(), req->whence());
     if (off < 0) {
         res.set_error(errno);
     } else {
@@ -759,6 +1122,60 @@ static int lseek_request(int sock, gnutls_session_t ssl, int id, LseekRequest *r
     return 0;
 }
 
+// Falls back to copying through a buffer when the kernel can not copy between the files.
+static ssize_t copy_range(int fd_in, off_t offset_in, int fd_out, off_t offset_out, size_t size, int flags) {
+    size_t copied = 0;
+    bool fallback = false;
+    std::unique_ptr<char[]> buf;
+    const size_t buf_size = 1 << 20;
+    while (copied < size) {
+        ssize_t len = -1;
+        if (!fallback) {
+            off64_t in = offset_in + copied;
+            off64_t out = offset_out + copied;
+            // uses reflinks when both files are on a file system which supports them
+            len = copy_file_range(fd_in, &in, fd_out, &out, size - copied, flags);
+            if (len < 0 && (errno == EXDEV || errno == ENOSYS || errno == EOPNOTSUPP) && flags == 0) {
+                fallback = true;
+                buf = std::make_unique<char[]>(buf_size);
+                continue;
+            }
+        } else {
+            len = pread(fd_in, buf.get(), std::min(size - copied, buf_size), offset_in + copied);
+            if (len > 0) {
+                len = pwrite(fd_out, buf.get(), len, offset_out + copied);
+            }
+        }
+        if (len < 0) {
+            return copied > 0 ? static_cast<ssize_t>(copied) : -1;
+        }
+        if (len == 0) {
+            break;
+        }
+        copied += len;
+    }
+    return copied;
+}
+
+static int copy_file_range_request(int sock, gnutls_session_t ssl, int id, CopyFileRangeRequest *req) {
+    Export &ex = *find_export(sock);
+    CopyFileRangeResponse res;
+    ssize_t copied = copy_range(handle_of(ex, req->fd_in()), req->offset_in(), handle_of(ex, req->fd_out()), req->offset_out(), req->size(), req->flags());
+    if (copied < 0) {
+        res.set_error(errno);
+    } else {
+        res.set_error(0);
+        res.set_size(copied);
+        file_cache.invalidate(req->fd_out());
+        index_refresh_fd(ex, req->fd_out());
+    }
+    int err = send_message(sock, ssl, id, Type::COPY_FILE_RANGE_RESPONSE, &res);
+    if (err < 0) {
+        return -1;
+    }
+    return 0;
+}
+
 template <typename T> int respons_handler(int sock, gnutls_session_t ssl, int id, T message) {
     (void)sock;
     (void)ssl;
@@ -767,8 +1184,14 @@ template <typename T> int respons_handler(int sock, gnutls_session_t ssl, int id
     return 0;
 }
 
-recv_handlers get_handlers(std::string path) {
-    base_path = std::filesystem::weakly_canonical(path);
+void enable_metadata_index(int threads) {
+    for (Export *ex : all_exports()) {
+        ex->index = std::make_unique<MetadataIndex>(ex->path);
+        ex->index->start(threads);
+    }
+}
+
+recv_handlers get_handlers() {
     return recv_handlers{
         .init_request = init_request,
         .init_response = respons_handler<InitResponse *>,
@@ -838,5 +1261,19 @@ recv_handlers get_handlers(std::string path) {
         .lseek_response = respons_handler<LseekResponse *>,
         .lsp_request = handle_lsp_request,
         .lsp_response = respons_handler<LspResponse *>,
+        .copy_file_range_request = copy_file_range_request,
+        .copy_file_range_response = respons_handler<CopyFileRangeResponse *>,
+        .search_request = handle_search_request,
+        .search_response = respons_handler<SearchResponse *>,
+        .search_cancel_request = handle_search_cancel_request,
+        .search_cancel_response = respons_handler<SearchCancelResponse *>,
+        .batch_stat_request = batch_stat_request,
+        .batch_stat_response = respons_handler<BatchStatResponse *>,
+        .save_request = save_request,
+        .save_response = respons_handler<SaveResponse *>,
+        .exec_request = handle_exec_request,
+        .exec_response = respons_handler<ExecResponse *>,
+        .exec_cancel_request = handle_exec_cancel_request,
+        .exec_cancel_response = respons_handler<ExecCancelResponse *>,
     };
 }
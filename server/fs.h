@@ -1,4 +1,5 @@
 #pragma once
 #include "../common/io.h"
 
-recv_handlers get_handlers(std::string base_path);
+recv_handlers get_handlers();
+void enable_metadata_index(int threads);
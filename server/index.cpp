@@ -0,0 +1,482 @@
+#include "index.h"
+
+#include "../common/log.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+static const uint32_t watch_mask =
+    IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_DELETE_SELF | IN_ONLYDIR | IN_DONT_FOLLOW;
+static const uint32_t children_mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+MetadataIndex::MetadataIndex(std::string directory) : root(std::move(directory)) {}
+
+MetadataIndex::~MetadataIndex() {
+    if (stop_fd >= 0) {
+        uint64_t one = 1;
+        if (write(stop_fd, &one, sizeof(one)) < 0) {
+            log(DEBUG, "Failed to stop the metadata index watcher: %s", strerror(errno));
+        }
+    }
+    // the watcher starts the builder again after an overflow, it is stopped first
+    if (watcher.joinable()) {
+        watcher.join();
+    }
+    if (builder.joinable()) {
+        builder.join();
+    }
+    if (inotify_fd >= 0) {
+        close(inotify_fd);
+    }
+    if (stop_fd >= 0) {
+        close(stop_fd);
+    }
+}
+
+void MetadataIndex::start(int threads) {
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    stop_fd = eventfd(0, EFD_CLOEXEC);
+    if (inotify_fd < 0 || stop_fd < 0) {
+        log(WARN, "Metadata index disabled: %s", strerror(errno));
+        return;
+    }
+    walk_threads = std::max(threads, 1);
+    watcher = std::thread(&MetadataIndex::watch, this);
+    builder = std::thread(&MetadataIndex::build, this, walk_threads);
+}
+
+MetadataIndex::meta MetadataIndex::to_meta(const struct stat &st) {
+    return meta{
+        .mode = st.st_mode,
+        .nlink = st.st_nlink,
+        .uid = st.st_uid,
+        .gid = st.st_gid,
+        .size = st.st_size,
+        .atime = st.st_atime,
+        .mtime = st.st_mtime,
+        .ctime = st.st_ctime,
+    };
+}
+
+// Splits the client path into components, relative components are left to the syscall path.
+bool MetadataIndex::split(const std::string &path, std::vector<std::string> &components) {
+    size_t start = 0;
+    while (start < path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        if (end > start) {
+            std::string component = path.substr(start, end - start);
+            if (component == "." || component == "..") {
+                return false;
+            }
+            components.push_back(std::move(component));
+        }
+        start = end + 1;
+    }
+    return true;
+}
+
+// Caller must hold tree_mutex.
+MetadataIndex::node *MetadataIndex::locate(const std::vector<std::string> &components, size_t depth) {
+    node *n = tree.get();
+    for (size_t i = 0; i < depth && n != nullptr; i++) {
+        auto child = n->children.find(components[i]);
+        n = child == n->children.end() ? nullptr : child->second.get();
+    }
+    return n;
+}
+
+// Caller must hold tree_mutex.
+int MetadataIndex::find(const std::string &path, const node **found) {
+    std::vector<std::string> components;
+    if (tree == nullptr || !split(path, components)) {
+        return -1;
+    }
+    const node *n = tree.get();
+    for (const auto &component : components) {
+        if (S_ISLNK(n->st.mode)) {
+            // symlinks in the middle of the path are resolved by the kernel
+            return -1;
+        }
+        if (!S_ISDIR(n->st.mode)) {
+            return ENOTDIR;
+        }
+        auto child = n->children.find(component);
+        if (child == n->children.end()) {
+            return ENOENT;
+        }
+        n = child->second.get();
+    }
+    *found = n;
+    return 0;
+}
+
+int MetadataIndex::stat(const std::string &path, struct stat *st) {
+    if (!ready()) {
+        return -1;
+    }
+    std::shared_lock<std::shared_mutex> lock(tree_mutex);
+    const node *n = nullptr;
+    int err = find(path, &n);
+    if (err != 0) {
+        return err;
+    }
+    memset(st, 0, sizeof(struct stat));
+    st->st_mode = n->st.mode;
+    st->st_nlink = n->st.nlink;
+    st->st_uid = n->st.uid;
+    st->st_gid = n->st.gid;
+    st->st_size = n->st.size;
+    st->st_atime = n->st.atime;
+    st->st_mtime = n->st.mtime;
+    st->st_ctime = n->st.ctime;
+    return 0;
+}
+
+static bool in_group(gid_t gid) {
+    static const std::vector<gid_t> groups = [] {
+        std::vector<gid_t> list;
+        int n = getgroups(0, nullptr);
+        if (n > 0) {
+            list.resize(n);
+            n = getgroups(n, list.data());
+            list.resize(std::max(n, 0));
+        }
+        list.push_back(getgid());
+        return list;
+    }();
+    return std::find(groups.begin(), groups.end(), gid) != groups.end();
+}
+
+// Only the permission bits are checked, the same way access(2) does it for the real user.
+int MetadataIndex::access(const std::string &path, int mode) {
+    struct stat st;
+    int err = stat(path, &st);
+    if (err != 0) {
+        return err;
+    }
+    if (S_ISLNK(st.st_mode)) {
+        // access(2) checks the target of the link, the index only has the link itself
+        return -1;
+    }
+    if (mode == F_OK) {
+        return 0;
+    }
+    uid_t uid = getuid();
+    if (uid == 0) {
+        if ((mode & X_OK) && !S_ISDIR(st.st_mode) && (st.st_mode & (S_IXUSR | S_IXGRP | S_IXOTH)) == 0) {
+            return EACCES;
+        }
+        return 0;
+    }
+    int shift = st.st_uid == uid ? 6 : in_group(st.st_gid) ? 3 : 0;
+    int granted = (st.st_mode >> shift) & 7;
+    return (mode & granted) == mode ? 0 : EACCES;
+}
+
+int MetadataIndex::list(const std::string &path, std::vector<index_entry> &entries) {
+    if (!ready()) {
+        return -1;
+    }
+    std::shared_lock<std::shared_mutex> lock(tree_mutex);
+    const node *n = nullptr;
+    int err = find(path, &n);
+    if (err != 0) {
+        return err;
+    }
+    if (!S_ISDIR(n->st.mode)) {
+        return ENOTDIR;
+    }
+    entries.reserve(n->children.size() + 2);
+    entries.push_back(index_entry{.name = ".", .type = DT_DIR});
+    entries.push_back(index_entry{.name = "..", .type = DT_DIR});
+    for (const auto &[name, child] : n->children) {
+        entries.push_back(index_entry{.name = name, .type = static_cast<unsigned char>(IFTODT(child->st.mode))});
+    }
+    return 0;
+}
+
+void MetadataIndex::refresh(const std::string &path) {
+    if (!ready()) {
+        // the changes are picked up from inotify once the walk is done
+        return;
+    }
+    update(path);
+    size_t parent = path.find_last_of('/');
+    if (parent != std::string::npos) {
+        update(path.substr(0, parent));
+    }
+}
+
+void MetadataIndex::update(const std::string &path) {
+    std::vector<std::string> components;
+    if (!split(path, components)) {
+        return;
+    }
+    struct stat st;
+    int err = lstat((root + path).c_str(), &st);
+    bool new_dir = false;
+    {
+        std::unique_lock<std::shared_mutex> lock(tree_mutex);
+        if (tree == nullptr) {
+            return;
+        }
+        if (components.empty()) {
+            if (err == 0) {
+                tree->st = to_meta(st);
+            }
+            return;
+        }
+        node *parent = locate(components, components.size() - 1);
+        if (parent == nullptr || !S_ISDIR(parent->st.mode)) {
+            return;
+        }
+        if (err < 0) {
+            parent->children.erase(components.back());
+        } else {
+            auto &child = parent->children[components.back()];
+            if (child == nullptr) {
+                child = std::make_unique<node>();
+                child->st.mode = 0;
+            }
+            new_dir = S_ISDIR(st.st_mode) && !S_ISDIR(child->st.mode);
+            if (!S_ISDIR(st.st_mode)) {
+                child->children.clear();
+            }
+            child->st = to_meta(st);
+        }
+    }
+    if (err < 0) {
+        unwatch(path);
+    }
+    if (new_dir) {
+        walk(path, 1);
+    }
+}
+
+void MetadataIndex::unwatch(const std::string &path) {
+    std::lock_guard<std::mutex> lock(watch_mutex);
+    for (auto it = watches.begin(); it != watches.end();) {
+        if (it->second == path || it->second.starts_with(path + "/")) {
+            inotify_rm_watch(inotify_fd, it->first);
+            it = watches.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+// Lists one directory into the tree, subdirs receives the directories to scan next.
+bool MetadataIndex::scan(const std::string &path, std::vector<std::string> &subdirs) {
+    std::string full_path = root + path;
+    // the watch is added first so that no change made after the listing is missed
+    int wd = inotify_add_watch(inotify_fd, full_path.c_str(), watch_mask);
+    if (wd < 0) {
+        if (errno == ENOENT || errno == ENOTDIR) {
+            return true;
+        }
+        log(WARN, "Metadata index disabled, unable to watch %s: %s", full_path.c_str(), strerror(errno));
+        failed = true;
+        is_ready = false;
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(watch_mutex);
+        watches[wd] = path;
+    }
+
+    DIR *dir = opendir(full_path.c_str());
+    if (dir == nullptr) {
+        return true;
+    }
+    std::map<std::string, std::unique_ptr<node>> children;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        struct stat st;
+        if (fstatat(dirfd(dir), entry->d_name, &st, AT_SYMLINK_NOFOLLOW) < 0) {
+            continue;
+        }
+        auto child = std::make_unique<node>();
+        child->st = to_meta(st);
+        if (S_ISDIR(st.st_mode)) {
+            subdirs.push_back(path + "/" + entry->d_name);
+        }
+        children.emplace(entry->d_name, std::move(child));
+    }
+    closedir(dir);
+    entries_count += children.size();
+
+    std::vector<std::string> components;
+    split(path, components);
+    std::unique_lock<std::shared_mutex> lock(tree_mutex);
+    node *n = locate(components, components.size());
+    if (n != nullptr) {
+        n->children = std::move(children);
+    }
+    return true;
+}
+
+// Parallel breadth first walk of the subtree at path.
+void MetadataIndex::walk(const std::string &path, int threads) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::string> queue = {path};
+    int active = 0;
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [&] { return !queue.empty() || active == 0; });
+            if (queue.empty() || failed) {
+                return;
+            }
+            std::string dir = std::move(queue.front());
+            queue.pop_front();
+            active++;
+            lock.unlock();
+            std::vector<std::string> subdirs;
+            scan(dir, subdirs);
+            lock.lock();
+            active--;
+            for (auto &subdir : subdirs) {
+                queue.push_back(std::move(subdir));
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threads; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &w : workers) {
+        w.join();
+    }
+}
+
+void MetadataIndex::build(int threads) {
+    auto start = std::chrono::steady_clock::now();
+    struct stat st;
+    if (lstat(root.c_str(), &st) < 0) {
+        log(WARN, "Metadata index disabled: %s", strerror(errno));
+        return;
+    }
+    {
+        std::unique_lock<std::shared_mutex> lock(tree_mutex);
+        tree = std::make_unique<node>();
+        tree->st = to_meta(st);
+    }
+    entries_count = 0;
+    walk("", threads);
+
+    // apply the changes which happened during the walk until none are left
+    std::unique_lock<std::mutex> lock(watch_mutex);
+    while (!pending.empty() && !failed) {
+        std::set<std::string> changed;
+        changed.swap(pending);
+        lock.unlock();
+        for (const auto &path : changed) {
+            update(path);
+        }
+        lock.lock();
+    }
+    if (failed) {
+        return;
+    }
+    is_ready = true;
+    lock.unlock();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    log(INFO, "Metadata index of %s is ready: %ld entries in %ld ms", root.c_str(), entries_count.load(), elapsed.count());
+}
+
+void MetadataIndex::handle_event(int wd, const std::string &name, uint32_t mask) {
+    std::string dir;
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(watch_mutex);
+        auto it = watches.find(wd);
+        if (it == watches.end()) {
+            return;
+        }
+        dir = it->second;
+        if (mask & IN_IGNORED) {
+            watches.erase(it);
+            return;
+        }
+        path = name.empty() ? dir : dir + "/" + name;
+        if (!ready()) {
+            pending.insert(path);
+            pending.insert(dir);
+            return;
+        }
+    }
+    update(path);
+    if (!name.empty() && (mask & children_mask)) {
+        update(dir);
+    }
+}
+
+void MetadataIndex::watch() {
+    alignas(struct inotify_event) char buffer[1 << 16];
+    pollfd fds[2] = {{.fd = inotify_fd, .events = POLLIN, .revents = 0}, {.fd = stop_fd, .events = POLLIN, .revents = 0}};
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            log(ERROR, "Metadata index watcher failed: %s", strerror(errno));
+            failed = true;
+            is_ready = false;
+            return;
+        }
+        if (fds[1].revents & POLLIN) {
+            return;
+        }
+        ssize_t len = read(inotify_fd, buffer, sizeof(buffer));
+        if (len <= 0) {
+            continue;
+        }
+        bool overflow = false;
+        for (char *ptr = buffer; ptr < buffer + len;) {
+            auto *event = reinterpret_cast<struct inotify_event *>(ptr);
+            if (event->mask & IN_Q_OVERFLOW) {
+                overflow = true;
+            } else if (!overflow) {
+                handle_event(event->wd, event->len > 0 ? event->name : "", event->mask);
+            }
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+        if (overflow && !failed) {
+            // events were lost, the whole tree has to be read again
+            log(WARN, "Metadata index event queue overflowed, rebuilding");
+            is_ready = false;
+            if (builder.joinable()) {
+                builder.join();
+            }
+            {
+                std::lock_guard<std::mutex> lock(watch_mutex);
+                for (const auto &[wd, path] : watches) {
+                    inotify_rm_watch(inotify_fd, wd);
+                }
+                watches.clear();
+                pending.clear();
+            }
+            builder = std::thread(&MetadataIndex::build, this, walk_threads);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+
+struct index_entry {
+    std::string name;
+    unsigned char type;
+};
+
+// In-memory copy of the metadata of the exported directory shared by all clients.
+// It is built by a parallel walk in the background and kept up to date with inotify.
+// Lookups return -1 whenever the index can not answer, the caller then falls back
+// to the syscall. Access times are not tracked (IN_ACCESS is not watched).
+class MetadataIndex {
+  public:
+    explicit MetadataIndex(std::string directory);
+    ~MetadataIndex();
+
+    void start(int threads);
+    bool ready() const { return is_ready.load(std::memory_order_acquire); }
+
+    // 0 or errno like lstat, -1 if the index can not answer
+    int stat(const std::string &path, struct stat *st);
+    // 0 or errno like access, -1 if the index can not answer (also for symlinks)
+    int access(const std::string &path, int mode);
+    // 0 or errno like opendir, -1 if the index can not answer
+    int list(const std::string &path, std::vector<index_entry> &entries);
+    // Re-reads the metadata of path, used after changes made by the server itself.
+    void refresh(const std::string &path);
+
+  private:
+    struct meta {
+        mode_t mode;
+        nlink_t nlink;
+        uid_t uid;
+        gid_t gid;
+        off_t size;
+        time_t atime;
+        time_t mtime;
+        time_t ctime;
+    };
+
+    struct node {
+        meta st;
+        std::map<std::string, std::unique_ptr<node>> children;
+    };
+
+    static meta to_meta(const struct stat &st);
+    static bool split(const std::string &path, std::vector<std::string> &components);
+    node *locate(const std::vector<std::string> &components, size_t depth);
+    int find(const std::string &path, const node **found);
+    void update(const std::string &path);
+    bool scan(const std::string &path, std::vector<std::string> &subdirs);
+    void walk(const std::string &path, int threads);
+    void build(int threads);
+    void watch();
+    void handle_event(int wd, const std::string &name, uint32_t mask);
+    void unwatch(const std::string &path);
+
+    std::string root;
+    std::shared_mutex tree_mutex;
+    std::unique_ptr<node> tree;
+    std::atomic<bool> is_ready = false;
+    std::atomic<bool> failed = false;
+    std::atomic<long> entries_count = 0;
+
+    int inotify_fd = -1;
+    int stop_fd = -1;
+    std::mutex watch_mutex;
+    std::map<int, std::string> watches;
+    // paths changed while the index was being built, re-read once the walk is done
+    std::set<std::string> pending;
+    int walk_threads = 1;
+    std::thread builder;
+    std::thread watcher;
+};
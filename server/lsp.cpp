@@ -1,8 +1,11 @@
+#include <algorithm>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
 #include <poll.h>
 #include <pwd.h>
+#include <strings.h>
+#include <sys/eventfd.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -10,21 +13,42 @@
 #include "lsp.h"
 
 #include "../common/io.h"
+#include "../common/json.h"
 #include "../common/log.h"
 #include "../proto/messages.pb.h"
+#include "export.h"
+#include "metrics.h"
 #include "google/protobuf/util/json_util.h"
 
 #include <fstream>
-#include <iomanip>
-#include <regex>
-
-static std::regex method_regex(R"("method":\s?"initialize")", std::regex_constants::ECMAScript | std::regex_constants::icase);
-static std::regex base_path_regex(R"(rootPath":\s*"([^"]+))", std::regex_constants::ECMAScript | std::regex_constants::icase);
-
-static std::optional<std::string> base_path = std::nullopt;
-static std::string server_path = {};
-
-LspProcess::LspProcess(const std::string &language) {
+#include <set>
+
+static std::map<std::string, std::string> available_lsps = {};
+static std::vector<std::string> prespawned;
+static std::chrono::seconds idle_timeout{0};
+static size_t memory_limit = 0;
+// the messages queued for one language server
+static const size_t max_queued_bytes = 16 << 20;
+// the edits of a document replayed to a restarted server
+static const size_t max_document_history = 8 << 20;
+// the requests whose answers only depend on the document and its version
+static const std::set<std::string, std::less<>> cacheable_methods = {
+    "textDocument/hover",
+    "textDocument/documentSymbol",
+    "textDocument/semanticTokens/full",
+    "textDocument/foldingRange",
+};
+static const size_t max_cached_bytes = 32 << 20;
+static const size_t max_pending = 1024;
+// the diagnostics of a document are sent after this delay, the later ones replace them
+static const auto diagnostics_delay = std::chrono::milliseconds(50);
+// a crashed server is restarted at most this often
+static const auto restart_delay = std::chrono::seconds(10);
+// a server over the memory limit again after a restart waits twice as long each time, up to this
+static const auto max_memory_backoff = std::chrono::minutes(10);
+static const auto maintenance_interval = std::chrono::seconds(1);
+
+LspProcess::LspProcess(const std::string &language_name, std::string project_path) : language(language_name), server_path(std::move(project_path)) {
     if (available_lsps.find(language) == available_lsps.end()) {
         throw std::runtime_error("Language not supported");
     }
@@ -32,7 +56,8 @@ LspProcess::LspProcess(const std::string &language) {
     int parent_to_child[2];
     int child_to_parent[2];
 
-    if (pipe(parent_to_child) == -1 || pipe(child_to_parent) == -1) {
+    // not inherited by the other language servers, the reader would miss the end of this one
+    if (pipe2(parent_to_child, O_CLOEXEC) == -1 || pipe2(child_to_parent, O_CLOEXEC) == -1) {
         throw std::runtime_error("Failed to create pipe");
     }
 
@@ -43,15 +68,9 @@ LspProcess::LspProcess(const std::string &language) {
     }
 
     if (pid == 0) {
-        close(parent_to_child[1]);
-        close(child_to_parent[0]);
-
         dup2(parent_to_child[0], STDIN_FILENO);
         dup2(child_to_parent[1], STDOUT_FILENO);
 
-        close(parent_to_child[0]);
-        close(child_to_parent[1]);
-
         execl("/bin/sh", "sh", "-c", available_lsps[language].c_str(), nullptr);
         exit(1);
     }
@@ -61,29 +80,45 @@ LspProcess::LspProcess(const std::string &language) {
 
     write_fd = parent_to_child[1];
     read_fd = child_to_parent[0];
-    fcntl(read_fd, F_SETFL, fcntl(read_fd, F_GETFL) | O_NONBLOCK);
+    stop_fd = eventfd(0, EFD_CLOEXEC);
+    active_at = std::chrono::steady_clock::now().time_since_epoch().count();
+    reader = std::thread(&LspProcess::read_messages, this);
+    writer = std::thread(&LspProcess::write_messages, this);
 }
 
 LspProcess::~LspProcess() {
-    close(write_fd);
-    close(read_fd);
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_cv.notify_all();
+    // a writer blocked on a server which does not read gets EPIPE once it is gone
     kill(pid, SIGTERM);
+    writer.join();
+    close(write_fd);
     waitpid(pid, nullptr, 0);
+    // the children of the language server may still hold its output open
+    uint64_t one = 1;
+    if (::write(stop_fd, &one, sizeof(one)) < 0) {
+        log(ERROR, "Failed to stop the LSP reader: %s", strerror(errno));
+    }
+    reader.join();
+    close(stop_fd);
+    close(read_fd);
 }
 
-static bool is_initialization(const std::string &data) { return std::regex_search(data, method_regex); }
+static bool is_initialization(const std::string &data) {
+    const auto method = json_string(data, "method");
+    return method.has_value() && strncasecmp(method->data(), "initialize", method->size()) == 0 && method->size() == strlen("initialize");
+}
 
-static std::optional<std::string> extract_base_path(const std::string &data) {
+static std::optional<std::string> extract_base_path(const std::string &data, const std::string &server_path) {
     if (!is_initialization(data)) {
         return std::nullopt;
     }
 
-    if (base_path.has_value()) {
-        log(WARN, "Duplicate initialization message received");
-    }
-
-    if (std::smatch match; std::regex_search(data, match, base_path_regex)) {
-        auto extracted_base_path = match[1].str();
+    if (const auto root_path = json_string(data, "rootPath"); root_path.has_value() && !root_path->empty()) {
+        auto extracted_base_path = std::string(*root_path);
         log(DEBUG, "Base path is %s", extracted_base_path.c_str());
         log(INFO, "Paths will be translated %s <=> %s", server_path.c_str(), extracted_base_path.c_str());
 
@@ -94,127 +129,695 @@ static std::optional<std::string> extract_base_path(const std::string &data) {
     return std::nullopt;
 }
 
-static std::string urlEncode(const std::string &str) {
-    std::ostringstream encodedStream;
-    encodedStream << std::hex << std::uppercase << std::setfill('0');
+void LspProcess::send(int client_sock, gnutls_session_t client_ssl, int client_id, std::string data, const std::string &path) {
+    std::string key;
+    if (answer_from_cache(client_sock, client_ssl, client_id, data, path, key)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    queued_bytes += data.size();
+    active_at = std::chrono::steady_clock::now().time_since_epoch().count();
+    queue.push_back(
+        outgoing{.sock = client_sock, .ssl = client_ssl, .id = client_id, .data = std::move(data), .client_path = path, .cache_key = std::move(key)});
+    queue_cv.notify_all();
+}
 
-    for (const char c : str) {
-        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~' || c == '/') {
-            encodedStream << c;
-        } else {
-            encodedStream << '%' << std::setw(2) << static_cast<unsigned int>(static_cast<unsigned char>(c));
-        }
+void LspProcess::wait_for_room() {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    queue_cv.wait(lock, [this] { return stopping || queued_bytes < max_queued_bytes; });
+}
+
+void LspProcess::replay(std::vector<std::string> messages) {
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    for (auto &data : messages) {
+        // only tracks the versions of the documents, nothing replayed is answered from the cache
+        std::string key;
+        answer_from_cache(-1, nullptr, 0, data, server_path, key);
+        queued_bytes += data.size();
+        queue.push_back(outgoing{.sock = -1, .ssl = nullptr, .id = 0, .data = std::move(data), .client_path = server_path, .cache_key = {}, .replayed = true});
     }
+    queue_cv.notify_all();
+}
 
-    return encodedStream.str();
+void LspProcess::adopt_clients(LspProcess &old) {
+    std::scoped_lock lock(client_mutex, old.client_mutex);
+    clients = old.clients;
+    last_client = old.last_client;
 }
 
-static std::string patch_paths(const std::string &data, const std::string &replace_this, const std::string &with_this) {
-    auto patched_data = data;
+void LspProcess::forget_responses(const std::string &uri) {
+    const auto prefix = uri + '\0';
+    auto it = responses.lower_bound(prefix);
+    while (it != responses.end() && it->first.starts_with(prefix)) {
+        cached_bytes -= it->second.size();
+        it = responses.erase(it);
+    }
+    // a hover shows the declarations of the other documents too
+    std::erase_if(responses, [this](const auto &entry) {
+        const bool hover = entry.first.find(std::string_view("\0textDocument/hover\0", 20)) != std::string::npos;
+        cached_bytes -= hover ? entry.second.size() : 0;
+        return hover;
+    });
+}
 
-    std::string::size_type start_pos = 0;
-    while ((start_pos = patched_data.find(replace_this, start_pos)) != std::string::npos) {
-        patched_data.replace(start_pos, replace_this.length(), with_this);
-        start_pos += with_this.length() + 1;
+bool LspProcess::answer_from_cache(int client_sock, gnutls_session_t client_ssl, int client_id, const std::string &data, const std::string &path,
+                                   std::string &key) {
+    const auto method = json_string_at(data, {"method"});
+    const auto uri = json_string_at(data, {"params", "textDocument", "uri"});
+    if (!method.has_value() || !uri.has_value()) {
+        return false;
+    }
+    // the mounts have the project in different places, the answers are kept in the paths of the server
+    PathRewriter in_server(path, server_path);
+    const std::string document(in_server.rewrite(*uri));
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (*method == "textDocument/didOpen" || *method == "textDocument/didChange") {
+        const auto version = json_at(data, {"params", "textDocument", "version"});
+        versions[document] = version.has_value() ? strtoll(std::string(*version).c_str(), nullptr, 10) : -1;
+        forget_responses(document);
+        return false;
+    }
+    if (*method == "textDocument/didClose" || *method == "textDocument/didSave") {
+        if (*method == "textDocument/didClose") {
+            versions.erase(document);
+        }
+        forget_responses(document);
+        return false;
+    }
+    const auto version = versions.find(document);
+    const auto request_id = json_at(data, {"id"});
+    if (!cacheable_methods.contains(*method) || version == versions.end() || !request_id.has_value()) {
+        return false;
     }
+    const auto params = in_server.rewrite(json_at(data, {"params"}).value_or(""));
+    key = document + '\0' + std::to_string(version->second) + '\0' + std::string(*method) + '\0' + std::to_string(std::hash<std::string_view>{}(params));
+    const auto cached = responses.find(key);
+    if (cached == responses.end()) {
+        counter("lsp_cache_misses").fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    counter("lsp_cache_hits").fetch_add(1, std::memory_order_relaxed);
+    LspResponse res;
+    const std::string result(PathRewriter(server_path, path).rewrite(cached->second));
+    res.set_payload(R"({"jsonrpc":"2.0","id":)" + std::string(*request_id) + R"(,"result":)" + result + "}");
+    res.set_language(language);
+    if (send_message(client_sock, client_ssl, client_id, Type::LSP_RESPONSE, &res) < 0) {
+        log(DEBUG, client_sock, "Failed to send a cached response of the LSP for %s", language.c_str());
+    }
+    return true;
+}
 
-    return patched_data;
+// Called with the answers in the paths of the server, they are translated for each client asking.
+void LspProcess::cache_response(const std::string &key, std::string_view message) {
+    if (key.empty()) {
+        return;
+    }
+    const auto result = json_at(message, {"result"});
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    // the document may have changed while the server was busy with the request
+    const auto document = key.substr(0, key.find('\0'));
+    const auto version = versions.find(document);
+    if (!result.has_value() || version == versions.end() || !key.starts_with(document + '\0' + std::to_string(version->second) + '\0')) {
+        return;
+    }
+    if (cached_bytes + result->size() > max_cached_bytes) {
+        responses.clear();
+        cached_bytes = 0;
+    }
+    auto &cached = responses[key];
+    cached_bytes += result->size() - cached.size();
+    cached = std::string(*result);
 }
 
-void LspProcess::write(const std::string &data) const {
-    assert(base_path.has_value());
+void LspProcess::write_messages() {
+    // the server may exit at any time, the write fails with EPIPE instead of killing the process
+    sigset_t pipe_signal;
+    sigemptyset(&pipe_signal);
+    sigaddset(&pipe_signal, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe_signal, nullptr);
+
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    while (true) {
+        queue_cv.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (stopping) {
+            return;
+        }
+        outgoing message = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+        write(message);
+        lock.lock();
+        queued_bytes -= message.data.size();
+        queue_cv.notify_all();
+    }
+}
 
-    const auto url_base_path = urlEncode(::base_path.value());
-    const auto url_server_path = urlEncode(::server_path);
-    auto patched_data = patch_paths(data, ::base_path.value(), ::server_path);
-    patched_data = patch_paths(patched_data, url_base_path, url_server_path);
+void LspProcess::write(const outgoing &message) {
+    const int client_sock = message.sock;
+    const auto &path = message.client_path;
+    if (to_server.from() != path) {
+        to_server = PathRewriter(path, server_path);
+    }
+    std::string data(to_server.rewrite(message.data));
+    {
+        std::lock_guard<std::mutex> lock(client_mutex);
+        if (!forward(message, data)) {
+            return;
+        }
+    }
+    const auto header = "Content-Length: " + std::to_string(data.size()) + "\r\n\r\n";
+    if (write_all(client_sock, header.data(), header.size()) && write_all(client_sock, data.data(), data.size())) {
+        log(DEBUG, client_sock, "Wrote %zu bytes to LSP", header.size() + data.size());
+    }
+}
 
-    char buffer[50];
-    std::sprintf(buffer, "Content-Length: %zu\r\n\r\n", patched_data.size());
-    ::write(write_fd, buffer, std::strlen(buffer));
+static void replace_value(std::string &payload, std::string_view value, const std::string &with) {
+    payload.replace(value.data() - payload.data(), value.size(), with);
+}
 
-    const auto n = ::write(write_fd, patched_data.c_str(), patched_data.size());
-    log(DEBUG, "Wrote %d bytes to LSP", n);
+bool LspProcess::forward(const outgoing &message, std::string &data) {
+    const auto connection = message.replayed ? nullptr : hold_connection(message.sock, message.ssl);
+    if (connection != nullptr) {
+        // a connection which is gone does not keep its address, a new one may have it
+        std::erase_if(clients, [](const auto &entry) { return entry.second.connection.expired(); });
+        auto &from = clients[connection.get()];
+        from.sock = message.sock;
+        from.ssl = message.ssl;
+        from.id = message.id;
+        from.connection = connection;
+        if (from.to_client.to() != message.client_path) {
+            from.to_client = PathRewriter(server_path, message.client_path);
+        }
+        last_client = connection.get();
+    }
+    const auto method = json_string_at(data, {"method"});
+    const auto json_id = json_at(data, {"id"});
+    if (!method.has_value()) {
+        // the answer of the client to a request of the server keeps its id
+        return true;
+    }
+    if (json_id.has_value()) {
+        const auto request_id = next_request_id++;
+        if (connection != nullptr) {
+            if (forwarded.size() >= max_pending) {
+                std::erase_if(forwarded, [](const auto &request) { return request.second.connection.expired(); });
+            }
+            // the server never answered them
+            while (forwarded.size() >= max_pending) {
+                forwarded.erase(forwarded.begin());
+            }
+            forwarded[request_id] =
+                forwarded_request{.connection = connection, .id = message.id, .json_id = std::string(*json_id), .cache_key = message.cache_key};
+        }
+        replace_value(data, *json_id, std::to_string(request_id));
+        return true;
+    }
+    const auto uri = json_string_at(data, {"params", "textDocument", "uri"});
+    if (connection != nullptr && uri.has_value() && (*method == "textDocument/didOpen" || *method == "textDocument/didClose")) {
+        auto &documents = clients[connection.get()].documents;
+        if (*method == "textDocument/didOpen") {
+            documents.emplace(*uri);
+        } else {
+            documents.erase(std::string(*uri));
+        }
+    }
+    if (const auto cancelled = json_at(data, {"params", "id"}); *method == "$/cancelRequest" && cancelled.has_value()) {
+        // the id in the params is the one of the client
+        const auto it = std::find_if(forwarded.begin(), forwarded.end(), [&](const auto &request) {
+            return request.second.json_id == *cancelled && request.second.connection.lock() == connection;
+        });
+        if (it == forwarded.end()) {
+            return false;
+        }
+        replace_value(data, *cancelled, std::to_string(it->first));
+    }
+    return true;
 }
 
-std::optional<std::string> LspProcess::read() const {
-    std::array<char, 1024> buffer{};
-    std::string result;
+bool LspProcess::write_all(int client_sock, const char *data, size_t size) {
+    for (size_t written = 0; written < size;) {
+        const auto n = ::write(write_fd, data + written, size - written);
+        if (n < 0 && errno != EINTR) {
+            log(ERROR, client_sock, "Failed to write to the LSP for %s: %s", language.c_str(), strerror(errno));
+            return false;
+        }
+        written += std::max<ssize_t>(n, 0);
+    }
+    return true;
+}
 
-    pollfd pfd = {.fd = read_fd, .events = POLLIN, .revents = 0};
+// The value of the Content-Length field in the header between begin and end, -1 when there is none.
+static long content_length(const std::string &buffer, size_t begin, size_t end) {
+    static const std::string field = "content-length:";
+    while (begin < end) {
+        size_t eol = std::min(buffer.find("\r\n", begin), end);
+        if (eol - begin > field.size() && strncasecmp(buffer.data() + begin, field.data(), field.size()) == 0) {
+            char *parsed;
+            long length = strtol(buffer.data() + begin + field.size(), &parsed, 10);
+            return parsed != buffer.data() + begin + field.size() && length >= 0 ? length : -1;
+        }
+        begin = eol + 2;
+    }
+    return -1;
+}
 
-    while (poll(&pfd, 1, 100) > 0) {
-        if (pfd.revents & POLLIN) {
-            if (const ssize_t n = ::read(read_fd, buffer.data(), buffer.size()); n > 0) {
-                result.append(buffer.data(), n);
+void LspProcess::read_messages() {
+    std::string buffer;
+    std::array<char, 1 << 16> chunk{};
+    pollfd fds[2] = {{.fd = read_fd, .events = POLLIN, .revents = 0}, {.fd = stop_fd, .events = POLLIN, .revents = 0}};
+    while (true) {
+        int timeout = -1;
+        if (!diagnostics.empty()) {
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(diagnostics_deadline - std::chrono::steady_clock::now());
+            timeout = std::max<int>(left.count(), 0);
+        }
+        const int ready = poll(fds, 2, timeout);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
             }
+            break;
+        }
+        if (fds[1].revents != 0) {
+            break;
+        }
+        if (!diagnostics.empty() && std::chrono::steady_clock::now() >= diagnostics_deadline) {
+            send_diagnostics();
+        }
+        if (ready == 0) {
+            continue;
         }
+        const ssize_t n = ::read(read_fd, chunk.data(), chunk.size());
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            log(INFO, "LSP for %s exited", language.c_str());
+            exited = true;
+            break;
+        }
+        buffer.append(chunk.data(), n);
+
+        // the messages are framed by their header, a read may end anywhere in one
+        size_t offset = 0;
+        while (true) {
+            const auto end_of_headers = buffer.find("\r\n\r\n", offset);
+            if (end_of_headers == std::string::npos) {
+                break;
+            }
+            const long length = content_length(buffer, offset, end_of_headers);
+            if (length < 0) {
+                log(ERROR, "Message of the LSP for %s without Content-Length", language.c_str());
+                offset = end_of_headers + 4;
+                continue;
+            }
+            if (buffer.size() - end_of_headers - 4 < static_cast<size_t>(length)) {
+                break;
+            }
+            deliver(buffer.substr(end_of_headers + 4, length));
+            offset = end_of_headers + 4 + length;
+        }
+        buffer.erase(0, offset);
+    }
+    if (!diagnostics.empty()) {
+        send_diagnostics();
     }
+}
 
-    const auto end_of_headers = result.find("\r\n\r\n");
-    if (end_of_headers == std::string::npos) {
-        return std::nullopt;
+std::chrono::steady_clock::time_point LspProcess::last_active() const {
+    return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(active_at.load()));
+}
+
+size_t LspProcess::memory() const {
+    std::ifstream statm("/proc/" + std::to_string(pid) + "/statm");
+    size_t size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+void LspProcess::deliver(std::string message) {
+    active_at = std::chrono::steady_clock::now().time_since_epoch().count();
+    // the uri of the document, the related information of the diagnostics has others
+    const auto uri = json_string_at(message, {"params", "uri"});
+    if (json_string_at(message, {"method"}) == "textDocument/publishDiagnostics" && uri.has_value()) {
+        // only the latest diagnostics of a document are sent
+        if (diagnostics.empty()) {
+            diagnostics_deadline = std::chrono::steady_clock::now() + diagnostics_delay;
+        }
+        auto &latest = diagnostics[std::string(*uri)];
+        if (!latest.empty()) {
+            counter("lsp_diagnostics_dropped").fetch_add(1, std::memory_order_relaxed);
+        }
+        latest = std::move(message);
+        return;
+    }
+    std::vector<client_message> messages;
+    {
+        std::lock_guard<std::mutex> lock(client_mutex);
+        route(std::move(message), messages);
+    }
+    send_to_clients(std::move(messages));
+}
+
+void LspProcess::route(std::string message, std::vector<client_message> &messages) {
+    const auto method = json_string_at(message, {"method"});
+    const auto json_id = json_at(message, {"id"});
+    if (!method.has_value() && json_id.has_value()) {
+        const auto it = forwarded.find(strtoll(std::string(*json_id).c_str(), nullptr, 10));
+        if (it == forwarded.end()) {
+            log(DEBUG, "Dropped the response %.*s of the LSP for %s", static_cast<int>(json_id->size()), json_id->data(), language.c_str());
+            return;
+        }
+        const auto request = std::move(it->second);
+        forwarded.erase(it);
+        const auto connection = request.connection.lock();
+        const auto to = clients.find(connection.get());
+        if (connection == nullptr || to == clients.end()) {
+            return;
+        }
+        cache_response(request.cache_key, message);
+        replace_value(message, *json_id, request.json_id);
+        address(to->second, request.id, message, messages);
+        return;
+    }
+    if (method.has_value() && json_id.has_value()) {
+        // a request of the server is answered by one client
+        if (const auto to = clients.find(last_client); to != clients.end()) {
+            address(to->second, to->second.id, message, messages);
+        }
+        return;
     }
+    notify(message, nullptr, messages);
+}
 
-    assert(::base_path.has_value());
-    const auto json_rpc = result.substr(end_of_headers + 4);
-    const auto url_base_path = urlEncode(::base_path.value());
-    const auto url_server_path = urlEncode(::server_path);
-    auto patched_data = patch_paths(json_rpc, ::base_path.value(), ::server_path);
-    patched_data = patch_paths(patched_data, url_base_path, url_server_path);
+// Sends the notification to the clients which have the document open, to all of them without one.
+void LspProcess::notify(const std::string &message, const std::string *document, std::vector<client_message> &messages) {
+    for (auto &entry : clients) {
+        if (document == nullptr || entry.second.documents.contains(*document)) {
+            address(entry.second, entry.second.id, message, messages);
+        }
+    }
+}
 
-    return patched_data;
+void LspProcess::address(client &to, int request_id, std::string_view message, std::vector<client_message> &messages) {
+    // a connection which is gone does not keep its socket number, it may be reused
+    auto connection = to.connection.lock();
+    if (connection == nullptr) {
+        log(DEBUG, "Dropped a message of the LSP for %s without a client", language.c_str());
+        return;
+    }
+    std::string payload(to.to_client.rewrite(message));
+    messages.push_back(client_message{.connection = std::move(connection), .sock = to.sock, .ssl = to.ssl, .id = request_id, .payload = std::move(payload)});
 }
 
-static int start_server(const std::string &language_name) {
+void LspProcess::send_diagnostics() {
+    std::vector<client_message> open, closed;
+    {
+        std::lock_guard<std::mutex> lock(client_mutex);
+        for (const auto &[uri, message] : diagnostics) {
+            const bool opened = std::any_of(clients.begin(), clients.end(), [&uri](const auto &entry) { return entry.second.documents.contains(uri); });
+            notify(message, opened ? &uri : nullptr, opened ? open : closed);
+        }
+    }
+    diagnostics.clear();
+    // the documents open in the editor first, the ones of a reindex after them
+    send_to_clients(std::move(open));
+    send_to_clients(std::move(closed));
+}
+
+void LspProcess::send_to_clients(std::vector<client_message> messages) {
+    for (auto &message : messages) {
+        LspResponse res;
+        res.set_payload(std::move(message.payload));
+        res.set_language(language);
+        if (send_message(message.sock, message.ssl, message.id, Type::LSP_RESPONSE, &res) < 0) {
+            log(DEBUG, message.sock, "Failed to send a message of the LSP for %s", language.c_str());
+        }
+    }
+}
+
+std::shared_ptr<LspProcess> LspPool::start_server(const std::string &language_name) {
     if (const auto command = available_lsps.find(language_name); command == available_lsps.end()) {
         log(ERROR, "Language not supported");
-        return -1;
+        return nullptr;
     }
+    return std::make_shared<LspProcess>(language_name, server_path);
+}
 
-    lsp_handles[language_name] = std::make_shared<LspProcess>(language_name);
-    return 0;
+std::shared_ptr<LspProcess> LspPool::restart(const std::string &language, language_server &server) {
+    auto old = std::move(server.process);
+    server.process = start_server(language);
+    server.started_at = std::chrono::steady_clock::now();
+    if (server.process != nullptr && old != nullptr) {
+        server.process->adopt_clients(*old);
+    }
+    if (server.process == nullptr || server.initialize.empty()) {
+        return old;
+    }
+    // the editor is not told, its requests go on as if the server never stopped
+    std::vector<std::string> messages = {server.initialize};
+    if (!server.initialized.empty()) {
+        messages.push_back(server.initialized);
+    }
+    for (const auto &[uri, history] : server.documents) {
+        messages.insert(messages.end(), history.begin(), history.end());
+    }
+    // queued without waiting, the new process is not known to anyone else yet
+    server.process->replay(std::move(messages));
+    log(INFO, "Restarted the LSP for %s with %zu documents", language.c_str(), server.documents.size());
+    return old;
 }
 
-int handle_lsp_request(int sock, gnutls_session_t ssl, int id, LspRequest *request) {
-    if (is_initialization(request->payload())) {
-        if (!::base_path.has_value()) {
-            ::base_path = extract_base_path(request->payload());
+// The byte offset of an LSP position, the character counts UTF-16 code units. A position
+// past the end of its line is the end of the line.
+static size_t offset_of(const std::string &text, long line, long character) {
+    size_t at = 0;
+    for (; line > 0 && at < text.size(); at++) {
+        if (text[at] == '\n' || (text[at] == '\r' && (at + 1 == text.size() || text[at + 1] != '\n'))) {
+            line--;
         }
+    }
+    while (character > 0 && at < text.size() && text[at] != '\n' && text[at] != '\r') {
+        const auto c = static_cast<unsigned char>(text[at]);
+        character -= c >= 0xF0 ? 2 : 1;
+        at++;
+        while (at < text.size() && (static_cast<unsigned char>(text[at]) & 0xC0) == 0x80) {
+            at++;
+        }
+    }
+    return at;
+}
+
+static long number_at(std::string_view data, std::initializer_list<std::string_view> path) {
+    const auto value = json_at(data, path);
+    return value.has_value() ? strtol(std::string(*value).c_str(), nullptr, 10) : -1;
+}
 
-        start_server(request->language());
+// The didOpen notification with the text the edits of the history lead to, null when an edit
+// can not be applied.
+static std::optional<std::string> compact_history(const std::vector<std::string> &history) {
+    const auto &opened = history.front();
+    auto text = json_unescape(json_at(opened, {"params", "textDocument", "text"}).value_or(""));
+    auto version = std::string(json_at(opened, {"params", "textDocument", "version"}).value_or("0"));
+    for (size_t i = 1; i < history.size(); i++) {
+        const auto changes = json_at(history[i], {"params", "contentChanges"});
+        if (!changes.has_value()) {
+            return std::nullopt;
+        }
+        for (const auto change : json_elements(*changes)) {
+            const auto replacement = json_at(change, {"text"});
+            if (!replacement.has_value()) {
+                return std::nullopt;
+            }
+            if (!json_at(change, {"range"}).has_value()) {
+                text = json_unescape(*replacement);
+                continue;
+            }
+            const auto start = offset_of(text, number_at(change, {"range", "start", "line"}), number_at(change, {"range", "start", "character"}));
+            const auto end = offset_of(text, number_at(change, {"range", "end", "line"}), number_at(change, {"range", "end", "character"}));
+            if (end < start) {
+                return std::nullopt;
+            }
+            text.replace(start, end - start, json_unescape(*replacement));
+        }
+        version = std::string(json_at(history[i], {"params", "textDocument", "version"}).value_or(version));
     }
+    return R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":)" +
+           std::string(json_at(opened, {"params", "textDocument", "uri"}).value_or(R"("")")) + R"(,"languageId":)" +
+           std::string(json_at(opened, {"params", "textDocument", "languageId"}).value_or(R"("")")) + R"(,"version":)" + version +
+           R"(,"text":)" + json_escape(text) + "}}}";
+}
 
+void LspPool::remember(language_server &server, std::string_view method, const std::string &payload, const std::string &path) {
+    // stopped by the client, not restarted
+    if (method == "exit") {
+        server.initialize.clear();
+        server.initialized.clear();
+        server.documents.clear();
+        return;
+    }
+    if (method != "initialized" && !method.starts_with("textDocument/did")) {
+        return;
+    }
+    // the clients may have the project in different places, the messages are replayed for all of them
+    std::string translated(PathRewriter(path, server_path).rewrite(payload));
+    if (method == "initialized") {
+        server.initialized = std::move(translated);
+        return;
+    }
+    const auto uri = json_string_at(translated, {"params", "textDocument", "uri"});
+    if (!uri.has_value()) {
+        return;
+    }
+    const std::string key(*uri);
+    if (method == "textDocument/didOpen") {
+        server.documents[key] = {std::move(translated)};
+    } else if (method == "textDocument/didChange") {
+        auto it = server.documents.find(key);
+        if (it == server.documents.end()) {
+            return;
+        }
+        it->second.push_back(std::move(translated));
+        size_t size = 0;
+        for (const auto &message : it->second) {
+            size += message.size();
+        }
+        if (size <= max_document_history) {
+            return;
+        }
+        // the edits are applied to the text, a restarted server gets the document as it is now
+        auto compacted = compact_history(it->second);
+        if (compacted.has_value() && compacted->size() <= max_document_history) {
+            it->second = {std::move(*compacted)};
+            return;
+        }
+        // not reopened after a restart, the server reads it from the disk
+        log(DEBUG, "Forgetting the edits of %s", key.c_str());
+        server.documents.erase(it);
+    } else if (method == "textDocument/didClose") {
+        server.documents.erase(key);
+    }
+}
+
+int LspPool::handle_request(int sock, gnutls_session_t ssl, int id, LspRequest *request) {
     const auto &language = request->language();
-    auto language_handler = lsp_handles.find(language);
-    if (language_handler == lsp_handles.end()) {
-        if (start_server(language) < 0) {
+    const auto connection = hold_connection(sock, ssl);
+    std::shared_ptr<LspProcess> handler, retired;
+    std::string from;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto method = json_string_at(request->payload(), {"method"}).value_or("");
+        const bool initialize = strcasecmp(std::string(method).c_str(), "initialize") == 0;
+        if (initialize) {
+            // a connection which is gone does not keep its address, a new one may have it
+            std::erase_if(client_roots, [](const auto &root) { return root.second.first.expired(); });
+            if (auto root = extract_base_path(request->payload(), server_path); root.has_value()) {
+                if (connection != nullptr) {
+                    client_roots[connection.get()] = {connection, *root};
+                }
+                client_path = std::move(root);
+            }
+        }
+        const auto root = client_roots.find(connection.get());
+        from = root != client_roots.end() && root->second.first.lock() == connection ? root->second.second : client_path.value_or(server_path);
+        auto &server = servers[language];
+        if (initialize) {
+            // a prespawned server is handed to the first client
+            const bool fresh = server.process != nullptr && server.process->running() && server.initialize.empty();
+            server.initialize.clear();
+            server.initialized.clear();
+            server.documents.clear();
+            if (!fresh) {
+                retired = restart(language, server);
+            }
+            server.initialize = PathRewriter(from, server_path).rewrite(request->payload());
+        } else if (server.process == nullptr || !server.process->running()) {
+            retired = restart(language, server);
+        }
+        if (server.process == nullptr) {
+            servers.erase(language);
             return -1;
         }
-
-        language_handler = lsp_handles.find(language);
+        remember(server, method, request->payload(), from);
+        // queued under the lock, the maintenance does not stop the process as idle or restart
+        // it before the message is in its queue, a restart replays the state with it
+        handler = server.process;
+        handler->send(sock, ssl, id, std::move(*request->mutable_payload()), from);
     }
-    const auto handler = language_handler->second;
 
-    const auto &response = request->payload();
-    handler->write(response);
+    // the response arrives on the reader of the language server, a server which does not
+    // keep up slows down the connections writing to it only
+    handler->wait_for_room();
+    return 0;
+}
 
-    const auto data = handler->read();
-    if (!data.has_value()) {
-        return 0;
+void LspPool::prespawn(const std::vector<std::string> &languages) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &language : languages) {
+        if (available_lsps.find(language) == available_lsps.end()) {
+            log(ERROR, "No LSP is configured for %s, it is not prespawned", language.c_str());
+            continue;
+        }
+        auto &server = servers[language];
+        server.process = start_server(language);
+        server.started_at = std::chrono::steady_clock::now();
+        log(INFO, "Prespawned the LSP for %s in %s", language.c_str(), server_path.c_str());
     }
+}
 
-    LspResponse res;
-    res.set_payload(data.value());
-    res.set_language(language);
+void LspPool::maintain() {
+    // stopping the processes waits for them, not under the lock
+    std::vector<std::shared_ptr<LspProcess>> retired;
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto now = std::chrono::steady_clock::now();
+    for (auto &[language, server] : servers) {
+        if (server.process == nullptr) {
+            continue;
+        }
+        const size_t memory = memory_limit > 0 && server.process->running() ? server.process->memory() : 0;
+        // a server which stays under the limit for a while restarts right away again
+        if (memory <= memory_limit && now - server.started_at > max_memory_backoff) {
+            server.memory_restarts = 0;
+        }
+        if (!server.process->running()) {
+            // a server crashing at startup is not restarted in a loop
+            if (server.initialize.empty() || now - server.started_at < restart_delay) {
+                continue;
+            }
+            log(WARN, "The LSP for %s exited, restarting it", language.c_str());
+            retired.push_back(restart(language, server));
+        } else if (memory_limit > 0 && memory > memory_limit) {
+            // a server which needs more than the limit for the project is not restarted in a loop
+            const auto backoff = server.memory_restarts == 0 ? std::chrono::seconds(0)
+                                                             : std::min<std::chrono::seconds>(restart_delay * (1 << std::min(server.memory_restarts - 1, 16)), max_memory_backoff);
+            if (now - server.started_at < backoff) {
+                if (!server.memory_warned) {
+                    log(WARN, "The LSP for %s uses %zu MiB again after %d restarts, restarting it in %lld s", language.c_str(), memory >> 20,
+                        server.memory_restarts, static_cast<long long>(std::chrono::duration_cast<std::chrono::seconds>(backoff - (now - server.started_at)).count()));
+                    server.memory_warned = true;
+                }
+                continue;
+            }
+            log(WARN, "The LSP for %s uses %zu MiB, restarting it", language.c_str(), memory >> 20);
+            server.memory_restarts++;
+            server.memory_warned = false;
+            retired.push_back(restart(language, server));
+        } else if (idle_timeout.count() > 0 && now - server.process->last_active() > idle_timeout) {
+            // started again by the next request
+            log(INFO, "Stopping the idle LSP for %s", language.c_str());
+            retired.push_back(std::move(server.process));
+        }
+    }
+}
 
-    const auto n = send_message(sock, ssl, id, Type::LSP_RESPONSE, &res);
-    return n < 0 ? -1 : n;
+void LspPool::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    servers.clear();
 }
 
-void initialize_lsp_config(std::string server_base_path) {
-    ::server_path = std::move(std::filesystem::weakly_canonical(server_base_path));
+int handle_lsp_request(int sock, gnutls_session_t ssl, int id, LspRequest *request) { return find_export(sock)->lsp.handle_request(sock, ssl, id, request); }
 
+void initialize_lsp_config() {
     auto config_home = getenv("XDG_CONFIG_HOME");
     if (config_home == nullptr) {
         const auto passwd = getpwuid(getuid());
@@ -248,6 +851,21 @@ void initialize_lsp_config(std::string server_base_path) {
         ::available_lsps[language] = server;
         log(DEBUG, "LSP for %s is %s", language.c_str(), server.c_str());
     }
+    prespawned.assign(config.prespawn().begin(), config.prespawn().end());
+    idle_timeout = std::chrono::seconds(std::max(config.idle_timeout(), 0));
+    memory_limit = static_cast<size_t>(std::max(config.memory_limit(), 0)) << 20;
 }
 
-void reset_handlers() { ::lsp_handles.clear(); }
+void start_lsp_servers() {
+    for (auto *ex : all_exports()) {
+        ex->lsp.prespawn(prespawned);
+    }
+    std::thread([] {
+        while (true) {
+            std::this_thread::sleep_for(maintenance_interval);
+            for (auto *ex : all_exports()) {
+                ex->lsp.maintain();
+            }
+        }
+    }).detach();
+}
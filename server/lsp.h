@@ -1,27 +1,201 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <gnutls/gnutls.h>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "../proto/messages.pb.h"
+#include "uri.h"
 
+class Connection;
+
+// A language server. The messages for it are queued and written by a thread of its own,
+// a busy server does not hold up the requests of the connection. Its messages are read by
+// another thread as they come and sent as LSP_RESPONSEs. The mounts of an export share the
+// server: the ids of their requests are replaced with ids unique over all of them, the
+// responses go back to the connection which asked with its own id and in its paths. The
+// requests of the server go to the connection which wrote last, the notifications to all
+// of them, the diagnostics to the ones which have the document open. The bursts of
+// diagnostics are merged, only the latest ones of a document are sent.
 class LspProcess {
   public:
-    explicit LspProcess(const std::string &language);
+    LspProcess(const std::string &language_name, std::string project_path);
     ~LspProcess();
-    void write(const std::string &data) const;
-    [[nodiscard]] std::optional<std::string> read() const;
+    // Queues a message for the server without waiting. The paths of the project on the client
+    // are translated to the paths on the server and back in the messages of the language server.
+    void send(int client_sock, gnutls_session_t client_ssl, int client_id, std::string data, const std::string &path);
+    // Waits while too much is queued for the server.
+    void wait_for_room();
+    // Queues the messages which bring a new server to the state of the clients, in the paths
+    // of the server, without waiting for room. Called before the process is handed out, nothing
+    // is sent before them. The answers to the replayed requests are dropped, the clients got
+    // their own before.
+    void replay(std::vector<std::string> messages);
+    // Takes over the clients of the process this one replaces, they get its notifications.
+    void adopt_clients(LspProcess &old);
+    // False once the server exited on its own.
+    bool running() const { return !exited; }
+    // When the last message was sent to the server or came from it.
+    std::chrono::steady_clock::time_point last_active() const;
+    // The resident memory of the server in bytes.
+    size_t memory() const;
 
   private:
+    struct outgoing {
+        int sock;
+        gnutls_session_t ssl;
+        int id;
+        std::string data;
+        std::string client_path;
+        // the key of the answer in the cache, empty when it is not cached
+        std::string cache_key;
+        bool replayed = false;
+    };
+
+    // a connection using the server
+    struct client {
+        int sock = -1;
+        gnutls_session_t ssl = nullptr;
+        // of the last request, the notifications go with it
+        int id = 0;
+        std::weak_ptr<Connection> connection;
+        PathRewriter to_client;
+        // the documents it has open, in the paths of the server
+        std::set<std::string> documents;
+    };
+
+    // a request of a client, by the id the server got
+    struct forwarded_request {
+        std::weak_ptr<Connection> connection;
+        int id;
+        // the JSON id the client chose
+        std::string json_id;
+        std::string cache_key;
+    };
+
+    // a message for a client, sent once the locks are released
+    struct client_message {
+        std::shared_ptr<Connection> connection;
+        int sock;
+        gnutls_session_t ssl;
+        int id;
+        std::string payload;
+    };
+
+    // Tracks the versions of the documents and answers the pure requests for a version
+    // the server answered before, true when the request was answered. The key of a request
+    // the server has to answer is stored in key.
+    bool answer_from_cache(int client_sock, gnutls_session_t client_ssl, int client_id, const std::string &data, const std::string &path, std::string &key);
+    void cache_response(const std::string &key, std::string_view message);
+    void forget_responses(const std::string &uri);
+    void write_messages();
+    void write(const outgoing &message);
+    // Registers the client of the message and gives a request an id unique over the clients,
+    // false when the message is not needed by the server. With client_mutex held.
+    bool forward(const outgoing &message, std::string &data);
+    bool write_all(int client_sock, const char *data, size_t size);
+    void read_messages();
+    void deliver(std::string message);
+    // Finds the clients a message of the server goes to, with client_mutex held.
+    void route(std::string message, std::vector<client_message> &messages);
+    void notify(const std::string &message, const std::string *document, std::vector<client_message> &messages);
+    void address(client &to, int request_id, std::string_view message, std::vector<client_message> &messages);
+    void send_diagnostics();
+    void send_to_clients(std::vector<client_message> messages);
+
+    const std::string language;
+    const std::string server_path;
     pid_t pid;
     int write_fd;
     int read_fd;
+    int stop_fd;
+    std::thread reader;
+    std::atomic<bool> exited = false;
+    std::atomic<std::chrono::steady_clock::rep> active_at;
+    // the latest diagnostics by uri, waiting to be sent, only used by the reader
+    std::map<std::string, std::string> diagnostics;
+    std::chrono::steady_clock::time_point diagnostics_deadline;
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<outgoing> queue;
+    size_t queued_bytes = 0;
+    bool stopping = false;
+    std::thread writer;
+    // only used by the writer
+    PathRewriter to_server;
+    int64_t next_request_id = 1;
+
+    // the responses to the pure requests by uri, version of the document, method and hash
+    // of the parameters, in the paths of the server, the server is asked again once the
+    // document changes
+    std::mutex cache_mutex;
+    std::map<std::string, int64_t> versions;
+    std::map<std::string, std::string> responses;
+    size_t cached_bytes = 0;
+
+    std::mutex client_mutex;
+    std::map<const Connection *, client> clients;
+    std::map<int64_t, forwarded_request> forwarded;
+    // gets the requests of the server
+    const Connection *last_client = nullptr;
 };
 
-static std::map<std::string, std::string> available_lsps = {};
-static std::map<std::string, std::shared_ptr<LspProcess>> lsp_handles = {};
+// The language servers of an export, started by the first request for their language
+// or with the server when they are configured to be prespawned. The pool remembers the
+// initialization and the open documents of each server, a server which crashed, used too
+// much memory or was stopped while idle is started again with them replayed.
+class LspPool {
+  public:
+    explicit LspPool(std::string project_path) : server_path(std::move(project_path)) {}
+    int handle_request(int sock, gnutls_session_t ssl, int id, LspRequest *request);
+    // Starts the servers of the languages, they are handed to the first initialize request.
+    void prespawn(const std::vector<std::string> &languages);
+    // Restarts the crashed servers and the ones over the memory limit, stops the idle ones.
+    void maintain();
+    void reset();
+
+  private:
+    struct language_server {
+        std::shared_ptr<LspProcess> process;
+        // the messages which bring a new process to the state of the client, in the paths of
+        // the server, the initialize request is empty for a server no client initialized yet
+        std::string initialize;
+        std::string initialized;
+        std::map<std::string, std::vector<std::string>> documents;
+        std::chrono::steady_clock::time_point started_at;
+        // the restarts over the memory limit in a row, they are spaced out further each time
+        int memory_restarts = 0;
+        bool memory_warned = false;
+    };
+
+    std::shared_ptr<LspProcess> start_server(const std::string &language);
+    // Starts a new process for the server, replaying the state of the client to it. The
+    // old process is returned to be stopped outside of the lock.
+    std::shared_ptr<LspProcess> restart(const std::string &language, language_server &server);
+    void remember(language_server &server, std::string_view method, const std::string &payload, const std::string &path);
+
+    std::mutex mutex;
+    const std::string server_path;
+    // the roots of the project on the clients, taken from their initialize requests, each
+    // mount may have it elsewhere, the latest one is used for the clients which sent none
+    std::map<const Connection *, std::pair<std::weak_ptr<Connection>, std::string>> client_roots;
+    std::optional<std::string> client_path;
+    std::map<std::string, language_server> servers;
+};
 
+// Passes the request to the language server of the export of the connection.
 int handle_lsp_request(int sock, gnutls_session_t ssl, int id, LspRequest *request);
-void initialize_lsp_config(std::string server_base_path);
-void reset_handlers();
+void initialize_lsp_config();
+// Prespawns the configured language servers of the exports and starts looking after them.
+void start_lsp_servers();
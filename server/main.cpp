@@ -1,11 +1,19 @@
 #include "../common/log.h"
 #include "../server/lsp.h"
+#include "exec.h"
+#include "export.h"
 #include "fs.h"
+#include "metrics.h"
 #include "tcp.h"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <getopt.h>
+#include <set>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
+#include <vector>
 
 std::string banner = R"(
  _
@@ -15,23 +23,92 @@ std::string banner = R"(
  \__\___|\__,_| |___/\___|_|    \_/ \___|_|
 )";
 
-int main(int argc, char *argv[]) {
-    if (argc < 4) {
-        log(ERROR, "Usage: %s <dir> <cert> <key>", argv[0]);
-        return 1;
-    }
+static const option long_options[] = {
+    {"export", required_argument, nullptr, 'e'},
+    {"exec", required_argument, nullptr, 'x'},
+    {"index", optional_argument, nullptr, 'i'},
+    {"listen", required_argument, nullptr, 'l'},
+    {nullptr, 0, nullptr, 0},
+};
 
-    std::filesystem::path path = argv[1];
-    std::string cert = argv[2];
-    std::string key = argv[3];
+static void usage(const char *progname) {
+    log(ERROR, "Usage: %s [options] [<dir>] [<cert> <key>]\n"
+               "    -e   --export=<s>=<dir>  Export <dir> under the name <s>, repeatable (the <dir> argument is the default export)\n"
+               "    -x   --exec=<s>      Allow the clients to execute the command <s> in the project directory, repeatable\n"
+               "    -i   --index[=<d>]   Serve metadata from an in-memory index built with <d> threads (default: number of cores)\n"
+               "    -l   --listen=<url>  Listen on tls://[address][:port], unix:///path or vsock://[cid][:port], repeatable\n"
+               "                         (default: tls://[::]:5210, IPv4 and IPv6), the certificate and key are needed for TLS only",
+        progname);
+}
 
-    if (!std::filesystem::exists(path)) {
-        log(ERROR, "Directory %s does not exist", argv[1]);
+int main(int argc, char *argv[]) {
+    int index_threads = 0;
+    std::vector<Endpoint> endpoints;
+    std::set<std::string> commands;
+    std::vector<std::pair<std::string, std::string>> exports;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "e:x:i::l:", long_options, nullptr)) != -1) {
+        switch (opt) {
+        case 'e': {
+            const char *separator = strchr(optarg, '=');
+            if (separator == nullptr || separator == optarg) {
+                log(ERROR, "Invalid export %s, expected <name>=<dir>", optarg);
+                return 1;
+            }
+            exports.emplace_back(std::string(optarg, separator - optarg), separator + 1);
+            break;
+        }
+        case 'x':
+            commands.insert(optarg);
+            break;
+        case 'i':
+            index_threads = optarg != nullptr ? atoi(optarg) : std::thread::hardware_concurrency();
+            break;
+        case 'l': {
+            Endpoint endpoint;
+            if (!parse_endpoint(optarg, 5210, &endpoint)) {
+                log(ERROR, "Invalid listen URL %s", optarg);
+                return 1;
+            }
+            endpoints.push_back(endpoint);
+            break;
+        }
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (endpoints.empty()) {
+        endpoints.push_back(Endpoint{.transport = Endpoint::TLS, .address = "::", .port = 5210});
+    }
+    const bool tls = std::any_of(endpoints.begin(), endpoints.end(), [](const Endpoint &endpoint) { return endpoint.transport == Endpoint::TLS; });
+    // the default directory comes before the certificate and the key
+    const int positional = argc - optind;
+    if (positional % 2 == 1) {
+        exports.emplace(exports.begin(), "", argv[optind++]);
+    }
+    if (exports.empty() || (tls && argc - optind < 2)) {
+        usage(argv[0]);
         return 1;
     }
+    std::string cert = argc - optind >= 2 ? argv[optind] : "";
+    std::string key = argc - optind >= 2 ? argv[optind + 1] : "";
+
     log(NONE, banner.c_str());
+    for (const auto &[name, dir] : exports) {
+        if (!add_export(name, dir)) {
+            return 1;
+        }
+    }
 
-    initialize_lsp_config(path);
-    listen(5210, get_handlers(path), cert, key);
+    initialize_metrics();
+    initialize_lsp_config();
+    start_lsp_servers();
+    initialize_exec(commands);
+    recv_handlers handlers = get_handlers();
+    if (index_threads > 0) {
+        enable_metadata_index(index_threads);
+    }
+    listen(endpoints, handlers, cert, key);
     return 0;
 };
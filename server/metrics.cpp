@@ -0,0 +1,92 @@
+#include "metrics.h"
+
+#include "../common/log.h"
+#include <algorithm>
+#include <bit>
+#include <csignal>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+static std::mutex metrics_mutex;
+static std::map<std::string, std::unique_ptr<Histogram>> histograms;
+static std::map<std::string, std::unique_ptr<std::atomic<uint64_t>>> counters;
+
+static size_t bucket(uint64_t value) { return std::bit_width(value); }
+
+static uint64_t upper_bound(size_t bucket) { return bucket >= 64 ? UINT64_MAX : (uint64_t(1) << bucket) - 1; }
+
+void Histogram::record(uint64_t value) {
+    buckets[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+    uint64_t current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Histogram::percentile(double fraction) const {
+    uint64_t target = fraction * count();
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen > target) {
+            return std::min(upper_bound(i), maximum.load(std::memory_order_relaxed));
+        }
+    }
+    return maximum.load(std::memory_order_relaxed);
+}
+
+std::string Histogram::summary() const {
+    uint64_t n = count();
+    if (n == 0) {
+        return "count 0";
+    }
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "count %lu mean %lu p50 %lu p90 %lu p99 %lu max %lu", n, sum.load(std::memory_order_relaxed) / n, percentile(0.5),
+             percentile(0.9), percentile(0.99), maximum.load(std::memory_order_relaxed));
+    return buffer;
+}
+
+Histogram &histogram(const std::string &name) {
+    std::lock_guard<std::mutex> lock(metrics_mutex);
+    auto &h = histograms[name];
+    if (h == nullptr) {
+        h = std::make_unique<Histogram>();
+    }
+    return *h;
+}
+
+std::atomic<uint64_t> &counter(const std::string &name) {
+    std::lock_guard<std::mutex> lock(metrics_mutex);
+    auto &c = counters[name];
+    if (c == nullptr) {
+        c = std::make_unique<std::atomic<uint64_t>>(0);
+    }
+    return *c;
+}
+
+void log_metrics() {
+    std::lock_guard<std::mutex> lock(metrics_mutex);
+    for (const auto &[name, h] : histograms) {
+        log(INFO, "%s: %s", name.c_str(), h->summary().c_str());
+    }
+    for (const auto &[name, c] : counters) {
+        log(INFO, "%s: %lu", name.c_str(), c->load(std::memory_order_relaxed));
+    }
+}
+
+void initialize_metrics() {
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &set, nullptr);
+    std::thread([set] {
+        int signal;
+        while (sigwait(&set, &signal) == 0) {
+            log_metrics();
+        }
+    }).detach();
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Histogram with power of two buckets. Recording is lock free, so it can be used
+// on the hot paths, the percentiles are the upper bounds of the buckets.
+class Histogram {
+  public:
+    void record(uint64_t value);
+    uint64_t count() const { return total.load(std::memory_order_relaxed); }
+    uint64_t percentile(double fraction) const;
+    std::string summary() const;
+
+  private:
+    std::array<std::atomic<uint64_t>, 65> buckets{};
+    std::atomic<uint64_t> total = 0;
+    std::atomic<uint64_t> sum = 0;
+    std::atomic<uint64_t> maximum = 0;
+};
+
+// The histogram registered under name, created on first use. The references stay valid.
+Histogram &histogram(const std::string &name);
+// The counter registered under name, created on first use.
+std::atomic<uint64_t> &counter(const std::string &name);
+void log_metrics();
+// Logs the metrics whenever the server receives SIGUSR1. Has to be called before
+// any other thread is started, they inherit the blocked signal.
+void initialize_metrics();
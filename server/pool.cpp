@@ -0,0 +1,83 @@
+#include "pool.h"
+
+#include <algorithm>
+#include <memory>
+
+ThreadPool::ThreadPool(size_t threads) {
+    threads = std::max<size_t>(threads, 1);
+    for (size_t i = 0; i < threads; i++) {
+        workers.emplace_back(&ThreadPool::run, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    cv.notify_one();
+}
+
+void ThreadPool::run() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)> &fn) {
+    struct state {
+        std::function<void(size_t)> fn;
+        size_t count;
+        std::atomic<size_t> next = 0;
+        std::atomic<size_t> done = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    auto s = std::make_shared<state>();
+    s->fn = fn;
+    s->count = count;
+    auto work = [s] {
+        for (size_t i = s->next++; i < s->count; i = s->next++) {
+            s->fn(i);
+            if (++s->done == s->count) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                s->cv.notify_all();
+            }
+        }
+    };
+
+    size_t helpers = std::min(workers.size(), count > 0 ? count - 1 : 0);
+    for (size_t i = 0; i < helpers; i++) {
+        submit(work);
+    }
+    work();
+    std::unique_lock<std::mutex> lock(s->mutex);
+    s->cv.wait(lock, [&s] { return s->done == s->count; });
+}
+
+ThreadPool &worker_pool() {
+    // never destroyed, the workers may still be busy when the process exits
+    static ThreadPool *pool = new ThreadPool(std::thread::hardware_concurrency());
+    return *pool;
+}
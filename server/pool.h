@@ -0,0 +1,33 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads shared by the long running requests of all clients.
+class ThreadPool {
+  public:
+    explicit ThreadPool(size_t threads);
+    ~ThreadPool();
+
+    size_t size() const { return workers.size(); }
+    void submit(std::function<void()> task);
+    // Runs fn for every index in [0, count). The calling thread takes part, so it
+    // makes progress even when all workers are busy with long running tasks.
+    void parallel_for(size_t count, const std::function<void(size_t)> &fn);
+
+  private:
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+};
+
+// The pool shared by the request handlers, sized to the number of cores.
+ThreadPool &worker_pool();
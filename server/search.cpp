@@ -0,0 +1,383 @@
+#include "search.h"
+
+#include "../common/io.h"
+#include "../common/log.h"
+#include "export.h"
+#include "pool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fnmatch.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// matches are sent once a chunk grows over this size
+static const size_t chunk_size = 1 << 16;
+// longer lines are cut in the response, a regex only sees their start, the libstdc++ matcher
+// recurses for each character and a line of megabytes would exhaust the stack
+static const size_t max_line = 1024;
+// files with a NUL byte in the first block are treated as binary and skipped
+static const size_t binary_probe = 8192;
+
+Matcher::Matcher(const SearchRequest &req) : literal(req.pattern()), ignore_case(req.ignore_case()) {
+    if (req.regex()) {
+        auto flags = std::regex_constants::ECMAScript | std::regex_constants::optimize;
+        if (ignore_case) {
+            flags |= std::regex_constants::icase;
+        }
+        regex = std::regex(req.pattern(), flags);
+        is_regex = true;
+    }
+    if (ignore_case) {
+        std::transform(literal.begin(), literal.end(), literal.begin(), [](unsigned char c) { return std::tolower(c); });
+    }
+}
+
+const char *Matcher::find(const char *begin, const char *end) const {
+    if (is_regex) {
+        return find_regex(begin, end);
+    }
+    if (literal.empty()) {
+        return begin;
+    }
+    if (!ignore_case) {
+        // glibc memmem and memchr are vectorized
+        auto found = static_cast<const char *>(memmem(begin, end - begin, literal.data(), literal.size()));
+        return found != nullptr ? found : end;
+    }
+    return find_icase(begin, end);
+}
+
+const char *Matcher::find_icase(const char *begin, const char *end) const {
+    const unsigned char first = literal[0];
+    const unsigned char other = std::toupper(first);
+    const char *lower = begin;
+    const char *upper = begin;
+    const char *p = begin;
+    while (p < end) {
+        if (lower != nullptr && lower < p) {
+            lower = static_cast<const char *>(memchr(p, first, end - p));
+        }
+        if (upper != nullptr && upper < p) {
+            upper = first == other ? nullptr : static_cast<const char *>(memchr(p, other, end - p));
+        }
+        const char *candidate = lower == nullptr ? upper : (upper == nullptr ? lower : std::min(lower, upper));
+        if (candidate == nullptr || static_cast<size_t>(end - candidate) < literal.size()) {
+            return end;
+        }
+        if (strncasecmp(candidate, literal.data(), literal.size()) == 0) {
+            return candidate;
+        }
+        p = candidate + 1;
+    }
+    return end;
+}
+
+const char *Matcher::find_regex(const char *begin, const char *end) const {
+    std::cmatch match;
+    for (const char *line = begin; line < end;) {
+        const char *eol = static_cast<const char *>(memchr(line, '\n', end - line));
+        if (eol == nullptr) {
+            eol = end;
+        }
+        const bool cut = static_cast<size_t>(eol - line) > max_line;
+        const auto flags = cut ? std::regex_constants::match_not_eol : std::regex_constants::match_default;
+        if (std::regex_search(line, cut ? line + max_line : eol, match, regex, flags)) {
+            return line + match.position(0);
+        }
+        line = eol + 1;
+    }
+    return end;
+}
+
+struct search {
+    int sock;
+    gnutls_session_t ssl;
+    // the matches are sent on it, a closed one takes no more chunks
+    std::shared_ptr<Connection> connection;
+    int id;
+    // the directory of the export, the paths of the matches are relative to it
+    std::string base_path;
+    SearchRequest req;
+    Matcher matcher;
+    std::vector<std::string> files;
+    std::atomic<size_t> next = 0;
+    std::atomic<int> results = 0;
+    std::atomic<bool> cancelled = false;
+
+    std::mutex mutex;
+    SearchResponse pending;
+    int running = 0;
+    int error = 0;
+
+    search(int socket, gnutls_session_t session, int request_id, const std::string &base, const SearchRequest &request)
+        : sock(socket), ssl(session), connection(hold_connection(socket, session)), id(request_id), base_path(base), req(request),
+          matcher(request) {}
+};
+
+static std::map<std::pair<int, int>, std::shared_ptr<search>> searches;
+static std::mutex searches_mutex;
+
+static bool glob_match(const std::string &glob, const std::string &relative) {
+    if (glob.find('/') == std::string::npos) {
+        auto name = relative.substr(relative.find_last_of('/') + 1);
+        return fnmatch(glob.c_str(), name.c_str(), 0) == 0;
+    }
+    const char *path = relative.c_str();
+    const char *pattern = glob.c_str();
+    if (*pattern == '/') {
+        pattern++;
+    }
+    return fnmatch(pattern, path + 1, 0) == 0;
+}
+
+static bool excluded(const SearchRequest &req, const std::string &relative) {
+    for (const auto &glob : req.globs()) {
+        if (glob.starts_with('!') && glob_match(glob.substr(1), relative)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool included(const SearchRequest &req, const std::string &relative) {
+    bool has_include = false;
+    for (const auto &glob : req.globs()) {
+        if (glob.starts_with('!')) {
+            continue;
+        }
+        has_include = true;
+        if (glob_match(glob, relative)) {
+            return true;
+        }
+    }
+    return !has_include;
+}
+
+// Replaces invalid UTF-8 so the line can be sent as a protobuf string.
+static std::string sanitize(const char *begin, size_t size) {
+    std::string text(begin, size);
+    for (size_t i = 0; i < text.size();) {
+        auto c = static_cast<unsigned char>(text[i]);
+        size_t len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xe ? 3 : (c >> 3) == 0x1e ? 4 : 0;
+        bool valid = len != 0 && i + len <= text.size();
+        for (size_t j = 1; valid && j < len; j++) {
+            valid = (static_cast<unsigned char>(text[i + j]) >> 6) == 0x2;
+        }
+        if (!valid) {
+            text[i] = '?';
+            len = 1;
+        }
+        i += len;
+    }
+    return text;
+}
+
+static void send_chunk(search &s, SearchResponse &res) {
+    if (s.connection == nullptr || s.connection->send_chunk(s.id, Type::SEARCH_RESPONSE, &res, s.cancelled) < 0) {
+        log(DEBUG, s.sock, "(%d) Failed to send search results", s.id);
+        s.cancelled = true;
+    }
+}
+
+static void flush(search &s, std::vector<SearchMatch> &matches) {
+    SearchResponse chunk;
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (auto &match : matches) {
+            *s.pending.add_matches() = std::move(match);
+        }
+        if (s.pending.ByteSizeLong() < chunk_size) {
+            return;
+        }
+        chunk.Swap(&s.pending);
+    }
+    send_chunk(s, chunk);
+}
+
+static void scan_file(search &s, const std::string &relative) {
+    int fd = open((s.base_path + relative).c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        close(fd);
+        return;
+    }
+    size_t size = st.st_size;
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return;
+    }
+    madvise(map, size, MADV_SEQUENTIAL);
+
+    const char *begin = static_cast<const char *>(map);
+    const char *end = begin + size;
+    std::vector<SearchMatch> matches;
+    if (memchr(begin, '\0', std::min(size, binary_probe)) == nullptr) {
+        int line = 1;
+        const char *counted = begin;
+        for (const char *p = begin; p < end && !s.cancelled;) {
+            const char *found = s.matcher.find(p, end);
+            if (found == end) {
+                break;
+            }
+            const char *bol = static_cast<const char *>(memrchr(begin, '\n', found - begin));
+            bol = bol == nullptr ? begin : bol + 1;
+            const char *eol = static_cast<const char *>(memchr(found, '\n', end - found));
+            eol = eol == nullptr ? end : eol;
+            line += std::count(counted, bol, '\n');
+            counted = bol;
+
+            if (s.req.max_results() > 0 && s.results.fetch_add(1) >= s.req.max_results()) {
+                s.cancelled = true;
+                break;
+            }
+            SearchMatch match;
+            match.set_path(sanitize(relative.data(), relative.size()));
+            match.set_line(line);
+            match.set_column(found - bol + 1);
+            match.set_text(sanitize(bol, std::min(static_cast<size_t>(eol - bol), max_line)));
+            matches.push_back(std::move(match));
+            p = eol + 1;
+        }
+    }
+    munmap(map, size);
+    if (!matches.empty()) {
+        flush(s, matches);
+    }
+}
+
+static void finish(const std::shared_ptr<search> &s) {
+    SearchResponse last;
+    {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        last.Swap(&s->pending);
+        last.set_error(s->error);
+    }
+    last.set_done(true);
+    send_chunk(*s, last);
+
+    std::lock_guard<std::mutex> lock(searches_mutex);
+    searches.erase({s->sock, s->id});
+}
+
+static void scan_files(const std::shared_ptr<search> &s) {
+    for (size_t i = s->next++; i < s->files.size() && !s->cancelled; i = s->next++) {
+        scan_file(*s, s->files[i]);
+    }
+    bool last;
+    {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        last = --s->running == 0;
+    }
+    if (last) {
+        finish(s);
+    }
+}
+
+static void collect_files(const std::shared_ptr<search> &s, const std::string &root) {
+    std::error_code ec;
+    auto options = std::filesystem::directory_options::skip_permission_denied;
+    for (auto it = std::filesystem::recursive_directory_iterator(root, options, ec); !ec && it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (s->cancelled) {
+            return;
+        }
+        const auto relative = it->path().string().substr(s->base_path.size());
+        const auto name = it->path().filename().string();
+        if ((!s->req.hidden() && name.starts_with('.')) || excluded(s->req, relative)) {
+            if (it->is_directory(ec)) {
+                it.disable_recursion_pending();
+            }
+            continue;
+        }
+        if (it->is_regular_file(ec) && !it->is_symlink(ec) && included(s->req, relative)) {
+            s->files.push_back(relative);
+        }
+    }
+}
+
+static void start(const std::shared_ptr<search> &s, const std::string &root) {
+    collect_files(s, root);
+    ThreadPool &pool = worker_pool();
+    size_t workers = std::min(pool.size(), std::max<size_t>(s->files.size(), 1));
+    {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        s->running = workers;
+    }
+    for (size_t i = 0; i < workers; i++) {
+        pool.submit([s] { scan_files(s); });
+    }
+}
+
+int handle_search_request(int sock, gnutls_session_t ssl, int id, SearchRequest *req) {
+    Export &ex = *find_export(sock);
+    SearchResponse res;
+    std::string root = std::filesystem::weakly_canonical(ex.path + req->path());
+    if (!ex.contains(root)) {
+        res.set_error(EACCES);
+    }
+
+    std::shared_ptr<search> s;
+    if (res.error() == 0) {
+        try {
+            s = std::make_shared<search>(sock, ssl, id, ex.path, *req);
+        } catch (const std::regex_error &e) {
+            log(DEBUG, sock, "(%d) Invalid search pattern: %s", id, e.what());
+            res.set_error(EINVAL);
+        }
+    }
+    if (res.error() == 0) {
+        std::lock_guard<std::mutex> lock(searches_mutex);
+        if (!searches.emplace(std::make_pair(sock, id), s).second) {
+            res.set_error(EBUSY);
+        }
+    }
+    if (res.error() != 0) {
+        res.set_done(true);
+        return send_message(sock, ssl, id, Type::SEARCH_RESPONSE, &res) < 0 ? -1 : 0;
+    }
+
+    // matches are streamed from the pool, the connection keeps serving other requests
+    worker_pool().submit([s, root] { start(s, root); });
+    return 0;
+}
+
+int handle_search_cancel_request(int sock, gnutls_session_t ssl, int id, SearchCancelRequest *req) {
+    SearchCancelResponse res;
+    {
+        std::lock_guard<std::mutex> lock(searches_mutex);
+        auto it = searches.find({sock, req->search_id()});
+        if (it == searches.end()) {
+            res.set_error(ESRCH);
+        } else {
+            std::lock_guard<std::mutex> search_lock(it->second->mutex);
+            it->second->error = ECANCELED;
+            it->second->cancelled = true;
+        }
+    }
+    return send_message(sock, ssl, id, Type::SEARCH_CANCEL_RESPONSE, &res) < 0 ? -1 : 0;
+}
+
+void cancel_searches(int sock) {
+    std::lock_guard<std::mutex> lock(searches_mutex);
+    for (auto &[key, s] : searches) {
+        if (key.first == sock) {
+            s->cancelled = true;
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "../proto/messages.pb.h"
+#include <gnutls/gnutls.h>
+#include <regex>
+#include <string>
+
+// Finds the pattern of a search in the content of a file, a literal or an ECMAScript regex.
+class Matcher {
+  public:
+    explicit Matcher(const SearchRequest &req);
+
+    // Returns the first match in [begin, end) or end, a match never spans lines.
+    const char *find(const char *begin, const char *end) const;
+
+  private:
+    const char *find_icase(const char *begin, const char *end) const;
+    const char *find_regex(const char *begin, const char *end) const;
+
+    std::string literal;
+    bool ignore_case;
+    bool is_regex = false;
+    std::regex regex;
+};
+
+int handle_search_request(int sock, gnutls_session_t ssl, int id, SearchRequest *request);
+int handle_search_cancel_request(int sock, gnutls_session_t ssl, int id, SearchCancelRequest *request);
+// Stops the searches of a closing connection. The socket stays open until they finish,
+// they hold the connection.
+void cancel_searches(int sock);
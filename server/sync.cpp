@@ -0,0 +1,105 @@
+#include "sync.h"
+
+#include "metrics.h"
+#include "pool.h"
+#include <algorithm>
+#include <cerrno>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+SyncScheduler::SyncScheduler(std::chrono::microseconds wait, size_t batch_limit, flush_function flush_one)
+    : window(wait), max_batch(std::max<size_t>(batch_limit, 1)), flush_file(std::move(flush_one)) {}
+
+int SyncScheduler::flush_to_disk(int fd, bool datasync) { return (datasync ? fdatasync(fd) : fsync(fd)) < 0 ? errno : 0; }
+
+int SyncScheduler::sync(int fd, bool datasync) {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex);
+    std::shared_ptr<Batch> batch = collecting;
+    const bool leader = batch == nullptr;
+    if (leader) {
+        batch = std::make_shared<Batch>();
+        collecting = batch;
+    }
+    size_t slot = batch->fds.size();
+    batch->fds.push_back(fd);
+    batch->datasync.push_back(datasync);
+
+    if (leader) {
+        // the others join while the disk is busy with the batch before
+        if (flushing > 0) {
+            full_cv.wait_for(lock, window, [&] { return batch->fds.size() >= max_batch; });
+        }
+        collecting = nullptr;
+        flushing++;
+        lock.unlock();
+        flush(*batch);
+        lock.lock();
+        flushing--;
+        batch->done = true;
+        done_cv.notify_all();
+    } else {
+        if (batch->fds.size() >= max_batch) {
+            full_cv.notify_all();
+        }
+        done_cv.wait(lock, [&] { return batch->done; });
+    }
+    int error = batch->errors[slot];
+    lock.unlock();
+    histogram("fsync_us").record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    return error;
+}
+
+void SyncScheduler::flush(Batch &batch) {
+    const size_t size = batch.fds.size();
+    histogram("fsync_batch").record(size);
+    batch.errors.assign(size, 0);
+
+    // the same file may be synced by several clients, it is flushed once, with fsync
+    // unless all of them asked for the data only
+    std::vector<struct stat> stats(size);
+    std::vector<size_t> unique;
+    std::vector<bool> datasync;
+    for (size_t i = 0; i < size; i++) {
+        if (fstat(batch.fds[i], &stats[i]) < 0) {
+            batch.errors[i] = errno;
+            continue;
+        }
+        auto same = std::find_if(unique.begin(), unique.end(), [&](size_t j) { return stats[j].st_dev == stats[i].st_dev && stats[j].st_ino == stats[i].st_ino; });
+        if (same == unique.end()) {
+            unique.push_back(i);
+            datasync.push_back(batch.datasync[i]);
+        } else if (!batch.datasync[i]) {
+            datasync[same - unique.begin()] = false;
+        }
+    }
+    if (unique.empty()) {
+        return;
+    }
+
+    // only the files of the batch are flushed, the file systems merge the concurrent
+    // flushes into fewer journal commits
+    std::vector<int> errors(size, 0);
+    worker_pool().parallel_for(unique.size(), [&](size_t k) {
+        size_t i = unique[k];
+        errors[i] = flush_file(batch.fds[i], datasync[k]);
+    });
+    for (size_t i = 0; i < size; i++) {
+        if (batch.errors[i] != 0) {
+            continue;
+        }
+        for (size_t j : unique) {
+            if (stats[j].st_dev == stats[i].st_dev && stats[j].st_ino == stats[i].st_ino) {
+                batch.errors[i] = errors[j];
+                break;
+            }
+        }
+    }
+}
+
+SyncScheduler &sync_scheduler() {
+    // a millisecond is less than a flush takes on most disks
+    static SyncScheduler scheduler(std::chrono::microseconds(1000), 64);
+    return scheduler;
+}
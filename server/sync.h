@@ -0,0 +1,51 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Group commit of the fsyncs of all clients. The first sync arriving while another
+// batch is on the disk waits a short window for more, then the files of the batch are
+// flushed in parallel and every request in it is answered when the flush is done. A sync
+// arriving on an idle disk is flushed right away, so a lone client does not wait the window.
+class SyncScheduler {
+  public:
+    // Flushes one file, returns 0 or the errno.
+    using flush_function = std::function<int(int fd, bool datasync)>;
+
+    SyncScheduler(std::chrono::microseconds wait, size_t batch_limit, flush_function flush_one = flush_to_disk);
+
+    // Flushes the file to the disk, only the data like fdatasync when datasync is set.
+    // Returns 0 or the errno of the flush.
+    int sync(int fd, bool datasync = false);
+
+    // fsync or fdatasync.
+    static int flush_to_disk(int fd, bool datasync);
+
+  private:
+    struct Batch {
+        std::vector<int> fds;
+        std::vector<bool> datasync;
+        std::vector<int> errors;
+        bool done = false;
+    };
+
+    void flush(Batch &batch);
+
+    const std::chrono::microseconds window;
+    const size_t max_batch;
+    const flush_function flush_file;
+
+    std::mutex mutex;
+    // woken when the collected batch is full
+    std::condition_variable full_cv;
+    std::condition_variable done_cv;
+    std::shared_ptr<Batch> collecting;
+    int flushing = 0;
+};
+
+// The scheduler of the fsync requests.
+SyncScheduler &sync_scheduler();
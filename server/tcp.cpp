@@ -1,120 +1,706 @@
 #include "tcp.h"
 #include "../common/io.h"
 #include "../common/log.h"
+#include "metrics.h"
+#include "pool.h"
+#include "exec.h"
+#include "export.h"
+#include "search.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fcntl.h>
 #include <gnutls/compat.h>
 #include <gnutls/gnutls.h>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <netdb.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <thread>
+#include <unistd.h>
+#include <vector>
 
-std::list<std::thread> threads;
-std::list<int> clients;
-std::list<gnutls_session_t> ssl_sessions;
+// The connections are served by a few reactor threads, each with its own epoll instance
+// and TCP listening socket (SO_REUSEPORT), the sockets of the plain transports are shared.
+// A reactor only does the TLS work, the requests are handled on a pool, so idle mounts
+// cost a socket and a session only.
+constexpr unsigned max_reactors = 4;
+constexpr int max_events = 64;
+constexpr size_t read_chunk = 64 * 1024;
+// A client which does not finish the handshake in time is dropped, it would hold a session forever.
+constexpr auto handshake_timeout = std::chrono::seconds(10);
 
-static void client_handler(int fd, gnutls_session_t ssl, recv_handlers handlers) {
-    while (true) {
-        int err = handle_recv(fd, ssl, handlers);
-        if (err < 0) {
-            log(ERROR, fd, "Error handling message: %s", strerror(errno));
+static recv_handlers handlers;
+static gnutls_certificate_credentials_t xcred;
+// reconnecting clients resume their sessions with tickets encrypted by this key
+static gnutls_datum_t ticket_key;
+
+// The handlers block on the disk and on the LSP servers, so there are more threads than cores.
+static ThreadPool &request_pool() {
+    static ThreadPool *pool = new ThreadPool(std::max(16u, 4 * std::thread::hardware_concurrency()));
+    return *pool;
+}
+
+// The messages of these types are handled one after another in the order of arrival,
+// the LSP servers expect the notifications in order and a cancel must not overtake its search or command.
+static bool is_ordered(int type) {
+    return type == Type::LSP_REQUEST || type == Type::SEARCH_REQUEST || type == Type::SEARCH_CANCEL_REQUEST || type == Type::EXEC_REQUEST ||
+           type == Type::EXEC_CANCEL_REQUEST;
+}
+
+struct Reactor;
+class TlsConnection;
+// Hands a connection which may read again to its reactor.
+static void resume_reading(Reactor &reactor, std::shared_ptr<TlsConnection> connection);
+
+// A client connection, ssl is null on the plain transports.
+class TlsConnection : public Connection {
+  public:
+    TlsConnection(int socket, Reactor &owner, int epoll, gnutls_session_t session) : fd(socket), epoll_fd(epoll), ssl(session), reactor(owner) {
+        if (ssl != nullptr) {
+            gnutls_session_set_ptr(ssl, this);
+        } else {
+            attach_connection(fd, this);
+            handshaken = true;
         }
-        if (err == 0) {
-            log(INFO, fd, "Closing connection");
-            gnutls_bye(ssl, GNUTLS_SHUT_RDWR);
-            close(fd);
+    }
+    ~TlsConnection() override {
+        if (ssl != nullptr) {
+            gnutls_deinit(ssl);
+        } else {
+            detach_connection(fd);
+        }
+        clear_locked();
+        forget_export(fd);
+        close(fd);
+    }
+
+    int send_frame(std::string frame) override { return queue_frame(std::move(frame), -1); }
+
+    int send_frame_with_descriptor(std::string frame, int descriptor) override {
+        if (ssl != nullptr) {
+            close(descriptor);
+            return -1;
+        }
+        return queue_frame(std::move(frame), descriptor);
+    }
+
+    // Called by the reactor when the socket is writable again.
+    void flush() {
+        {
+            std::lock_guard<std::mutex> lock(out_mutex);
+            flush_locked();
+        }
+        maybe_resume();
+    }
+
+    bool wait_for_room(std::chrono::milliseconds timeout) override {
+        std::unique_lock<std::mutex> lock(out_mutex);
+        return out_cv.wait_for(lock, timeout, [this] { return closed || out_bytes < max_credit_bytes; });
+    }
+
+    void dispatch(Header header, std::string body) {
+        auto self = std::static_pointer_cast<TlsConnection>(shared_from_this());
+        {
+            std::lock_guard<std::mutex> lock(credit_mutex);
+            pending++;
+            pending_bytes += request_cost(header, body.data());
+        }
+        if (!is_ordered(header.type)) {
+            request_pool().submit([self, header, body]() mutable { self->handle(header, body); });
             return;
         }
+        std::lock_guard<std::mutex> lock(ordered_mutex);
+        ordered.emplace_back(header, std::move(body));
+        if (ordered_running) {
+            return;
+        }
+        ordered_running = true;
+        request_pool().submit([self] { self->drain_ordered(); });
     }
-}
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wanalyzer-fd-leak"
-int listen(int port, recv_handlers handlers, std::string cert, std::string key) {
-    int sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0) {
-        perror("socket");
-        return 1;
+    // Stops sending and wakes up the reactor, which then closes the connection.
+    void abort() {
+        std::lock_guard<std::mutex> lock(out_mutex);
+        closed = true;
+        out_cv.notify_all();
+        shutdown(fd, SHUT_RDWR);
     }
-    struct sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-    addr.sin_addr.s_addr = INADDR_ANY;
 
-    gnutls_certificate_credentials_t xcred;
-    gnutls_global_init();
-    gnutls_certificate_allocate_credentials(&xcred);
-    gnutls_certificate_set_x509_key_file(xcred, cert.c_str(), key.c_str(), GNUTLS_X509_FMT_PEM);
-    gnutls_certificate_set_x509_system_trust(xcred);
-    gnutls_certificate_set_x509_trust_file(xcred, cert.c_str(), GNUTLS_X509_FMT_PEM);
+    void shutdown_tls() {
+        std::lock_guard<std::mutex> lock(out_mutex);
+        if (ssl != nullptr && handshaken && !closed) {
+            gnutls_bye(ssl, GNUTLS_SHUT_WR);
+        }
+        closed = true;
+        out_cv.notify_all();
+    }
+
+    // Called by the reactor before reading more, true when the client used up its credits.
+    // The reading stops until enough of the work is done, the client waits in the meantime.
+    bool pause_reading() {
+        {
+            std::lock_guard<std::mutex> lock(credit_mutex);
+            if (paused) {
+                return true;
+            }
+            if (!over_window()) {
+                return false;
+            }
+            paused = true;
+        }
+        // the reactor is the only one switching the reading, a resume is handled after this
+        set_reading(false);
+        counter("credit_pauses").fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void set_reading(bool read) {
+        std::lock_guard<std::mutex> lock(out_mutex);
+        reading = read;
+        update_events(reading, want_write);
+    }
+
+    // Sets the epoll events, EPOLLOUT while there are unsent frames.
+    void update_events(bool read_events, bool write_events) {
+        struct epoll_event event = {};
+        event.events = 0;
+        if (read_events) {
+            event.events |= EPOLLIN;
+        }
+        if (write_events) {
+            event.events |= EPOLLOUT;
+        }
+        event.data.fd = fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event);
+    }
+
+    const int fd;
+    const int epoll_fd;
+    gnutls_session_t ssl;
+    const std::chrono::steady_clock::time_point accepted = std::chrono::steady_clock::now();
+    bool handshaken = false;
+    std::string in;
+
+  private:
+    bool over_window() const { return pending >= max_credits || pending_bytes >= max_credit_bytes || out_bytes >= max_credit_bytes; }
+
+    // Gives the credits back when the work is done or the responses were sent.
+    void maybe_resume() {
+        {
+            std::lock_guard<std::mutex> lock(credit_mutex);
+            if (!paused || over_window()) {
+                return;
+            }
+            paused = false;
+        }
+        resume_reading(reactor, std::static_pointer_cast<TlsConnection>(shared_from_this()));
+    }
+
+    int queue_frame(std::string frame, int descriptor) {
+        const int size = frame.size();
+        {
+            std::lock_guard<std::mutex> lock(out_mutex);
+            if (closed) {
+                if (descriptor >= 0) {
+                    close(descriptor);
+                }
+                return -1;
+            }
+            bool queued = !out.empty();
+            out_bytes += size;
+            out.push_back(OutFrame{.data = std::move(frame), .descriptor = descriptor});
+            if (!queued && flush_locked() < 0) {
+                return -1;
+            }
+        }
+        maybe_resume();
+        return size;
+    }
+
+    // 0 when everything was sent or the rest waits for EPOLLOUT, -1 on error
+    int flush_locked() {
+        while (!out.empty()) {
+            OutFrame &frame = out.front();
+            ssize_t n;
+            if (frame.descriptor >= 0) {
+                // the descriptor goes with the first byte of the frame, it is sent only once
+                n = transport_send_descriptor(fd, frame.data.data() + out_offset, frame.data.size() - out_offset, frame.descriptor);
+                if (n > 0) {
+                    close(frame.descriptor);
+                    frame.descriptor = -1;
+                }
+            } else {
+                n = transport_send(fd, ssl, frame.data.data() + out_offset, frame.data.size() - out_offset);
+            }
+            if (n == GNUTLS_E_AGAIN || n == GNUTLS_E_INTERRUPTED) {
+                if (!want_write) {
+                    want_write = true;
+                    update_events(reading, true);
+                }
+                return 0;
+            }
+            if (n < 0) {
+                log(ERROR, fd, "Error sending message: %s", gnutls_strerror(n));
+                clear_locked();
+                out_bytes = 0;
+                closed = true;
+                out_cv.notify_all();
+                shutdown(fd, SHUT_RDWR);
+                return -1;
+            }
+            out_offset += n;
+            if (out_offset == frame.data.size()) {
+                out_bytes -= frame.data.size();
+                out.pop_front();
+                out_offset = 0;
+                out_cv.notify_all();
+            }
+        }
+        if (want_write) {
+            want_write = false;
+            update_events(reading, false);
+        }
+        return 0;
+    }
 
-    gnutls_priority_t priority_cache;
-    gnutls_priority_init(&priority_cache, "NORMAL", NULL);
+    void clear_locked() {
+        for (OutFrame &frame : out) {
+            if (frame.descriptor >= 0) {
+                close(frame.descriptor);
+            }
+        }
+        out.clear();
+    }
+
+    void handle(Header &header, std::string &body) {
+        // there is no directory to serve the request from
+        if (header.type != Type::INIT_REQUEST && find_export(fd) == nullptr) {
+            log(WARN, fd, "Request %d before an export was selected", header.id);
+            abort();
+        } else {
+            const int err = handle_message(fd, ssl, &header, body.data(), handlers);
+            if (err == -2) {
+                log(WARN, fd, "(%d) Unknown message type %d", header.id, header.type);
+            } else if (err < 0) {
+                log(ERROR, fd, "(%d) Error handling message of type %d: %s", header.id, header.type, strerror(errno));
+                counter("request_errors").fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(credit_mutex);
+            pending--;
+            pending_bytes -= request_cost(header, body.data());
+        }
+        maybe_resume();
+    }
 
-    constexpr int one = 1;
-    int err = setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
-    if (err < 0) {
-        log(ERROR, sock, "Error setting socket options: %s", strerror(errno));
-        return 1;
+    void drain_ordered() {
+        while (true) {
+            std::pair<Header, std::string> message;
+            {
+                std::lock_guard<std::mutex> lock(ordered_mutex);
+                if (ordered.empty()) {
+                    ordered_running = false;
+                    return;
+                }
+                message = std::move(ordered.front());
+                ordered.pop_front();
+            }
+            handle(message.first, message.second);
+        }
     }
-    if (bind(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
-        log(ERROR, sock, "Error bind port: %s", strerror(errno));
-        return 1;
+
+    Reactor &reactor;
+
+    std::mutex out_mutex;
+    std::condition_variable out_cv;
+    // the descriptor of a frame is owned by the connection until it is sent
+    struct OutFrame {
+        std::string data;
+        int descriptor;
+    };
+    std::deque<OutFrame> out;
+    size_t out_offset = 0;
+    // read without the lock by over_window, the lock order is out_mutex then credit_mutex
+    std::atomic<int64_t> out_bytes = 0;
+    bool reading = true;
+    bool want_write = false;
+    bool closed = false;
+
+    // the requests read from the socket and not handled yet
+    std::mutex credit_mutex;
+    int pending = 0;
+    int64_t pending_bytes = 0;
+    bool paused = false;
+
+    std::mutex ordered_mutex;
+    std::deque<std::pair<Header, std::string>> ordered;
+    bool ordered_running = false;
+};
+
+struct Reactor {
+    // the listening sockets of the endpoints
+    std::map<int, Endpoint> listeners;
+    int epoll_fd = -1;
+    // signalled when a paused connection may read again
+    int wake_fd = -1;
+    std::mutex mutex;
+    std::map<int, std::shared_ptr<TlsConnection>> connections;
+    std::vector<std::weak_ptr<TlsConnection>> resumed;
+    // connections in the order of accepting, which is also the order of their deadlines
+    std::deque<std::weak_ptr<TlsConnection>> handshakes;
+};
+
+static void resume_reading(Reactor &reactor, std::shared_ptr<TlsConnection> connection) {
+    {
+        std::lock_guard<std::mutex> lock(reactor.mutex);
+        reactor.resumed.push_back(connection);
     }
-    err = listen(sock, 10);
-    if (err < 0) {
-        log(ERROR, sock, "Error listening: %s", strerror(errno));
-        return 1;
+    uint64_t one = 1;
+    if (write(reactor.wake_fd, &one, sizeof(one)) < 0) {
+        log(ERROR, reactor.wake_fd, "Error waking reactor: %s", strerror(errno));
     }
+}
+
+static std::list<std::unique_ptr<Reactor>> reactors;
+static std::list<std::thread> threads;
 
-    log(INFO, sock, "Listening on port %d", port);
-    struct sockaddr_in client_addr;
-    socklen_t client_addr_len = sizeof(client_addr);
+static void close_connection(Reactor &reactor, const std::shared_ptr<TlsConnection> &connection) {
+    log(INFO, connection->fd, "Closing connection");
+    connection->shutdown_tls();
+    epoll_ctl(reactor.epoll_fd, EPOLL_CTL_DEL, connection->fd, nullptr);
+    // the socket is closed once the requests in flight and the searches release the connection
+    cancel_searches(connection->fd);
+    cancel_execs(connection.get());
+    std::lock_guard<std::mutex> lock(reactor.mutex);
+    reactor.connections.erase(connection->fd);
+}
+
+static void accept_connections(Reactor &reactor, int listen_fd, const Endpoint &endpoint) {
     while (true) {
+        struct sockaddr_storage client_addr = {};
+        socklen_t client_addr_len = sizeof(client_addr);
+        const int client_sock = accept4(listen_fd, reinterpret_cast<sockaddr *>(&client_addr), &client_addr_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_sock < 0) {
+            if (errno != EAGAIN && errno != EINTR) {
+                log(ERROR, listen_fd, "Error accepting connection: %s", strerror(errno));
+            }
+            return;
+        }
+
+        if (endpoint.transport != Endpoint::TLS) {
+            if (!peer_allowed(client_sock, endpoint)) {
+                close(client_sock);
+                continue;
+            }
+            auto connection = std::make_shared<TlsConnection>(client_sock, reactor, reactor.epoll_fd, nullptr);
+            struct epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = client_sock;
+            if (epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, client_sock, &event) < 0) {
+                log(ERROR, client_sock, "Error adding connection to epoll: %s", strerror(errno));
+                continue;
+            }
+            log(INFO, client_sock, "Accepted connection on %s", endpoint_name(endpoint).c_str());
+            std::lock_guard<std::mutex> lock(reactor.mutex);
+            reactor.connections[client_sock] = connection;
+            continue;
+        }
 
         gnutls_session_t ssl_session;
-        gnutls_init(&ssl_session, GNUTLS_SERVER);
+        gnutls_init(&ssl_session, GNUTLS_SERVER | GNUTLS_NONBLOCK | GNUTLS_NO_SIGNAL);
         gnutls_set_default_priority(ssl_session);
         gnutls_session_set_verify_cert(ssl_session, NULL, 0);
         gnutls_credentials_set(ssl_session, GNUTLS_CRD_CERTIFICATE, xcred);
-
         gnutls_certificate_server_set_request(ssl_session, GNUTLS_CERT_REQUEST);
+        gnutls_session_ticket_enable_server(ssl_session, &ticket_key);
+        gnutls_transport_set_int(ssl_session, client_sock);
 
-        const int client_sock = accept(sock, reinterpret_cast<sockaddr *>(&client_addr), &client_addr_len);
-        if (client_sock < 0) {
-            log(ERROR, sock, "Error accepting connection: %s", strerror(errno));
-            return 1;
+        auto connection = std::make_shared<TlsConnection>(client_sock, reactor, reactor.epoll_fd, ssl_session);
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = client_sock;
+        if (epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, client_sock, &event) < 0) {
+            log(ERROR, client_sock, "Error adding connection to epoll: %s", strerror(errno));
+            continue;
         }
+        char host[NI_MAXHOST] = "";
+        char port[NI_MAXSERV] = "";
+        getnameinfo(reinterpret_cast<sockaddr *>(&client_addr), client_addr_len, host, sizeof(host), port, sizeof(port), NI_NUMERICHOST | NI_NUMERICSERV);
+        log(DEBUG, client_sock, "Connection from %s port %s", host, port);
+        reactor.handshakes.push_back(connection);
+        std::lock_guard<std::mutex> lock(reactor.mutex);
+        reactor.connections[client_sock] = connection;
+    }
+}
 
-        gnutls_transport_set_int(ssl_session, client_sock);
+// false when the handshake failed
+static bool handshake(TlsConnection &connection) {
+    while (true) {
+        int err = gnutls_handshake(connection.ssl);
+        if (err == 0) {
+            connection.handshaken = true;
+            connection.update_events(true, false);
+            auto latency = std::chrono::steady_clock::now() - connection.accepted;
+            histogram("tls_handshake_us").record(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+            log(INFO, connection.fd, "Accepted connection");
+            return true;
+        }
+        if (err == GNUTLS_E_AGAIN || err == GNUTLS_E_INTERRUPTED) {
+            bool writing = gnutls_record_get_direction(connection.ssl) == 1;
+            connection.update_events(!writing, writing);
+            return true;
+        }
+        if (gnutls_error_is_fatal(err)) {
+            log(ERROR, connection.fd, "GnuTLS handshake failed: %s", gnutls_strerror(err));
+            counter("tls_handshake_failed").fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+}
+
+// Dispatches the complete frames read so far while the client has credits, false on a malformed frame.
+static bool dispatch_frames(TlsConnection &connection) {
+    size_t offset = 0;
+    bool valid = true;
+    while (connection.in.size() - offset >= static_cast<size_t>(HEADER_SIZE) && !connection.pause_reading()) {
+        Header header;
+        deserialize(connection.in.data() + offset, &header);
+        if (header.size < 0 || header.size > max_frame_size) {
+            log(ERROR, connection.fd, "Invalid message size %d", header.size);
+            valid = false;
+            break;
+        }
+        if (connection.in.size() - offset - HEADER_SIZE < static_cast<size_t>(header.size)) {
+            break;
+        }
+        log(DEBUG, connection.fd, "Received header: size %d id %d type %d", header.size, header.id, header.type);
+        connection.dispatch(header, connection.in.substr(offset + HEADER_SIZE, header.size));
+        offset += HEADER_SIZE + header.size;
+    }
+    connection.in.erase(0, offset);
+    return valid;
+}
+
+// Reads until the socket is drained or the client ran out of credits and dispatches
+// the complete frames, false on EOF or error.
+static bool read_messages(TlsConnection &connection) {
+    char buffer[read_chunk];
+    while (true) {
+        if (!dispatch_frames(connection)) {
+            return false;
+        }
+        if (connection.pause_reading()) {
+            return true;
+        }
+        ssize_t n = transport_recv(connection.fd, connection.ssl, buffer, sizeof(buffer));
+        if (n == GNUTLS_E_AGAIN) {
+            return true;
+        }
+        if (n == GNUTLS_E_INTERRUPTED) {
+            continue;
+        }
+        if (n == 0 || n == GNUTLS_E_PREMATURE_TERMINATION) {
+            return false;
+        }
+        if (n < 0) {
+            if (gnutls_error_is_fatal(n)) {
+                log(ERROR, connection.fd, "Error receiving message: %s", gnutls_strerror(n));
+                return false;
+            }
+            continue;
+        }
+        connection.in.append(buffer, n);
+    }
+}
+
+// Reads again from the connections which got their credits back.
+static void resume_connections(Reactor &reactor) {
+    uint64_t value;
+    if (read(reactor.wake_fd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+        log(ERROR, reactor.wake_fd, "Error reading wake up: %s", strerror(errno));
+    }
+    std::vector<std::weak_ptr<TlsConnection>> resumed;
+    {
+        std::lock_guard<std::mutex> lock(reactor.mutex);
+        resumed.swap(reactor.resumed);
+    }
+    for (auto &weak : resumed) {
+        auto connection = weak.lock();
+        if (connection == nullptr) {
+            continue;
+        }
+        {
+            // the connection was closed in the meantime
+            std::lock_guard<std::mutex> lock(reactor.mutex);
+            auto it = reactor.connections.find(connection->fd);
+            if (it == reactor.connections.end() || it->second != connection) {
+                continue;
+            }
+        }
+        connection->set_reading(true);
+        if (!read_messages(*connection)) {
+            close_connection(reactor, connection);
+        }
+    }
+}
+
+// Drops the connections whose handshake is overdue, returns the epoll timeout until the next deadline.
+static int expire_handshakes(Reactor &reactor) {
+    auto now = std::chrono::steady_clock::now();
+    while (!reactor.handshakes.empty()) {
+        auto connection = reactor.handshakes.front().lock();
+        if (connection == nullptr || connection->handshaken) {
+            reactor.handshakes.pop_front();
+            continue;
+        }
+        auto deadline = connection->accepted + handshake_timeout;
+        if (deadline > now) {
+            return std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count();
+        }
+        reactor.handshakes.pop_front();
+        log(ERROR, connection->fd, "GnuTLS handshake timed out");
+        counter("tls_handshake_timeout").fetch_add(1, std::memory_order_relaxed);
+        close_connection(reactor, connection);
+    }
+    return -1;
+}
+
+static void run_reactor(Reactor &reactor) {
+    struct epoll_event events[max_events];
+    while (true) {
+        int count = epoll_wait(reactor.epoll_fd, events, max_events, expire_handshakes(reactor));
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            log(ERROR, reactor.epoll_fd, "Error waiting for events: %s", strerror(errno));
+            return;
+        }
+        for (int i = 0; i < count; i++) {
+            if (auto listener = reactor.listeners.find(events[i].data.fd); listener != reactor.listeners.end()) {
+                accept_connections(reactor, listener->first, listener->second);
+                continue;
+            }
+            if (events[i].data.fd == reactor.wake_fd) {
+                resume_connections(reactor);
+                continue;
+            }
+            std::shared_ptr<TlsConnection> connection;
+            {
+                std::lock_guard<std::mutex> lock(reactor.mutex);
+                auto it = reactor.connections.find(events[i].data.fd);
+                if (it == reactor.connections.end()) {
+                    continue;
+                }
+                connection = it->second;
+            }
+
+            bool alive = true;
+            if (!connection->handshaken) {
+                alive = handshake(*connection);
+            } else if (events[i].events & EPOLLOUT) {
+                connection->flush();
+            }
+            const bool hung_up = (events[i].events & (EPOLLHUP | EPOLLERR)) != 0;
+            if (alive && connection->handshaken && (hung_up || (events[i].events & EPOLLIN))) {
+                // the frames sent before the hang up are read first, the read ends at the end of the stream
+                alive = read_messages(*connection);
+                if (alive && hung_up) {
+                    // paused with frames left, the hang up is reported until the resume reads the rest
+                    epoll_ctl(reactor.epoll_fd, EPOLL_CTL_DEL, connection->fd, nullptr);
+                }
+            } else if (hung_up) {
+                alive = false;
+            }
+            if (!alive) {
+                close_connection(reactor, connection);
+            }
+        }
+    }
+}
 
-        clients.push_back(client_sock);
+int listen(const std::vector<Endpoint> &endpoints, recv_handlers recv_handlers, std::string cert, std::string key) {
+    handlers = recv_handlers;
+    gnutls_global_init();
+    gnutls_certificate_allocate_credentials(&xcred);
+    if (!cert.empty()) {
+        gnutls_certificate_set_x509_key_file(xcred, cert.c_str(), key.c_str(), GNUTLS_X509_FMT_PEM);
+        gnutls_certificate_set_x509_system_trust(xcred);
+        gnutls_certificate_set_x509_trust_file(xcred, cert.c_str(), GNUTLS_X509_FMT_PEM);
+    }
+    gnutls_session_ticket_key_generate(&ticket_key);
 
-        err = gnutls_handshake(ssl_session);
-        if (err < 0) {
-            log(ERROR, sock, "GnuTLS handshake failed: %s", gnutls_strerror(err));
-            gnutls_bye(ssl_session, GNUTLS_SHUT_RDWR);
-            gnutls_deinit(ssl_session);
+    // one socket of every plain endpoint is woken up in a single reactor at a time (EPOLLEXCLUSIVE)
+    std::map<int, Endpoint> shared;
+    for (const auto &endpoint : endpoints) {
+        if (endpoint.transport == Endpoint::TLS) {
             continue;
         }
-        ssl_sessions.push_back(ssl_session);
-        log(INFO, client_sock, "Accepted connection from %s:%d", inet_ntoa(client_addr.sin_addr), ntohs(client_addr.sin_port));
+        int sock = listen_endpoint(endpoint);
+        if (sock < 0) {
+            return 1;
+        }
+        shared[sock] = endpoint;
+    }
+
+    const unsigned count = std::clamp(std::thread::hardware_concurrency(), 1u, max_reactors);
+    for (unsigned i = 0; i < count; i++) {
+        auto reactor = std::make_unique<Reactor>();
+        reactor->listeners = shared;
+        for (const auto &endpoint : endpoints) {
+            if (endpoint.transport != Endpoint::TLS) {
+                continue;
+            }
+            int sock = listen_endpoint(endpoint);
+            if (sock < 0) {
+                return 1;
+            }
+            reactor->listeners[sock] = endpoint;
+        }
+        reactor->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        reactor->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (reactor->epoll_fd < 0 || reactor->wake_fd < 0) {
+            return 1;
+        }
+        struct epoll_event event = {};
+        for (const auto &[sock, endpoint] : reactor->listeners) {
+            event.events = endpoint.transport == Endpoint::TLS ? EPOLLIN : EPOLLIN | EPOLLEXCLUSIVE;
+            event.data.fd = sock;
+            epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, sock, &event);
+        }
+        event.events = EPOLLIN;
+        event.data.fd = reactor->wake_fd;
+        epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, reactor->wake_fd, &event);
+        reactors.push_back(std::move(reactor));
+    }
+    for (const auto &endpoint : endpoints) {
+        log(INFO, "Listening on %s with %u reactors", endpoint_name(endpoint).c_str(), count);
+    }
 
-        std::thread t(client_handler, client_sock, ssl_session, handlers);
-        threads.push_back(std::move(t));
+    for (auto it = std::next(reactors.begin()); it != reactors.end(); it++) {
+        threads.emplace_back(run_reactor, std::ref(**it));
     }
+    run_reactor(*reactors.front());
+
     gnutls_certificate_free_credentials(xcred);
     gnutls_global_deinit();
     return 0;
 }
-#pragma GCC diagnostic pop
 
 int close_connections() {
-    for (auto &c : clients) {
-        close(c);
-    }
-    for (auto &s : ssl_sessions) {
-        gnutls_bye(s, GNUTLS_SHUT_RDWR);
-        gnutls_deinit(s);
+    for (auto &reactor : reactors) {
+        std::lock_guard<std::mutex> lock(reactor->mutex);
+        for (auto &[fd, connection] : reactor->connections) {
+            connection->abort();
+        }
     }
     for (auto &t : threads) {
         t.detach();
@@ -1,7 +1,17 @@
 #pragma once
 #include "../common/io.h"
+#include <cstdint>
 #include <string>
+#include <vector>
 
-int listen(int port, recv_handlers hadnlers, std::string cert, std::string key);
+// The credit window of a connection. The server stops reading from a client while this
+// many requests or bytes of requests are not handled yet, or while this many bytes of
+// responses are not sent, so a client can not make the server buffer more than that.
+constexpr int max_credits = 256;
+constexpr int64_t max_credit_bytes = 64 << 20;
+// A larger frame closes the connection.
+constexpr int64_t max_frame_size = 2 * max_credit_bytes;
+
+int listen(const std::vector<Endpoint> &endpoints, recv_handlers hadnlers, std::string cert, std::string key);
 
 int close_connections();
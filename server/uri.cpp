@@ -0,0 +1,78 @@
+#include "uri.h"
+
+#include <cctype>
+#include <cstring>
+
+static bool is_unreserved(unsigned char c) { return std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~' || c == '/'; }
+
+std::string url_encode(std::string_view path) {
+    static const char digits[] = "0123456789ABCDEF";
+    std::string encoded;
+    encoded.reserve(path.size());
+    for (const unsigned char c : path) {
+        if (is_unreserved(c)) {
+            encoded.push_back(c);
+        } else {
+            encoded.push_back('%');
+            encoded.push_back(digits[c >> 4]);
+            encoded.push_back(digits[c & 15]);
+        }
+    }
+    return encoded;
+}
+
+PathRewriter::PathRewriter(std::string from, std::string to)
+    : raw_from(std::move(from)), raw_to(std::move(to)), encoded_from(url_encode(raw_from)), encoded_to(url_encode(raw_to)) {}
+
+size_t PathRewriter::match_encoded(const char *p, const char *end) const {
+    if (static_cast<size_t>(end - p) < encoded_from.size()) {
+        return 0;
+    }
+    for (size_t i = 0; i < encoded_from.size(); i++) {
+        const char c = encoded_from[i];
+        // the clients differ in the case of the escapes, %3a and %3A
+        const bool escape = (i >= 1 && encoded_from[i - 1] == '%') || (i >= 2 && encoded_from[i - 2] == '%');
+        if (escape ? std::toupper(static_cast<unsigned char>(p[i])) != c : p[i] != c) {
+            return 0;
+        }
+    }
+    return encoded_from.size();
+}
+
+std::string_view PathRewriter::rewrite(std::string_view message) {
+    if (raw_from.empty() || raw_from == raw_to) {
+        return message;
+    }
+    buffer.clear();
+    const bool encoded = encoded_from != raw_from;
+    // both forms start with the same character (a slash), memchr finds the candidates
+    const char first = raw_from[0];
+    const char *p = message.data();
+    const char *end = p + message.size();
+    const char *copied = p;
+    while ((p = static_cast<const char *>(memchr(p, first, end - p))) != nullptr) {
+        size_t length = 0;
+        const std::string *replacement = &raw_to;
+        if (static_cast<size_t>(end - p) >= raw_from.size() && memcmp(p, raw_from.data(), raw_from.size()) == 0) {
+            length = raw_from.size();
+        } else if (encoded && (length = match_encoded(p, end)) != 0) {
+            replacement = &encoded_to;
+        }
+        if (length == 0) {
+            p++;
+            continue;
+        }
+        if (buffer.empty()) {
+            buffer.reserve(message.size() + message.size() / 8);
+        }
+        buffer.append(copied, p);
+        buffer.append(*replacement);
+        p += length;
+        copied = p;
+    }
+    if (copied == message.data()) {
+        return message;
+    }
+    buffer.append(copied, end);
+    return buffer;
+}
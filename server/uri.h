@@ -0,0 +1,30 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+// Replaces a path in the messages of the language servers, both as it is and percent
+// encoded as in the file URIs. The message is scanned once, the result is built in a
+// buffer which is reused by the next message.
+class PathRewriter {
+  public:
+    PathRewriter() = default;
+    PathRewriter(std::string from, std::string to);
+
+    const std::string &from() const { return raw_from; }
+    const std::string &to() const { return raw_to; }
+    // The rewritten message, valid until the next call.
+    std::string_view rewrite(std::string_view message);
+
+  private:
+    // the length of the encoded path matching at p (the hex digits in any case), 0 when there is no match
+    size_t match_encoded(const char *p, const char *end) const;
+
+    std::string raw_from;
+    std::string raw_to;
+    std::string encoded_from;
+    std::string encoded_to;
+    std::string buffer;
+};
+
+// Percent encodes everything but the unreserved characters and the slashes.
+std::string url_encode(std::string_view path);
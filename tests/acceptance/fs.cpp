@@ -94,6 +94,29 @@ TEST_CASE("readdir") {
     remove("project-dir/test-dir");
 }
 
+TEST_CASE("readdir large directory") {
+    // several pages of the server, the kernel moves from one to the next
+    mkdir("project-dir/readdir-large", 0755);
+    for (int i = 0; i < 20000; i++) {
+        std::string name = "project-dir/readdir-large/entry-with-a-longer-name-" + std::to_string(i);
+        int fd = open(name.c_str(), O_RDWR | O_CREAT, 0644);
+        close(fd);
+    }
+    DIR *dir = opendir("mount-dir/readdir-large");
+    REQUIRE(dir != nullptr);
+    for (int pass = 0; pass < 2; pass++) {
+        std::list<std::string> entries;
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != nullptr) {
+            entries.push_back(entry->d_name);
+        }
+        REQUIRE(entries.size() == 20002);
+        rewinddir(dir);
+    }
+    closedir(dir);
+    std::filesystem::remove_all("project-dir/readdir-large");
+}
+
 TEST_CASE("read") {
     int fd = open("project-dir/read.txt", O_RDWR | O_CREAT, 0644);
     REQUIRE(fd >= 0);
@@ -524,3 +547,30 @@ TEST_CASE("lseek") {
     close(fd);
     remove("project-dir/lseek.txt");
 }
+
+TEST_CASE("copy_file_range") {
+    int fd = open("project-dir/copy_file_range.txt", O_RDWR | O_CREAT, 0644);
+    REQUIRE(fd >= 0);
+    int err = write(fd, "123456789", 9);
+    REQUIRE(err == 9);
+    close(fd);
+    int fd_in = open("mount-dir/copy_file_range.txt", O_RDONLY);
+    REQUIRE(fd_in >= 0);
+    int fd_out = open("mount-dir/copy_file_range_out.txt", O_RDWR | O_CREAT, 0644);
+    REQUIRE(fd_out >= 0);
+    off_t offset_in = 2;
+    off_t offset_out = 0;
+    ssize_t size = copy_file_range(fd_in, &offset_in, fd_out, &offset_out, 5, 0);
+    REQUIRE(size == 5);
+    close(fd_in);
+    close(fd_out);
+    char buf[10] = {0};
+    fd = open("project-dir/copy_file_range_out.txt", O_RDONLY);
+    REQUIRE(fd >= 0);
+    err = read(fd, buf, sizeof(buf));
+    REQUIRE(err == 5);
+    REQUIRE(strcmp(buf, "34567") == 0);
+    close(fd);
+    remove("project-dir/copy_file_range.txt");
+    remove("project-dir/copy_file_range_out.txt");
+}
@@ -0,0 +1,61 @@
+#include "../../filesystem/attr.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+namespace {
+
+GetAttrResponse file_attr(int size) {
+    GetAttrResponse attr;
+    attr.set_error(0);
+    attr.set_mode(0100644);
+    attr.set_size(size);
+    return attr;
+}
+
+bool cached(const std::string &path) {
+    GetAttrResponse attr;
+    return find_attr(path, &attr);
+}
+
+} // namespace
+
+TEST_CASE("Attribute cache") {
+    // the cache is global, the paths are not used by the other tests
+    const std::string dir = "/attr-test";
+    store_attr(dir, file_attr(0));
+    store_attr(dir + "/a", file_attr(1));
+    store_attr(dir + "/a/b", file_attr(2));
+    store_attr(dir + "/a/b/c", file_attr(3));
+    store_attr(dir + "/a-b", file_attr(4));
+    store_attr(dir + "/ab", file_attr(5));
+
+    SECTION("Lookup") {
+        GetAttrResponse attr;
+        REQUIRE(find_attr(dir + "/a/b", &attr));
+        REQUIRE(attr.size() == 2);
+        REQUIRE_FALSE(find_attr(dir + "/missing", &attr));
+        // a newer result replaces the older one
+        store_attr(dir + "/a/b", file_attr(7));
+        REQUIRE(find_attr(dir + "/a/b", &attr));
+        REQUIRE(attr.size() == 7);
+    }
+
+    SECTION("A change drops the path, what is below it and its parent") {
+        invalidate_attr(dir + "/a");
+        REQUIRE_FALSE(cached(dir + "/a"));
+        REQUIRE_FALSE(cached(dir + "/a/b"));
+        REQUIRE_FALSE(cached(dir + "/a/b/c"));
+        REQUIRE_FALSE(cached(dir));
+        // the names sharing the prefix are other files
+        REQUIRE(cached(dir + "/a-b"));
+        REQUIRE(cached(dir + "/ab"));
+    }
+
+    SECTION("A change of the root drops everything") {
+        invalidate_attr("/");
+        REQUIRE_FALSE(cached(dir));
+        REQUIRE_FALSE(cached(dir + "/ab"));
+    }
+
+    invalidate_attr(dir);
+}
@@ -0,0 +1,116 @@
+#include "../../server/cache.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+namespace {
+
+// Two files in a directory removed at the end of the test.
+struct cache_files {
+    std::string a;
+    std::string b;
+    std::string dir;
+
+    cache_files() {
+        std::string pattern = (std::filesystem::temp_directory_path() / "tea-cache-XXXXXX").string();
+        REQUIRE(mkdtemp(pattern.data()) != nullptr);
+        dir = pattern;
+        a = dir + "/a.txt";
+        b = dir + "/b.txt";
+        std::ofstream(a) << "a";
+        std::ofstream(b) << "b";
+    }
+    ~cache_files() { std::filesystem::remove_all(dir); }
+};
+
+// Opens the file the way the server does on a miss.
+int open_tracked(FileCache &cache, const std::string &path, struct stat &st) {
+    REQUIRE(stat(path.c_str(), &st) == 0);
+    int fd = open(path.c_str(), O_RDONLY);
+    REQUIRE(fd >= 0);
+    cache.track(fd, st, O_RDONLY);
+    return fd;
+}
+
+} // namespace
+
+TEST_CASE("Open file cache") {
+    cache_files files;
+    FileCache cache(2);
+    struct stat st = {};
+
+    SECTION("Hit") {
+        int fd = open_tracked(cache, files.a, st);
+        REQUIRE(cache.release(fd));
+        REQUIRE(cache.acquire(st, O_RDONLY) == fd);
+        // handed out, not idle any more
+        REQUIRE(cache.acquire(st, O_RDONLY) == -1);
+        REQUIRE(cache.release(fd));
+    }
+
+    SECTION("Miss") {
+        REQUIRE_FALSE(FileCache::cacheable(O_RDWR));
+        REQUIRE(FileCache::cacheable(O_RDONLY | O_CLOEXEC));
+        REQUIRE(cache.acquire(st, O_RDONLY) == -1);
+        // not tracked, the caller closes it
+        int fd = open(files.a.c_str(), O_RDONLY);
+        REQUIRE_FALSE(cache.release(fd));
+        close(fd);
+
+        fd = open_tracked(cache, files.a, st);
+        REQUIRE(cache.release(fd));
+        struct stat other;
+        REQUIRE(stat(files.b.c_str(), &other) == 0);
+        REQUIRE(cache.acquire(other, O_RDONLY) == -1);
+        REQUIRE(cache.acquire(st, O_RDONLY | O_NONBLOCK) == -1);
+
+        // changed since the release
+        std::ofstream(files.a) << "changed";
+        struct stat changed;
+        REQUIRE(stat(files.a.c_str(), &changed) == 0);
+        REQUIRE(cache.acquire(changed, O_RDONLY) == -1);
+    }
+
+    SECTION("Invalidation and eviction") {
+        int fd = open_tracked(cache, files.a, st);
+        REQUIRE(cache.release(fd));
+        cache.invalidate(files.a);
+        REQUIRE(cache.acquire(st, O_RDONLY) == -1);
+
+        struct stat st_b;
+        int fd_a = open_tracked(cache, files.a, st);
+        int fd_b = open_tracked(cache, files.b, st_b);
+        int fd_a2 = open(files.a.c_str(), O_RDONLY);
+        cache.track(fd_a2, st, O_RDONLY);
+        REQUIRE(cache.release(fd_a));
+        REQUIRE(cache.release(fd_b));
+        // the least recently released one is closed
+        REQUIRE(cache.release(fd_a2));
+        REQUIRE(cache.acquire(st_b, O_RDONLY) == fd_b);
+        REQUIRE(cache.acquire(st, O_RDONLY) == fd_a2);
+        REQUIRE(cache.acquire(st, O_RDONLY) == -1);
+        REQUIRE(cache.release(fd_b));
+        REQUIRE(cache.release(fd_a2));
+    }
+
+    SECTION("Reused descriptor") {
+        int fd = open_tracked(cache, files.a, st);
+        // closed without a release, the number goes to another file
+        close(fd);
+        int reused = open(files.b.c_str(), O_RDONLY);
+        REQUIRE(reused == fd);
+        REQUIRE_FALSE(cache.release(reused));
+        close(reused);
+
+        fd = open_tracked(cache, files.a, st);
+        close(fd);
+        reused = open(files.a.c_str(), O_RDWR);
+        REQUIRE(reused == fd);
+        REQUIRE_FALSE(cache.release(reused));
+        close(reused);
+        REQUIRE(cache.acquire(st, O_RDONLY) == -1);
+    }
+}
@@ -34,3 +34,39 @@ static std::pair<int, int> testing_socket() {
     }
     return std::pair(fd[0], fd[1]);
 }
+
+TEST_CASE("Endpoint parsing") {
+    Endpoint endpoint;
+    REQUIRE(parse_endpoint("10.0.0.1", 5210, &endpoint));
+    REQUIRE(endpoint.transport == Endpoint::TLS);
+    REQUIRE(endpoint.address == "10.0.0.1");
+    REQUIRE(endpoint.port == 5210);
+
+    REQUIRE(parse_endpoint("tls://example.com:6000", 5210, &endpoint));
+    REQUIRE(endpoint.transport == Endpoint::TLS);
+    REQUIRE(endpoint.address == "example.com");
+    REQUIRE(endpoint.port == 6000);
+
+    REQUIRE(parse_endpoint("tls://[::1]:6000", 5210, &endpoint));
+    REQUIRE(endpoint.address == "::1");
+    REQUIRE(endpoint.port == 6000);
+    REQUIRE(endpoint_name(endpoint) == "tls://[::1]:6000");
+    REQUIRE(parse_endpoint("[fe80::1]", 5210, &endpoint));
+    REQUIRE(endpoint.address == "fe80::1");
+    REQUIRE(endpoint.port == 5210);
+
+    REQUIRE(parse_endpoint("unix:///run/tea.sock", 5210, &endpoint));
+    REQUIRE(endpoint.transport == Endpoint::UNIX);
+    REQUIRE(endpoint.address == "/run/tea.sock");
+
+    REQUIRE(parse_endpoint("vsock://3:7000", 5210, &endpoint));
+    REQUIRE(endpoint.transport == Endpoint::VSOCK);
+    REQUIRE(endpoint.cid == 3);
+    REQUIRE(endpoint.port == 7000);
+
+    REQUIRE_FALSE(parse_endpoint("unix://relative.sock", 5210, &endpoint));
+    REQUIRE_FALSE(parse_endpoint("tls://host:port", 5210, &endpoint));
+    REQUIRE_FALSE(parse_endpoint("http://host", 5210, &endpoint));
+    REQUIRE_FALSE(parse_endpoint("tls://[::1", 5210, &endpoint));
+    REQUIRE_FALSE(parse_endpoint("tls://[::1]6000", 5210, &endpoint));
+}
@@ -0,0 +1,17 @@
+#include "../../server/export.h"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Export containment") {
+    Export ex("", "/srv/project");
+    REQUIRE(ex.contains("/srv/project"));
+    REQUIRE(ex.contains("/srv/project/"));
+    REQUIRE(ex.contains("/srv/project/src/main.cpp"));
+    REQUIRE_FALSE(ex.contains("/srv/project-secrets"));
+    REQUIRE_FALSE(ex.contains("/srv/project2/a"));
+    REQUIRE_FALSE(ex.contains("/srv"));
+    REQUIRE_FALSE(ex.contains("/etc/passwd"));
+
+    Export root("", "/");
+    REQUIRE(root.contains("/"));
+    REQUIRE(root.contains("/etc/passwd"));
+}
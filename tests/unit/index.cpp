@@ -0,0 +1,114 @@
+#include "../../server/index.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+// A directory with a few files, removed at the end of the test.
+struct project_dir {
+    std::string path;
+
+    project_dir() {
+        std::string pattern = (std::filesystem::temp_directory_path() / "tea-index-XXXXXX").string();
+        REQUIRE(mkdtemp(pattern.data()) != nullptr);
+        path = pattern;
+        write("/a.txt", "hello");
+        std::filesystem::create_directory(path + "/src");
+        write("/src/main.cpp", "int main() {}");
+        std::filesystem::create_symlink("a.txt", path + "/link");
+    }
+    ~project_dir() { std::filesystem::remove_all(path); }
+
+    void write(const std::string &name, const std::string &content) const { std::ofstream(path + name) << content; }
+};
+
+// Waits for the background work of the index, false when it did not happen in time.
+template <typename Condition> bool eventually(Condition condition) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+bool has_entry(const std::vector<index_entry> &entries, const std::string &name) {
+    return std::any_of(entries.begin(), entries.end(), [&](const index_entry &entry) { return entry.name == name; });
+}
+
+} // namespace
+
+TEST_CASE("Metadata index") {
+    project_dir dir;
+    MetadataIndex index(dir.path);
+    struct stat st;
+    REQUIRE(index.stat("/a.txt", &st) == -1);
+    index.start(2);
+    REQUIRE(eventually([&] { return index.ready(); }));
+
+    SECTION("Lookup") {
+        REQUIRE(index.stat("/a.txt", &st) == 0);
+        REQUIRE(S_ISREG(st.st_mode));
+        REQUIRE(st.st_size == 5);
+        REQUIRE(index.stat("/src/main.cpp", &st) == 0);
+        REQUIRE(index.stat("/", &st) == 0);
+        REQUIRE(S_ISDIR(st.st_mode));
+        REQUIRE(index.stat("/link", &st) == 0);
+        REQUIRE(S_ISLNK(st.st_mode));
+        REQUIRE(index.stat("/missing", &st) == ENOENT);
+        REQUIRE(index.stat("/a.txt/x", &st) == ENOTDIR);
+        // left to the syscall
+        REQUIRE(index.stat("/src/../a.txt", &st) == -1);
+        REQUIRE(index.stat("/link/x", &st) == -1);
+
+        std::vector<index_entry> entries;
+        REQUIRE(index.list("/src", entries) == 0);
+        REQUIRE(entries.size() == 3);
+        REQUIRE(has_entry(entries, "."));
+        REQUIRE(has_entry(entries, "main.cpp"));
+        entries.clear();
+        REQUIRE(index.list("/a.txt", entries) == ENOTDIR);
+    }
+
+    SECTION("Access") {
+        REQUIRE(index.access("/a.txt", F_OK) == 0);
+        REQUIRE(index.access("/a.txt", R_OK) == ::access((dir.path + "/a.txt").c_str(), R_OK));
+        REQUIRE(index.access("/a.txt", X_OK) == EACCES);
+        REQUIRE(index.access("/src", X_OK) == 0);
+        REQUIRE(index.access("/missing", F_OK) == ENOENT);
+        // the target of the link is checked by the syscall
+        REQUIRE(index.access("/link", R_OK) == -1);
+        REQUIRE(index.access("/link", F_OK) == -1);
+    }
+
+    SECTION("Invalidation") {
+        dir.write("/b.txt", "new");
+        REQUIRE(eventually([&] { return index.stat("/b.txt", &st) == 0; }));
+        std::vector<index_entry> entries;
+        REQUIRE(index.list("/", entries) == 0);
+        REQUIRE(has_entry(entries, "b.txt"));
+
+        std::filesystem::create_directory(dir.path + "/include");
+        dir.write("/include/a.h", "#pragma once");
+        REQUIRE(eventually([&] { return index.stat("/include/a.h", &st) == 0; }));
+
+        std::filesystem::remove(dir.path + "/b.txt");
+        REQUIRE(eventually([&] { return index.stat("/b.txt", &st) == ENOENT; }));
+        std::filesystem::remove_all(dir.path + "/include");
+        REQUIRE(eventually([&] { return index.stat("/include", &st) == ENOENT; }));
+
+        // the changes made by the server itself are seen right away
+        dir.write("/a.txt", "hello world");
+        index.refresh("/a.txt");
+        REQUIRE(index.stat("/a.txt", &st) == 0);
+        REQUIRE(st.st_size == 11);
+    }
+}
@@ -0,0 +1,59 @@
+#include "../../common/json.h"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("JSON member scanning") {
+    const std::string message = R"({"jsonrpc": "2.0", "id": 7, "method": "textDocument/hover", "params": {"textDocument": {"uri": "file:///a.cpp"}}})";
+    REQUIRE(json_string(message, "method") == "textDocument/hover");
+    REQUIRE(json_string(message, "URI") == "file:///a.cpp");
+    REQUIRE(json_value(message, "id") == "7");
+    REQUIRE(json_value(message, "textDocument") == R"({"uri": "file:///a.cpp"})");
+    REQUIRE_FALSE(json_value(message, "result").has_value());
+}
+
+TEST_CASE("JSON paths") {
+    SECTION("Nested members") {
+        const std::string message = R"({"method":"textDocument/didChange","params":{"textDocument":{"uri":"file:///a.cpp","version":3},"contentChanges":[]}})";
+        REQUIRE(json_string_at(message, {"method"}) == "textDocument/didChange");
+        REQUIRE(json_string_at(message, {"params", "textDocument", "uri"}) == "file:///a.cpp");
+        REQUIRE(json_at(message, {"params", "textDocument", "version"}) == "3");
+        REQUIRE(json_at(message, {"params", "contentChanges"}) == "[]");
+        REQUIRE_FALSE(json_at(message, {"params", "uri"}).has_value());
+        REQUIRE_FALSE(json_at(message, {"method", "uri"}).has_value());
+    }
+
+    SECTION("Members of the same name elsewhere are skipped") {
+        const std::string message =
+            R"({ "result" : {"id": 1, "uri": "file:///inner", "items": [{"id": 2}], "text": "\"id\": 3, \\"} , "uri": "file:///outer", "id" : 4 })";
+        REQUIRE(json_at(message, {"id"}) == "4");
+        REQUIRE(json_string_at(message, {"uri"}) == "file:///outer");
+        REQUIRE(json_at(message, {"result", "id"}) == "1");
+        REQUIRE(json_string_at(message, {"result", "text"}) == R"(\"id\": 3, \\)");
+    }
+
+    SECTION("Malformed messages") {
+        REQUIRE_FALSE(json_at("", {"id"}).has_value());
+        REQUIRE_FALSE(json_at(R"({"id": )", {"id"}).has_value());
+        REQUIRE_FALSE(json_at(R"({"params": {"uri": "file:///a)", {"params", "uri"}).has_value());
+        REQUIRE_FALSE(json_at(R"(["id", 1])", {"id"}).has_value());
+        REQUIRE_FALSE(json_string_at(R"({"id": 1})", {"id"}).has_value());
+    }
+}
+
+TEST_CASE("JSON array elements") {
+    const auto elements = json_elements(R"( [ {"text": "a,]"}, 2 ,"b", [3, 4]] )");
+    REQUIRE(elements.size() == 4);
+    REQUIRE(elements[0] == R"({"text": "a,]"})");
+    REQUIRE(elements[1] == "2");
+    REQUIRE(elements[2] == R"("b")");
+    REQUIRE(elements[3] == "[3, 4]");
+    REQUIRE(json_elements("[]").empty());
+    REQUIRE(json_elements(R"({"a": 1})").empty());
+}
+
+TEST_CASE("JSON string escaping") {
+    REQUIRE(json_escape("a\"b\\c\nd\x01") == R"("a\"b\\c\nd\u0001")");
+    REQUIRE(json_unescape(R"("a\"b\\c\nd\u0001")") == "a\"b\\c\nd\x01");
+    REQUIRE(json_unescape(R"(ż😀)") == "\xc5\xbc\xf0\x9f\x98\x80");
+    const std::string text = "line\r\n\ttab \xf0\x9f\x98\x80";
+    REQUIRE(json_unescape(json_escape(text)) == text);
+}
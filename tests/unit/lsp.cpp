@@ -0,0 +1,222 @@
+#include "../../common/header.h"
+#include "../../common/io.h"
+#include "../../common/json.h"
+#include "../../filesystem/lsp.h"
+#include <catch2/catch_test_macros.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+// The connection to the server and the socket of an editor window, both ends of each.
+struct lsp_sockets {
+    int server[2];
+    int extension[2];
+
+    lsp_sockets() {
+        REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, server) == 0);
+        REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, extension) == 0);
+        open_lsp_extension(extension[0]);
+    }
+    ~lsp_sockets() {
+        close_lsp_extension(extension[0], server[0], nullptr);
+        for (const int fd : {server[0], server[1], extension[0], extension[1]}) {
+            close(fd);
+        }
+    }
+
+    void request(const int id, std::string payload, const int language_id = 11) const {
+        REQUIRE(lsp_request_handler(extension[0], server[0], nullptr, id, language_id, payload.data()) >= 0);
+    }
+
+    // The payload of the next LSP_REQUEST sent to the server.
+    std::string sent() const {
+        char header_buffer[HEADER_SIZE];
+        REQUIRE(full_read(server[1], nullptr, *header_buffer, HEADER_SIZE) == HEADER_SIZE);
+        Header header;
+        deserialize(header_buffer, &header);
+        REQUIRE(header.type == Type::LSP_REQUEST);
+        std::string body(header.size, '\0');
+        REQUIRE(full_read(server[1], nullptr, *body.data(), header.size) == header.size);
+        LspRequest req;
+        REQUIRE(req.ParseFromString(body));
+        return req.payload();
+    }
+
+    bool nothing_sent() const {
+        char byte;
+        return recv(server[1], &byte, 1, MSG_DONTWAIT | MSG_PEEK) < 0;
+    }
+
+    // The payload of the next message written to the extension.
+    std::string received() const {
+        char header_buffer[HEADER_SIZE];
+        REQUIRE(full_read(extension[1], nullptr, *header_buffer, HEADER_SIZE) == HEADER_SIZE);
+        Header header;
+        deserialize(header_buffer, &header);
+        std::string payload(header.size, '\0');
+        REQUIRE(full_read(extension[1], nullptr, *payload.data(), header.size) == header.size);
+        return payload;
+    }
+
+    bool nothing_received() const {
+        char byte;
+        return recv(extension[1], &byte, 1, MSG_DONTWAIT | MSG_PEEK) < 0;
+    }
+};
+
+std::string did_change(const std::string &uri, const int version, const std::string &changes) {
+    return R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":")" + uri + R"(","version":)" +
+           std::to_string(version) + R"(},"contentChanges":[)" + changes + "]}}";
+}
+
+std::string did_open(const std::string &uri, const std::string &text) {
+    return R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":")" + uri + R"(","version":1,"text":)" +
+           json_escape(text) + "}}}";
+}
+
+std::string range(const int start_line, const int start_character, const int end_line, const int end_character) {
+    return R"({"start":{"line":)" + std::to_string(start_line) + R"(,"character":)" + std::to_string(start_character) + R"(},"end":{"line":)" +
+           std::to_string(end_line) + R"(,"character":)" + std::to_string(end_character) + "}}";
+}
+
+} // namespace
+
+TEST_CASE("Coalescing of document changes") {
+    lsp_sockets sockets;
+    const std::string edit = R"({"range":{"start":{"line":0,"character":0},"end":{"line":0,"character":0}},"text":"x"})";
+
+    SECTION("Consecutive changes of a document are sent as one") {
+        sockets.request(1, did_change("file:///coalesce/a.cpp", 1, edit));
+        sockets.request(2, did_change("file:///coalesce/a.cpp", 2, edit));
+        sockets.request(3, did_change("file:///coalesce/a.cpp", 3, edit));
+        flush_lsp_changes();
+        const auto sent = sockets.sent();
+        REQUIRE(json_at(sent, {"params", "textDocument", "version"}) == "3");
+        REQUIRE(json_at(sent, {"params", "contentChanges"}) == "[" + edit + "," + edit + "," + edit + "]");
+        REQUIRE(sockets.nothing_sent());
+    }
+
+    SECTION("The whole text replaces the changes before it") {
+        sockets.request(1, did_change("file:///coalesce/b.cpp", 1, edit));
+        sockets.request(2, did_change("file:///coalesce/b.cpp", 2, R"({"text":"whole"})"));
+        sockets.request(3, did_change("file:///coalesce/b.cpp", 3, edit));
+        flush_lsp_changes();
+        REQUIRE(json_at(sockets.sent(), {"params", "contentChanges"}) == R"([{"text":"whole"},)" + edit + "]");
+    }
+
+    SECTION("Other messages send the changes first") {
+        sockets.request(1, did_change("file:///coalesce/c.cpp", 1, edit));
+        sockets.request(2, did_change("file:///coalesce/d.cpp", 1, edit));
+        REQUIRE(json_string_at(sockets.sent(), {"params", "textDocument", "uri"}) == "file:///coalesce/c.cpp");
+        sockets.request(3, R"({"jsonrpc":"2.0","method":"textDocument/didSave","params":{"textDocument":{"uri":"file:///coalesce/d.cpp"}}})");
+        REQUIRE(json_string_at(sockets.sent(), {"params", "textDocument", "uri"}) == "file:///coalesce/d.cpp");
+        REQUIRE(json_string_at(sockets.sent(), {"method"}) == "textDocument/didSave");
+    }
+
+    SECTION("The uri of the document is not taken from the changes") {
+        const std::string nested = R"({"range":{"start":{"line":0,"character":0},"end":{"line":0,"character":0}},"text":"\"uri\":\"file:///other\""})";
+        sockets.request(1, R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"contentChanges":[)" + nested +
+                               R"(],"textDocument":{"uri":"file:///coalesce/e.cpp","version":1}}})");
+        sockets.request(2, did_change("file:///coalesce/e.cpp", 2, edit));
+        flush_lsp_changes();
+        REQUIRE(json_at(sockets.sent(), {"params", "contentChanges"}) == "[" + nested + "," + edit + "]");
+    }
+}
+
+static int respond(const std::string &language, const std::string &payload) {
+    LspResponse res;
+    res.set_language(language);
+    res.set_payload(payload);
+    return lsp_response_handler(-1, nullptr, 1, &res);
+}
+
+TEST_CASE("Multiplexing of the extensions") {
+    lsp_sockets first, second;
+
+    SECTION("Only the id of the request is replaced") {
+        first.request(1, R"({"jsonrpc":"2.0","method":"workspace/executeCommand","params":{"id":77,"arguments":[{"id":5}]},"id":5})");
+        const auto sent = first.sent();
+        REQUIRE(json_at(sent, {"params"}) == R"({"id":77,"arguments":[{"id":5}]})");
+        const auto unique_id = json_at(sent, {"id"});
+        REQUIRE(unique_id.has_value());
+        REQUIRE(*unique_id != "5");
+
+        REQUIRE(respond("cpp", R"({"jsonrpc":"2.0","result":{"id":)" + std::string(*unique_id) + R"(},"id":)" + std::string(*unique_id) + "}") == 0);
+        const auto received = first.received();
+        REQUIRE(json_at(received, {"id"}) == "5");
+        REQUIRE(json_at(received, {"result", "id"}) == unique_id);
+        REQUIRE(second.nothing_received());
+    }
+
+    SECTION("The cancellation names the replaced id") {
+        first.request(1, R"({"jsonrpc":"2.0","id":9,"method":"textDocument/hover","params":{}})");
+        const auto unique_id = std::string(json_at(first.sent(), {"id"}).value_or(""));
+        first.request(2, R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{"id":9}})");
+        REQUIRE(json_at(first.sent(), {"params", "id"}) == unique_id);
+    }
+
+    SECTION("The diagnostics go to the windows with the document open") {
+        first.request(1, R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":"file:///multiplex/a.cpp","text":""}}})");
+        second.request(1, R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":"file:///multiplex/b.cpp","text":""}}})");
+        REQUIRE(respond("cpp", R"({"jsonrpc":"2.0","method":"textDocument/publishDiagnostics","params":{"diagnostics":[{"relatedInformation":)"
+                               R"([{"location":{"uri":"file:///multiplex/b.cpp"}}]}],"uri":"file:///multiplex/a.cpp"}})") == 0);
+        REQUIRE(json_string_at(first.received(), {"params", "uri"}) == "file:///multiplex/a.cpp");
+        REQUIRE(second.nothing_received());
+    }
+}
+
+TEST_CASE("Translation of whole text changes") {
+    lsp_sockets sockets;
+    // the servers of the language take incremental changes, the later windows join the first one
+    static bool initialized = false;
+    sockets.request(1, R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})", 10);
+    if (!initialized) {
+        const auto initialize_id = json_at(sockets.sent(), {"id"});
+        REQUIRE(initialize_id.has_value());
+        LspResponse res;
+        res.set_language("c");
+        res.set_payload(R"({"jsonrpc":"2.0","id":)" + std::string(*initialize_id) + R"(,"result":{"capabilities":{"textDocumentSync":{"change":2}}}})");
+        REQUIRE(lsp_response_handler(sockets.server[0], nullptr, 1, &res) == 0);
+        initialized = true;
+    }
+
+    const auto change = [&sockets](const std::string &uri, const int version, const std::string &text) {
+        sockets.request(3, did_change(uri, version, R"({"text":)" + json_escape(text) + "}"), 10);
+        flush_lsp_changes();
+        const auto sent = sockets.sent();
+        REQUIRE(json_at(sent, {"params", "textDocument", "version"}) == std::to_string(version));
+        return std::string(json_at(sent, {"params", "contentChanges"}).value_or(""));
+    };
+    const auto edit = [](const std::string &edit_range, const std::string &text) { return R"([{"range":)" + edit_range + R"(,"text":)" + json_escape(text) + "}]"; };
+
+    SECTION("The range which differs is sent") {
+        sockets.request(2, did_open("file:///translate/a.c", "hello\nworld\n"), 10);
+        REQUIRE(json_string_at(sockets.sent(), {"method"}) == "textDocument/didOpen");
+        REQUIRE(change("file:///translate/a.c", 2, "hello\nbrave world\n") == edit(range(1, 0, 1, 0), "brave "));
+        REQUIRE(change("file:///translate/a.c", 3, "hello\n") == edit(range(1, 0, 2, 0), ""));
+    }
+
+    SECTION("Columns are counted in UTF-16 code units") {
+        sockets.request(2, did_open("file:///translate/b.c", "\xc5\xbc\xf0\x9f\x98\x80" "a"), 10);
+        sockets.sent();
+        REQUIRE(change("file:///translate/b.c", 2, "\xc5\xbc\xf0\x9f\x98\x80" "b") == edit(range(0, 3, 0, 4), "b"));
+    }
+
+    SECTION("A CRLF is not split") {
+        sockets.request(2, did_open("file:///translate/c.c", "a\r\nb"), 10);
+        sockets.sent();
+        REQUIRE(change("file:///translate/c.c", 2, "a\nb") == edit(range(0, 1, 1, 0), "\n"));
+    }
+
+    SECTION("The text is forgotten after changes with ranges") {
+        sockets.request(2, did_open("file:///translate/d.c", "abc"), 10);
+        sockets.sent();
+        const auto ranged = edit(range(0, 0, 0, 0), "x");
+        sockets.request(3, did_change("file:///translate/d.c", 2, ranged.substr(1, ranged.size() - 2)), 10);
+        flush_lsp_changes();
+        REQUIRE(json_at(sockets.sent(), {"params", "contentChanges"}) == ranged);
+        REQUIRE(change("file:///translate/d.c", 3, "xabcd") == R"([{"text":"xabcd"}])");
+        REQUIRE(change("file:///translate/d.c", 4, "xabcde") == edit(range(0, 5, 0, 5), "e"));
+    }
+}
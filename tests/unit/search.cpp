@@ -0,0 +1,62 @@
+#include "../../server/search.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+namespace {
+
+// The offset of the first match in text, -1 when there is none.
+long first_match(const SearchRequest &req, const std::string &text) {
+    Matcher matcher(req);
+    const char *end = text.data() + text.size();
+    const char *found = matcher.find(text.data(), end);
+    return found == end ? -1 : found - text.data();
+}
+
+SearchRequest pattern(const std::string &text, bool ignore_case = false, bool regex = false) {
+    SearchRequest req;
+    req.set_pattern(text);
+    req.set_ignore_case(ignore_case);
+    req.set_regex(regex);
+    return req;
+}
+
+} // namespace
+
+TEST_CASE("Search matcher") {
+    SECTION("Literal") {
+        REQUIRE(first_match(pattern("foo"), "a foo b foo") == 2);
+        REQUIRE(first_match(pattern("foo"), "a Foo b") == -1);
+        REQUIRE(first_match(pattern("foo"), "fo") == -1);
+        REQUIRE(first_match(pattern(""), "abc") == 0);
+    }
+
+    SECTION("Ignoring the case") {
+        REQUIRE(first_match(pattern("FoO", true), "xx fOo") == 3);
+        REQUIRE(first_match(pattern("foo", true), "F FO FOO") == 5);
+        REQUIRE(first_match(pattern("_id", true), "x_ID") == 1);
+        // the first letter is there but the rest does not fit
+        REQUIRE(first_match(pattern("abc", true), "xxA") == -1);
+        REQUIRE(first_match(pattern("abc", true), "ABD abd") == -1);
+    }
+
+    SECTION("Regex") {
+        REQUIRE(first_match(pattern("fo+", false, true), "f fooo") == 2);
+        REQUIRE(first_match(pattern("FO+", true, true), "f fooo") == 2);
+        // every line is matched on its own
+        REQUIRE(first_match(pattern("^b", false, true), "ab\nbc") == 3);
+        REQUIRE(first_match(pattern("a.b", false, true), "a\nb") == -1);
+        REQUIRE(first_match(pattern("x$", false, true), "ax\nb") == 1);
+        REQUIRE(first_match(pattern("[0-9]+", false, true), "none") == -1);
+    }
+
+    SECTION("Regex on long lines") {
+        const std::string long_line(100000, 'a');
+        // only the start of a long line is matched, the end is not the end of the line there
+        REQUIRE(first_match(pattern("a+$", false, true), long_line + "\nb") == -1);
+        REQUIRE(first_match(pattern("x", false, true), long_line + "x") == -1);
+        REQUIRE(first_match(pattern("(a|b)*c", false, true), long_line + "\nc") == 100001);
+        REQUIRE(first_match(pattern("^a", false, true), long_line) == 0);
+        // the literal search sees all of it
+        REQUIRE(first_match(pattern("x"), long_line + "x") == 100000);
+    }
+}
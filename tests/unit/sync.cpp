@@ -0,0 +1,166 @@
+#include "../../server/metrics.h"
+#include "../../server/sync.h"
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+// Stands in for the disk, the first flush is held until released so that the
+// syncs arriving meanwhile are collected into one batch.
+struct fake_disk {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool hold_first = true;
+    bool first_started = false;
+    bool released = false;
+    // the flushes by descriptor, true for fdatasync
+    std::multimap<int, bool> flushed;
+    std::map<int, int> errors;
+
+    int flush(int fd, bool datasync) {
+        std::unique_lock<std::mutex> lock(mutex);
+        flushed.emplace(fd, datasync);
+        if (hold_first && !first_started) {
+            first_started = true;
+            cv.notify_all();
+            cv.wait(lock, [&] { return released; });
+        }
+        cv.notify_all();
+        auto it = errors.find(fd);
+        return it != errors.end() ? it->second : 0;
+    }
+
+    // Waits until n flushes were started.
+    bool wait_flushed(size_t n) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, std::chrono::seconds(5), [&] { return flushed.size() >= n; });
+    }
+
+    void release() {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+        cv.notify_all();
+    }
+};
+
+// Descriptors of distinct files, closed at the end of the test.
+struct temp_files {
+    std::vector<int> fds;
+
+    explicit temp_files(size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            FILE *file = tmpfile();
+            REQUIRE(file != nullptr);
+            fds.push_back(dup(fileno(file)));
+            fclose(file);
+        }
+    }
+    ~temp_files() {
+        for (int fd : fds) {
+            close(fd);
+        }
+    }
+};
+
+} // namespace
+
+TEST_CASE("Group commit of the fsyncs") {
+    fake_disk disk;
+    // a long window, the batches in the tests are completed by their size
+    SyncScheduler scheduler(std::chrono::seconds(10), 3, [&](int fd, bool datasync) { return disk.flush(fd, datasync); });
+    Histogram &batches = histogram("fsync_batch");
+
+    SECTION("A lone sync is flushed right away") {
+        disk.hold_first = false;
+        temp_files files(1);
+        auto start = std::chrono::steady_clock::now();
+        REQUIRE(scheduler.sync(files.fds[0]) == 0);
+        REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(5));
+        REQUIRE(disk.flushed.size() == 1);
+    }
+
+    SECTION("The syncs arriving during a flush are batched") {
+        temp_files files(4);
+        const uint64_t flushes = batches.count();
+        int errors[4] = {-1, -1, -1, -1};
+        std::thread first([&] { errors[0] = scheduler.sync(files.fds[0]); });
+        REQUIRE(disk.wait_flushed(1));
+
+        std::vector<std::thread> others;
+        for (int i = 1; i < 4; i++) {
+            others.emplace_back([&, i] { errors[i] = scheduler.sync(files.fds[i]); });
+        }
+        // flushed together while the first flush is still on the disk
+        const bool batched = disk.wait_flushed(4);
+        for (auto &thread : others) {
+            thread.join();
+        }
+        disk.release();
+        first.join();
+        REQUIRE(batched);
+        REQUIRE(batches.count() - flushes == 2);
+        for (int error : errors) {
+            REQUIRE(error == 0);
+        }
+    }
+
+    SECTION("A file synced twice in a batch is flushed once") {
+        temp_files files(2);
+        const int same = dup(files.fds[1]);
+        std::thread first([&] { scheduler.sync(files.fds[0]); });
+        REQUIRE(disk.wait_flushed(1));
+
+        std::vector<std::thread> others;
+        others.emplace_back([&] { scheduler.sync(files.fds[1], true); });
+        others.emplace_back([&] { scheduler.sync(same, false); });
+        others.emplace_back([&] { scheduler.sync(files.fds[1], true); });
+        for (auto &thread : others) {
+            thread.join();
+        }
+        disk.release();
+        first.join();
+        close(same);
+        REQUIRE(disk.flushed.size() == 2);
+        // one of them wanted the metadata too
+        disk.flushed.erase(files.fds[0]);
+        REQUIRE_FALSE(disk.flushed.begin()->second);
+    }
+
+    SECTION("Only the data is flushed when asked") {
+        disk.hold_first = false;
+        temp_files files(1);
+        REQUIRE(scheduler.sync(files.fds[0], true) == 0);
+        REQUIRE(disk.flushed.begin()->second);
+    }
+
+    SECTION("The errors go to the requests of their files") {
+        temp_files files(3);
+        disk.errors[files.fds[1]] = EIO;
+        int closed = dup(files.fds[2]);
+        close(closed);
+        std::thread first([&] { scheduler.sync(files.fds[0]); });
+        REQUIRE(disk.wait_flushed(1));
+
+        int errors[3] = {-1, -1, -1};
+        std::vector<std::thread> others;
+        others.emplace_back([&] { errors[0] = scheduler.sync(files.fds[1]); });
+        others.emplace_back([&] { errors[1] = scheduler.sync(files.fds[2]); });
+        others.emplace_back([&] { errors[2] = scheduler.sync(closed); });
+        for (auto &thread : others) {
+            thread.join();
+        }
+        disk.release();
+        first.join();
+        REQUIRE(errors[0] == EIO);
+        REQUIRE(errors[1] == 0);
+        REQUIRE(errors[2] == EBADF);
+    }
+}
@@ -0,0 +1,58 @@
+#include "../../server/uri.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("URL encoding") {
+    REQUIRE(url_encode("/home/user/project") == "/home/user/project");
+    REQUIRE(url_encode("/home/my project/c++") == "/home/my%20project/c%2B%2B");
+    REQUIRE(url_encode("/tmp/\xc5\xbc") == "/tmp/%C5%BC");
+}
+
+TEST_CASE("Path rewriting") {
+    PathRewriter rewriter("/client/my project", "/srv/proj");
+
+    SECTION("Raw and encoded paths") {
+        const std::string message = R"({"uri":"file:///client/my%20project/a.cpp","path":"/client/my project/b.cpp"})";
+        REQUIRE(rewriter.rewrite(message) == R"({"uri":"file:///srv/proj/a.cpp","path":"/srv/proj/b.cpp"})");
+    }
+
+    SECTION("Lowercase escapes") {
+        REQUIRE(rewriter.rewrite("file:///client/my%20project/x") == "file:///srv/proj/x");
+        PathRewriter colon("/c:/src", "/srv");
+        REQUIRE(colon.rewrite("file:///c%3a/src/x file:///c%3A/src/y") == "file:///srv/x file:///srv/y");
+    }
+
+    SECTION("Messages without the path are returned as they are") {
+        const std::string message = R"({"uri":"file:///client/other/a.cpp"})";
+        REQUIRE(rewriter.rewrite(message).data() == message.data());
+    }
+
+    SECTION("Paths at the ends and next to each other") {
+        REQUIRE(rewriter.rewrite("/client/my project") == "/srv/proj");
+        REQUIRE(rewriter.rewrite("/client/my project/client/my project") == "/srv/proj/srv/proj");
+        REQUIRE(rewriter.rewrite("/client/my proj") == "/client/my proj");
+    }
+
+    SECTION("The buffer is reused") {
+        REQUIRE(rewriter.rewrite("a /client/my project b") == "a /srv/proj b");
+        REQUIRE(rewriter.rewrite("/client/my project") == "/srv/proj");
+    }
+}
+
+TEST_CASE("Path rewriting of large messages", "[.benchmark]") {
+    PathRewriter rewriter("/home/user/my project", "/srv/projects/web");
+    std::string symbols = "[";
+    for (int i = 0; i < 50000; i++) {
+        symbols += R"({"name":"symbol)" + std::to_string(i) + R"(","kind":12,"location":{"uri":"file:///home/user/my%20project/src/file)" +
+                   std::to_string(i % 100) + R"(.cpp","range":{"start":{"line":1,"character":2},"end":{"line":1,"character":9}}}},)";
+    }
+    symbols += "{}]";
+    std::string tokens = R"({"result":{"data":[)";
+    while (tokens.size() < (4 << 20)) {
+        tokens += "0,4,7,1,0,";
+    }
+    tokens += "0]}}";
+
+    BENCHMARK("workspace symbols") { return rewriter.rewrite(symbols).size(); };
+    BENCHMARK("semantic tokens") { return rewriter.rewrite(tokens).size(); };
+}